@@ -42,6 +42,11 @@ static void PrintBucketData(Bucket_Group *pBucketGroup,
     Bucket_Data *pBucketData);
 static void ProcessBucketGroup(Bucket_Group *pBucketGroup,
     void (*pFunction)(Bucket_Group *pBucketGroup,Bucket_Data *pBucketData));
+static void AddIntervalToBucketGroup(Bucket_Group *pBucketGroup,
+    Dwarf_Addr low,Dwarf_Addr high);
+static Dwarf_Bool BuildIntervalsBucketGroup(Bucket_Group *pBucketGroup);
+static Dwarf_Bool FindAddressInIntervals(Bucket_Group *pBucketGroup,
+    Dwarf_Addr address);
 
 Bucket_Group *
 AllocateBucketGroup(int kind)
@@ -65,6 +70,8 @@ ReleaseBucketGroup(Bucket_Group *pBucketGroup)
     }
     pBucketGroup->pHead = NULL;
     pBucketGroup->pTail = NULL;
+    free(pBucketGroup->pIntervals);
+    pBucketGroup->pIntervals = NULL;
     free(pBucketGroup);
 }
 
@@ -77,6 +84,9 @@ ResetBucketGroup(Bucket_Group *pBucketGroup)
     for (pBucket = pBucketGroup->pHead; pBucket; pBucket = pBucket->pNext) {
         pBucket->nEntries = 0;
     }
+    /* No entries, so the (empty) interval index is valid. */
+    pBucketGroup->nIntervals = 0;
+    pBucketGroup->bIntervalsValid = TRUE;
     ResetSentinelBucketGroup(pBucketGroup);
 }
 
@@ -181,6 +191,9 @@ AddEntryIntoBucketGroup(Bucket_Group *pBucketGroup,
     data.high = high;
 
     assert(pBucketGroup);
+    if (pBucketGroup->bIntervalsValid) {
+        AddIntervalToBucketGroup(pBucketGroup,low,high);
+    }
     if (!pBucketGroup->pHead) {
         /* Allocate first bucket */
         pBucket = (Bucket *)calloc(1,sizeof(Bucket));
@@ -250,6 +263,9 @@ DeleteKeyInBucketGroup(Bucket_Group *pBucketGroup,Dwarf_Addr key)
                 }
                 pBucket->Entries[nIndex] = data;
                 --pBucket->nEntries;
+                /*  Ranges cannot be taken out of the merged
+                    intervals, so rebuild them when next needed. */
+                pBucketGroup->bIntervalsValid = FALSE;
                 return TRUE;
             }
         }
@@ -269,7 +285,10 @@ FindAddressInBucketGroup(Bucket_Group *pBucketGroup,Dwarf_Addr address)
     Bucket_Data *pBucketData = 0;
 
     assert(pBucketGroup);
-    /* For now do a linear search */
+    if (BuildIntervalsBucketGroup(pBucketGroup)) {
+        return FindAddressInIntervals(pBucketGroup,address);
+    }
+    /* Out of memory for the interval index: do a linear search */
     for (pBucket = pBucketGroup->pHead; pBucket && pBucket->nEntries;
         pBucket = pBucket->pNext) {
 
@@ -439,6 +458,10 @@ IsValidInBucketGroup(Bucket_Group *pBucketGroup,Dwarf_Addr address)
     /* Check the address is within the allowed limits */
     if (address >= pBucketGroup->lower &&
         address <= pBucketGroup->upper) {
+        if (BuildIntervalsBucketGroup(pBucketGroup)) {
+            return FindAddressInIntervals(pBucketGroup,address);
+        }
+        /* Out of memory for the interval index: do a linear search */
         for (pBucket = pBucketGroup->pHead;
             pBucket && pBucket->nEntries;
             pBucket = pBucket->pNext) {
@@ -454,6 +477,205 @@ IsValidInBucketGroup(Bucket_Group *pBucketGroup,Dwarf_Addr address)
     return FALSE;
 }
 
+/*  Make room for at least 'count' intervals.
+    Returns FALSE if out of memory. */
+static Dwarf_Bool
+GrowIntervalsBucketGroup(Bucket_Group *pBucketGroup,int count)
+{
+    Bucket_Interval *pNew = 0;
+    int nNewAlloc = 0;
+
+    if (count <= pBucketGroup->nIntervalsAlloc) {
+        return TRUE;
+    }
+    nNewAlloc = pBucketGroup->nIntervalsAlloc?
+        pBucketGroup->nIntervalsAlloc * 2 : 64;
+    if (nNewAlloc < count) {
+        nNewAlloc = count;
+    }
+    pNew = (Bucket_Interval *)realloc(pBucketGroup->pIntervals,
+        nNewAlloc * sizeof(Bucket_Interval));
+    if (!pNew) {
+        return FALSE;
+    }
+    pBucketGroup->pIntervals = pNew;
+    pBucketGroup->nIntervalsAlloc = nNewAlloc;
+    return TRUE;
+}
+
+/*  Merge [low,high] into the sorted, coalesced intervals.
+    Intervals that overlap or are adjacent to the new one
+    are folded into a single interval.  */
+static void
+AddIntervalToBucketGroup(Bucket_Group *pBucketGroup,
+    Dwarf_Addr low,Dwarf_Addr high)
+{
+    Bucket_Interval *pIntervals = 0;
+    int nFirst = 0;
+    int nLast = 0;
+    int mid = 0;
+    int n = pBucketGroup->nIntervals;
+
+    if (low > high) {
+        /* Matches no address. */
+        return;
+    }
+    pIntervals = pBucketGroup->pIntervals;
+
+    /*  nFirst: first interval whose high reaches low
+        (or low - 1, as adjacent intervals merge). */
+    nFirst = 0;
+    nLast = n;
+    while (nFirst < nLast) {
+        mid = nFirst + (nLast - nFirst) / 2;
+        if (low && pIntervals[mid].high < low - 1) {
+            nFirst = mid + 1;
+        } else {
+            nLast = mid;
+        }
+    }
+    /*  nLast: first interval starting beyond high + 1.
+        Intervals nFirst .. nLast-1 merge with the new one. */
+    nLast = n;
+    if (high != (Dwarf_Addr)-1) {
+        int lo = nFirst;
+        int hi = n;
+        while (lo < hi) {
+            mid = lo + (hi - lo) / 2;
+            if (pIntervals[mid].low <= high + 1) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        nLast = lo;
+    }
+
+    if (nFirst == nLast) {
+        /* Nothing to merge with: insert at nFirst. */
+        if (!GrowIntervalsBucketGroup(pBucketGroup,n + 1)) {
+            pBucketGroup->bIntervalsValid = FALSE;
+            return;
+        }
+        pIntervals = pBucketGroup->pIntervals;
+        memmove(&pIntervals[nFirst + 1],&pIntervals[nFirst],
+            (n - nFirst) * sizeof(Bucket_Interval));
+        pIntervals[nFirst].low = low;
+        pIntervals[nFirst].high = high;
+        pBucketGroup->nIntervals = n + 1;
+        return;
+    }
+    if (pIntervals[nFirst].low < low) {
+        low = pIntervals[nFirst].low;
+    }
+    if (pIntervals[nLast - 1].high > high) {
+        high = pIntervals[nLast - 1].high;
+    }
+    pIntervals[nFirst].low = low;
+    pIntervals[nFirst].high = high;
+    memmove(&pIntervals[nFirst + 1],&pIntervals[nLast],
+        (n - nLast) * sizeof(Bucket_Interval));
+    pBucketGroup->nIntervals = n - (nLast - nFirst - 1);
+}
+
+static int
+CompareIntervals(const void *l,const void *r)
+{
+    const Bucket_Interval *pLeft = (const Bucket_Interval *)l;
+    const Bucket_Interval *pRight = (const Bucket_Interval *)r;
+
+    if (pLeft->low < pRight->low) {
+        return -1;
+    }
+    if (pLeft->low > pRight->low) {
+        return 1;
+    }
+    return 0;
+}
+
+/*  Make sure the interval index reflects the entries,
+    rebuilding it from the buckets if needed (only after
+    a delete or on first use).
+    Returns FALSE if out of memory. */
+static Dwarf_Bool
+BuildIntervalsBucketGroup(Bucket_Group *pBucketGroup)
+{
+    int nIndex = 0;
+    int nCount = 0;
+    int nOut = 0;
+    Bucket *pBucket = 0;
+    Bucket_Data *pBucketData = 0;
+    Bucket_Interval *pIntervals = 0;
+
+    if (pBucketGroup->bIntervalsValid) {
+        return TRUE;
+    }
+    for (pBucket = pBucketGroup->pHead; pBucket && pBucket->nEntries;
+        pBucket = pBucket->pNext) {
+        nCount += pBucket->nEntries;
+    }
+    if (!GrowIntervalsBucketGroup(pBucketGroup,nCount)) {
+        return FALSE;
+    }
+    pIntervals = pBucketGroup->pIntervals;
+    nCount = 0;
+    for (pBucket = pBucketGroup->pHead; pBucket && pBucket->nEntries;
+        pBucket = pBucket->pNext) {
+        for (nIndex = 0; nIndex < pBucket->nEntries; ++nIndex) {
+            pBucketData = &pBucket->Entries[nIndex];
+            if (pBucketData->low <= pBucketData->high) {
+                pIntervals[nCount].low = pBucketData->low;
+                pIntervals[nCount].high = pBucketData->high;
+                ++nCount;
+            }
+        }
+    }
+    if (nCount > 1) {
+        qsort(pIntervals,nCount,sizeof(Bucket_Interval),CompareIntervals);
+    }
+
+    /* Coalesce overlapping and adjacent intervals. */
+    for (nIndex = 0; nIndex < nCount; ++nIndex) {
+        if (nOut &&
+            (pIntervals[nOut - 1].high == (Dwarf_Addr)-1 ||
+            pIntervals[nIndex].low <= pIntervals[nOut - 1].high + 1)) {
+            if (pIntervals[nIndex].high > pIntervals[nOut - 1].high) {
+                pIntervals[nOut - 1].high = pIntervals[nIndex].high;
+            }
+        } else {
+            pIntervals[nOut++] = pIntervals[nIndex];
+        }
+    }
+    pBucketGroup->nIntervals = nOut;
+    pBucketGroup->bIntervalsValid = TRUE;
+    return TRUE;
+}
+
+/*  Binary search for the interval containing address.  */
+static Dwarf_Bool
+FindAddressInIntervals(Bucket_Group *pBucketGroup,Dwarf_Addr address)
+{
+    int low = 0;
+    int high = pBucketGroup->nIntervals;
+    int mid = 0;
+    Bucket_Interval *pIntervals = pBucketGroup->pIntervals;
+
+    /* Find the first interval starting beyond address. */
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (pIntervals[mid].low <= address) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    /* The one before it is the only one that can hold address. */
+    if (low > 0 && address <= pIntervals[low - 1].high) {
+        return TRUE;
+    }
+    return FALSE;
+}
+
 /*  Reset limits for values in the Bucket Set */
 void
 ResetLimitsBucketSet(Bucket_Group *pBucketGroup)
@@ -57,6 +57,13 @@ typedef struct bucket {
     struct bucket *pNext;
 }   Bucket;
 
+/*  One address range [low,high] (both ends included) of
+    the interval index of a Bucket_Group. */
+typedef struct {
+    Dwarf_Addr low;
+    Dwarf_Addr high;
+} Bucket_Interval;
+
 /* This Forms the head record of a list of Buckets.
 */
 typedef struct {
@@ -67,6 +74,17 @@ typedef struct {
     Bucket_Data *pLast;   /* Last sentinel */
     Bucket *pHead;        /* First bucket in set */
     Bucket *pTail;        /* Last bucket in set */
+
+    /*  The low/high ranges of all the entries, sorted
+        and with overlapping or adjacent ranges merged,
+        so an address lookup is a binary search.
+        Kept up to date as entries are added. Deleting
+        an entry clears bIntervalsValid and the
+        index is rebuilt by the next address lookup. */
+    Bucket_Interval *pIntervals;
+    int nIntervals;
+    int nIntervalsAlloc;
+    Dwarf_Bool bIntervalsValid;
 } Bucket_Group;
 
 Bucket_Group *AllocateBucketGroup(int kind);
@@ -48,6 +48,7 @@
 #include "helpertree.h"
 #include "uri.h"
 #include "esb.h"                /* For flexible string buffer. */
+#include "outbuf.h"
 #include "tag_common.h"
 
 #ifdef _WIN32
@@ -212,6 +213,12 @@ boolean found_error_message = FALSE;
 */
 int break_after_n_units = INT_MAX;
 
+/*  parallel_jobs is set by -j <num>. When greater than one
+    the .debug_info compilation units are printed or checked
+    by <num> worker processes and the output merged back
+    in CU order. See print_die.c. */
+int parallel_jobs = 0;
+
 boolean check_names = FALSE;
 boolean check_verbose_mode = TRUE; /* During '-k' mode, display errors */
 boolean check_frames = FALSE;
@@ -352,6 +359,9 @@ static boolean add_to_unique_errors_table(char * error_text);
 */
 static struct esb_s config_file_path;
 static struct esb_s config_file_tiedpath;
+/*  Set by -x zcache=<dir>: where libdwarf may keep
+    decompressed copies of compressed DWARF sections. */
+static const char *zcache_dir = 0;
 static const char *config_file_abi = 0;
 static char *config_file_defaults[] = {
     "dwarfdump.conf",
@@ -538,6 +548,8 @@ main(int argc, char *argv[])
     stderr->_file = stdout->_file;
 #endif
     dup2(fileno(stdout),fileno(stderr));
+#else /* !_WIN32 */
+    outbuf_setup();
 #endif /* _WIN32 */
 
     print_version_details(argv[0],FALSE);
@@ -559,6 +571,9 @@ main(int argc, char *argv[])
             exit(FAILED);
         }
         dup2(fileno(stdout),fileno(stderr));
+#ifndef _WIN32
+        outbuf_setup();
+#endif /* _WIN32 */
         /* Record version and arguments in the output file */
         print_version_details(argv[0],TRUE);
         print_args(argc,argv);
@@ -1189,12 +1204,13 @@ print_checks_results(void)
     fflush(stdout);
 }
 
-/* This is for dwarf_print_lines() */
+/*  This is for dwarf_print_lines() and the other
+    libdwarf printing: same stream, same fast path. */
 static void
 printf_callback_for_libdwarf(UNUSEDARG void *userdata,
     const char *data)
 {
-    printf("%s",data);
+    outbuf_puts(data);
 }
 
 
@@ -1245,6 +1261,39 @@ dbgsetup(Dwarf_Debug dbg,struct dwconf_s *setup_config_file_data)
     dwarf_set_harmless_error_list_size(dbg,50);
 }
 
+/*  With -x zcache= compressed sections are looked for in
+    (and saved to) the cache directory, and with -j
+    all compressed sections are inflated up front by that
+    many threads.  Any failure here is left for the
+    normal lazy section load to report.
+    dbg is often null when dbgtied was passed in. */
+static void
+setup_decompression(Dwarf_Debug dbg)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    if (!dbg) {
+        return;
+    }
+    if (zcache_dir) {
+        res = dwarf_set_decompress_cache_dir(dbg,zcache_dir,&err);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,err,DW_DLA_ERROR);
+            err = 0;
+        }
+    }
+    if (parallel_jobs > 1 || zcache_dir) {
+        unsigned threads = parallel_jobs > 1? parallel_jobs:1;
+
+        res = dwarf_decompress_sections(dbg,threads,&err);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,err,DW_DLA_ERROR);
+            err = 0;
+        }
+    }
+}
+
 /*  Callable at any time, Sets section sizes with the sizes
     known as of the call.
     Repeat whenever about to  reference a size that might not
@@ -1320,6 +1369,8 @@ process_one_file(Elf * elf,Elf *elftied,
         dwarf_register_printf_callback(dbgtied,&printfcallbackdata);
     }
     memset(&printfcallbackdata,0,sizeof(printfcallbackdata));
+    setup_decompression(dbg);
+    setup_decompression(dbgtied);
 
 
 
@@ -1553,6 +1604,7 @@ static const char *usage_text[] = {
 "\t\t\t  example: to stop after <num> compilation units",
 "\t\t-i\tprint info section",
 "\t\t-I\tprint sections .gdb_index, .debug_cu_index, .debug_tu_index",
+"\t\t-j <num>\tprint or check .debug_info using <num> processes",
 /* FIXME -kw is check macros */
 "\t\t-k[abcdDeEfFgGilmMnrRsStu[f]x[e]y] check dwarf information",
 "\t\t   a\tdo all checks",
@@ -1626,6 +1678,7 @@ static const char *usage_text[] = {
 "\t\t-x abi=<abi>\tname abi in dwarfdump.conf",
 "\t\t-x name=<path>\tname dwarfdump.conf",
 "\t\t-x tied=<tiedpath>\tname an associated object file (Split DWARF)",
+"\t\t-x zcache=<dir>\tcache decompressed sections in <dir>",
 #if 0
 "\t\t-x nosanitizestrings\tLet bogus string characters come thru printf",
 #endif
@@ -1713,9 +1766,9 @@ process_args(int argc, char *argv[])
         do_all();
     }
 
-    /* j unused */
+    /* -j <num> selects parallel CU processing. */
     while ((c = dwgetopt(argc, argv,
-        "#:abc::CdDeE::fFgGhH:iIk:l::mMnNo::O:pPqQrRsS:t:u:UvVwW::x:yz")) != EOF) {
+        "#:abc::CdDeE::fFgGhH:iIj:k:l::mMnNo::O:pPqQrRsS:t:u:UvVwW::x:yz")) != EOF) {
 
         switch (c) {
         /* Internal debug level setting. */
@@ -1765,6 +1818,13 @@ process_args(int argc, char *argv[])
                     esb_empty_string(&config_file_tiedpath);
                     esb_append(&config_file_tiedpath,tiedpath);
                     break;
+                } else if (strncmp(dwoptarg, "zcache=", 7) == 0) {
+                    zcache_dir = do_uri_translation(&dwoptarg[7],
+                        "-x zcache=");
+                    if (strlen(zcache_dir) < 1) {
+                        goto badopt;
+                    }
+                    break;
                 } else if (strncmp(dwoptarg, "line5=", 6) == 0) {
                     if (strlen(dwoptarg) < 6) {
                         goto badopt;
@@ -1792,6 +1852,8 @@ process_args(int argc, char *argv[])
                     fprintf(stderr, " and  \n");
                     fprintf(stderr, "-x tied=<tied-file-path> \n");
                     fprintf(stderr, " and  \n");
+                    fprintf(stderr, "-x zcache=<cache-dir-path> \n");
+                    fprintf(stderr, " and  \n");
                     fprintf(stderr, "-x line5={std,s2l,orig,orig2l} \n");
                     fprintf(stderr, " and  \n");
                     fprintf(stderr, "-x nosanitizestrings \n");
@@ -1844,6 +1906,14 @@ process_args(int argc, char *argv[])
                 }
             }
             break;
+        case 'j':
+            {
+                int jobs = atoi(dwoptarg);
+                if (jobs > 0) {
+                    parallel_jobs = jobs;
+                }
+            }
+            break;
         case 'F':
             eh_frame_flag = TRUE;
             suppress_check_dwarf();
@@ -2773,6 +2843,25 @@ hasprefix(const char *sample, const char *prefix)
         current_compiler
     The compiler name is from DW_AT_producer.
 */
+static int
+find_detected_compiler(const char *producer_name)
+{
+    int index = 0;
+
+    for (index = 1; index <= compilers_detected_count; ++index) {
+        if (
+#if _WIN32
+            !stricmp(compilers_detected[index].name,producer_name)
+#else
+            !strcmp(compilers_detected[index].name,producer_name)
+#endif /* _WIN32 */
+            ) {
+            return index;
+        }
+    }
+    return 0;
+}
+
 void
 update_compiler_target(const char *producer_name)
 {
@@ -2806,19 +2895,11 @@ update_compiler_target(const char *producer_name)
     }
 
     /* Check for already detected compiler */
-    for (index = 1; index <= compilers_detected_count; ++index) {
-        if (
-#if _WIN32
-            !stricmp(compilers_detected[index].name,CU_producer)
-#else
-            !strcmp(compilers_detected[index].name,CU_producer)
-#endif /* _WIN32 */
-            ) {
-            /* Set current compiler index */
-            current_compiler = index;
-            cFound = TRUE;
-            break;
-        }
+    index = find_detected_compiler(CU_producer);
+    if (index > 0) {
+        /* Set current compiler index */
+        current_compiler = index;
+        cFound = TRUE;
     }
     if (!cFound) {
         /* Record a new detected compiler name. */
@@ -2864,6 +2945,126 @@ add_cu_name_compiler_target(char *name)
     pCompiler->cu_last = nc;
 }
 
+/*  For -j. Strings in the worker result files are written
+    as a length line followed by the bytes, so producer
+    and CU names may contain any character. */
+void
+write_counted_string(FILE *f,const char *str)
+{
+    size_t len = str? strlen(str):0;
+
+    fprintf(f,"%lu\n",(unsigned long)len);
+    if (len) {
+        fwrite(str,1,len,f);
+    }
+    fputc('\n',f);
+}
+
+boolean
+read_counted_string(FILE *f,struct esb_s *out)
+{
+    unsigned long len = 0;
+    char buf[200];
+
+    esb_empty_string(out);
+    if (fscanf(f,"%lu",&len) != 1 || fgetc(f) != '\n') {
+        return FALSE;
+    }
+    while (len) {
+        size_t want = len < sizeof(buf)? len:sizeof(buf);
+
+        if (fread(buf,1,want,f) != want) {
+            return FALSE;
+        }
+        esb_appendn(out,buf,want);
+        len -= want;
+    }
+    if (fgetc(f) != '\n') {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*  A -j worker writes its check counts here when done.
+    The parent has already replayed the worker's
+    update_compiler_target() calls in CU order, so
+    merge_check_results() finds each compiler by name. */
+void
+save_check_results(FILE *f)
+{
+    int index = 0;
+    int category = 0;
+
+    fprintf(f,"R %d %d %d\n",check_error,search_occurrences,
+        compilers_detected_count);
+    for (index = 0; index <= compilers_detected_count; ++index) {
+        Compiler *pCompiler = &compilers_detected[index];
+
+        write_counted_string(f,index? pCompiler->name:"");
+        fprintf(f,"%d\n",pCompiler->verified);
+        for (category = 0; category < LAST_CATEGORY; ++category) {
+            fprintf(f,"%d %d\n",pCompiler->results[category].checks,
+                pCompiler->results[category].errors);
+        }
+    }
+}
+
+boolean
+merge_check_results(FILE *f)
+{
+    int index = 0;
+    int category = 0;
+    int errcount = 0;
+    int occurrences = 0;
+    int count = 0;
+    boolean ok = TRUE;
+    struct esb_s name;
+
+    if (fscanf(f," R %d %d %d",&errcount,&occurrences,&count) != 3 ||
+        fgetc(f) != '\n') {
+        return FALSE;
+    }
+    check_error += errcount;
+    search_occurrences += occurrences;
+    esb_constructor(&name);
+    for (index = 0; ok && index <= count; ++index) {
+        Compiler *pCompiler = 0;
+        int verified = 0;
+
+        if (!read_counted_string(f,&name) ||
+            fscanf(f,"%d",&verified) != 1) {
+            ok = FALSE;
+            break;
+        }
+        if (!index) {
+            pCompiler = &compilers_detected[0];
+        } else {
+            int found = find_detected_compiler(esb_get_string(&name));
+            if (found) {
+                pCompiler = &compilers_detected[found];
+            }
+        }
+        if (pCompiler && verified) {
+            pCompiler->verified = TRUE;
+        }
+        for (category = 0; category < LAST_CATEGORY; ++category) {
+            int checks = 0;
+            int errors = 0;
+
+            if (fscanf(f,"%d %d",&checks,&errors) != 2) {
+                ok = FALSE;
+                break;
+            }
+            if (pCompiler) {
+                pCompiler->results[category].checks += checks;
+                pCompiler->results[category].errors += errors;
+            }
+        }
+    }
+    esb_destructor(&name);
+    return ok;
+}
+
 /* Reset a compiler entry, so all fields are properly set */
 static void
 reset_compiler_entry(Compiler *compiler)
@@ -35,6 +35,7 @@
 #include <ctype.h>
 #include "dwconf.h"
 #include "makename.h"
+#include "outbuf.h"
 
 #define WIN32_LEAN_AND_MEAN
 #include "windows.h" // JJ
@@ -1394,29 +1395,31 @@ print_reg_from_config_data(Dwarf_Unsigned reg,
 {
     char *name = 0;
     if (reg == config_data->cf_cfa_reg) {
-        fputs("cfa",stdout);
+        outbuf_puts("cfa");
         return;
     }
     if (reg == config_data->cf_undefined_val) {
-        fputs("u",stdout);
+        outbuf_putc('u');
         return;
     }
     if (reg == config_data->cf_same_val) {
-        fputs("s",stdout);
+        outbuf_putc('s');
         return;
     }
 
     if (config_data->cf_regs == 0 ||
         reg >= config_data->cf_named_regs_table_size) {
-        printf("r%" DW_PR_DUu "",reg);
+        outbuf_putc('r');
+        outbuf_udec(reg,0);
         return;
     }
     name = config_data->cf_regs[reg];
     if (!name) {
         /* Can happen, the reg names table can be sparse. */
-        printf("r%" DW_PR_DUu "", reg);
+        outbuf_putc('r');
+        outbuf_udec(reg,0);
         return;
     }
-    fputs(name,stdout);
+    outbuf_puts(name);
     return;
 }
@@ -287,6 +287,7 @@ extern boolean found_error_message;
 #define PRINTING_UNIQUE (!found_error_message)
 
 extern int break_after_n_units;
+extern int parallel_jobs;
 
 extern boolean check_names;          /* Check for invalid names */
 extern boolean check_verbose_mode;   /* During '-k' mode, display errors */
@@ -469,6 +470,12 @@ extern boolean checking_this_compiler(void);
 extern void update_compiler_target(const char *producer_name);
 extern void add_cu_name_compiler_target(char *name);
 
+/* Passing -j worker results back to the parent process. */
+extern void write_counted_string(FILE *f,const char *str);
+extern boolean read_counted_string(FILE *f,struct esb_s *out);
+extern void save_check_results(FILE *f);
+extern boolean merge_check_results(FILE *f);
+
 /*  General error reporting routines. These were
     macros for a short time and when changed into functions
     they kept (for now) their capitalization.
@@ -0,0 +1,159 @@
+/*
+  Copyright 2026 David Anderson. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write the Free Software Foundation, Inc., 51
+  Franklin Street - Fifth Floor, Boston MA 02110-1301, USA.
+*/
+
+/*  outbuf.c
+    Fast output to stdout. See outbuf.h.
+    New October 2026.
+*/
+
+#include "globals.h"
+#include <unistd.h> /* for isatty() */
+#include "outbuf.h"
+
+#ifdef _WIN32
+#define putc_unlocked(c,f) putc((c),(f))
+#endif /* _WIN32 */
+
+/*  Big enough that even -a -v on a large object
+    needs only a few thousand write(2) calls. */
+#define OUTBUF_SIZE (1024*1024)
+
+static char *outbuf_space;
+
+void
+outbuf_setup(void)
+{
+    if (isatty(fileno(stdout))) {
+        return;
+    }
+    if (!outbuf_space) {
+        outbuf_space = malloc(OUTBUF_SIZE);
+        if (!outbuf_space) {
+            /* Stay with what stdio chose. */
+            return;
+        }
+    }
+    setvbuf(stdout,outbuf_space,_IOFBF,OUTBUF_SIZE);
+}
+
+void
+outbuf_putc(int c)
+{
+    putc_unlocked(c,stdout);
+}
+
+void
+outbuf_putsn(const char *s, size_t len)
+{
+    const char *end = s + len;
+
+    for ( ; s < end; ++s) {
+        putc_unlocked(*s,stdout);
+    }
+}
+
+void
+outbuf_puts(const char *s)
+{
+    for ( ; *s; ++s) {
+        putc_unlocked(*s,stdout);
+    }
+}
+
+void
+outbuf_spaces(int n)
+{
+    for ( ; n > 0; --n) {
+        putc_unlocked(' ',stdout);
+    }
+}
+
+void
+outbuf_puts_left(const char *s, int width)
+{
+    for ( ; *s; ++s, --width) {
+        putc_unlocked(*s,stdout);
+    }
+    outbuf_spaces(width);
+}
+
+/*  Digits are built backwards from the end of buf.
+    24 covers the 20 decimal digits of 2**64, a sign
+    and the NUL. */
+#define OUTBUF_DIGITS 24
+
+void
+outbuf_hex(Dwarf_Unsigned v, int width)
+{
+    static const char hexdigits[] = "0123456789abcdef";
+    char buf[OUTBUF_DIGITS];
+    char *cp = buf + sizeof(buf);
+    int len = 0;
+
+    do {
+        *--cp = hexdigits[v & 0xf];
+        v >>= 4;
+        ++len;
+    } while (v);
+    for ( ; len < width; ++len) {
+        putc_unlocked('0',stdout);
+    }
+    outbuf_putsn(cp,buf + sizeof(buf) - cp);
+}
+
+static void
+outbuf_dec(Dwarf_Unsigned v, int negative, int width)
+{
+    char buf[OUTBUF_DIGITS];
+    char *cp = buf + sizeof(buf);
+    int len = 0;
+
+    do {
+        *--cp = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    if (negative) {
+        *--cp = '-';
+    }
+    len = (int)(buf + sizeof(buf) - cp);
+    outbuf_spaces(width - len);
+    outbuf_putsn(cp,len);
+}
+
+void
+outbuf_udec(Dwarf_Unsigned v, int width)
+{
+    outbuf_dec(v,FALSE,width);
+}
+
+void
+outbuf_sdec(Dwarf_Signed v, int width)
+{
+    if (v < 0) {
+        /*  Negate as unsigned so the most negative
+            value is right too. */
+        outbuf_dec(0 - (Dwarf_Unsigned)v,TRUE,width);
+        return;
+    }
+    outbuf_dec((Dwarf_Unsigned)v,FALSE,width);
+}
@@ -0,0 +1,72 @@
+/*
+  Copyright 2026 David Anderson. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write the Free Software Foundation, Inc., 51
+  Franklin Street - Fifth Floor, Boston MA 02110-1301, USA.
+*/
+
+/*  outbuf.h
+    Fast output to stdout for the hot printing paths.
+
+    Everything goes into the stdio buffer of stdout, so
+    output from these functions and from printf() appear
+    in the order they were called and fflush(stdout)
+    still means what it always did.  What is saved is
+    the format-string parsing of printf() and the
+    per-call stream lock: these use putc_unlocked().
+    dwarfdump has only the one thread doing output
+    (-j workers are separate processes, each with its
+    own stdout).
+*/
+
+#ifndef OUTBUF_H
+#define OUTBUF_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  Gives stdout a large buffer, so a file or pipe is
+    written in a few big write(2) calls. Call before
+    anything is written to stdout (again after freopen()).
+    A terminal is left line buffered. */
+void outbuf_setup(void);
+
+void outbuf_putc(int c);
+void outbuf_puts(const char *s);
+void outbuf_putsn(const char *s, size_t len);
+
+/*  n spaces. */
+void outbuf_spaces(int n);
+
+/*  As printf("%-*s",width,s). */
+void outbuf_puts_left(const char *s, int width);
+
+/*  As printf("%0*" DW_PR_DUx,width,v): lower case, no 0x. */
+void outbuf_hex(Dwarf_Unsigned v, int width);
+
+/*  As printf("%*" DW_PR_DUu,width,v). */
+void outbuf_udec(Dwarf_Unsigned v, int width);
+
+/*  As printf("%*" DW_PR_DSd,width,v). */
+void outbuf_sdec(Dwarf_Signed v, int width);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* OUTBUF_H */
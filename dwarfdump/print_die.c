@@ -37,6 +37,15 @@
 #include "macrocheck.h"
 #include "helpertree.h"
 #include "tag_common.h"
+#include "outbuf.h"
+#include <limits.h>   /* for INT_MAX */
+#if defined(HAVE_SYS_WAIT_H) && defined(HAVE_UNISTD_H)
+#include <unistd.h>   /* for fork(), dup2() and lseek() */
+#include <signal.h>   /* for kill() */
+#include <sys/wait.h> /* for waitpid() */
+/* -j is supported. */
+#define PARALLEL_INFO_PRINTING 1
+#endif /* HAVE_SYS_WAIT_H && HAVE_UNISTD_H */
 
 /*  Traverse a DIE and attributes to check self references */
 static boolean traverse_one_die(Dwarf_Debug dbg,
@@ -61,6 +70,10 @@ static void print_die_and_children_internal(Dwarf_Debug dbg,
     char **srcfiles, Dwarf_Signed cnt);
 static int print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
     Dwarf_Error *pod_err);
+#ifdef PARALLEL_INFO_PRINTING
+static void save_die_statistics(FILE *f);
+static boolean merge_die_statistics(FILE *f);
+#endif /* PARALLEL_INFO_PRINTING */
 
 /* Is this a PU has been invalidated by the SN Systems linker? */
 #define IsInvalidCode(low,high) ((low == elf_max_address) || (low == 0 && high == 0))
@@ -102,6 +115,30 @@ static void formx_signed(Dwarf_Signed s, struct esb_s *esbp);
 
 static int pd_dwarf_names_print_on_error = 1;
 
+/*  State of a -j worker process.  parallel_worker_count
+    is zero except in a worker, which prints only the
+    compilation units whose index modulo parallel_worker_count
+    is parallel_worker_index.  After each of its CUs the worker
+    writes a record (output end offset, producer, CU name,
+    harmless errors) to parallel_record_file so the parent can
+    merge the outputs and replay the per-CU state in CU order. */
+static int parallel_worker_count = 0;
+static int parallel_worker_index = 0;
+#ifdef PARALLEL_INFO_PRINTING
+static FILE *parallel_record_file = 0;
+#endif /* PARALLEL_INFO_PRINTING */
+static int parallel_cu_index = 0;
+static boolean parallel_cu_pending = FALSE;
+static unsigned parallel_cu_flags = 0;
+static struct esb_s parallel_cu_producer;
+static struct esb_s parallel_cu_name;
+#define PARALLEL_CU_PRODUCER 1
+#define PARALLEL_CU_NAME     2
+#define PARALLEL_CU_DWP      4
+#define PARALLEL_JOBS_MAX    256
+/* dwarfdump.c sets a harmless error list size of 50. */
+#define PARALLEL_HARMLESS_MAX 50
+
 static int die_stack_indent_level = 0;
 static boolean local_symbols_already_began = FALSE;
 
@@ -361,6 +398,433 @@ form_refers_local_info(Dwarf_Half form)
 }
 
 
+static void
+report_die_section_error(Dwarf_Error err,const char *secname)
+{
+    char * errmsg = dwarf_errmsg(err);
+    Dwarf_Unsigned myerr = dwarf_errno(err);
+
+    fprintf(stderr, "%s ERROR:  %s %s:  %s (%lu)\n",
+        program_name, "attempting to print",secname,
+        errmsg, (unsigned long) myerr);
+    fprintf(stderr, "attempting to continue.\n");
+}
+
+static boolean
+this_worker_owns_cu(int cu_index)
+{
+    if (!parallel_worker_count) {
+        return TRUE;
+    }
+    return (cu_index % parallel_worker_count) == parallel_worker_index;
+}
+
+/*  A dwp file turns off checks that only give spurious
+    errors there. */
+static void
+suppress_checks_for_dwp(void)
+{
+    suppress_checking_on_dwp = TRUE;
+    check_ranges = FALSE;
+    check_aranges = FALSE;
+    check_decl_file = FALSE;
+    check_lines = FALSE;
+    check_pubname_attr = FALSE;
+    check_fdes = FALSE;
+}
+
+static void
+parallel_begin_cu(void)
+{
+    if (!parallel_worker_count) {
+        return;
+    }
+    parallel_cu_pending = TRUE;
+    parallel_cu_flags = 0;
+    esb_empty_string(&parallel_cu_producer);
+    esb_empty_string(&parallel_cu_name);
+}
+
+static void
+parallel_note_cu_string(unsigned flag,const char *str)
+{
+    if (!parallel_worker_count) {
+        return;
+    }
+    parallel_cu_flags |= flag;
+    if (flag == PARALLEL_CU_PRODUCER) {
+        esb_empty_string(&parallel_cu_producer);
+        esb_append(&parallel_cu_producer,str);
+    } else if (flag == PARALLEL_CU_NAME) {
+        esb_empty_string(&parallel_cu_name);
+        esb_append(&parallel_cu_name,str? str:"");
+    }
+}
+
+#ifdef PARALLEL_INFO_PRINTING
+/*  Harmless errors are per-dbg, so a worker passes on those
+    noted while doing its CUs and the parent re-inserts them
+    in CU order. Messages that fell off the circular list in
+    the worker are counted with a placeholder text. */
+static void
+save_harmless_errors(Dwarf_Debug dbg,FILE *f)
+{
+    const char *buf[PARALLEL_HARMLESS_MAX+1];
+    unsigned totalcount = 0;
+    unsigned count = 0;
+    unsigned i = 0;
+    int res = dwarf_get_harmless_error_list(dbg,
+        PARALLEL_HARMLESS_MAX+1,buf,&totalcount);
+
+    if (res == DW_DLV_NO_ENTRY) {
+        fprintf(f,"H 0 0\n");
+        return;
+    }
+    for (count = 0; buf[count]; ++count) {
+    }
+    fprintf(f,"H %u %u\n",totalcount,count);
+    for (i = 0; i < count; ++i) {
+        write_counted_string(f,buf[i]);
+    }
+}
+
+static boolean
+replay_harmless_errors(Dwarf_Debug dbg,FILE *f)
+{
+    unsigned totalcount = 0;
+    unsigned count = 0;
+    unsigned i = 0;
+    boolean ok = TRUE;
+    struct esb_s msg;
+
+    if (fscanf(f," H %u %u",&totalcount,&count) != 2 ||
+        fgetc(f) != '\n') {
+        return FALSE;
+    }
+    esb_constructor(&msg);
+    for (i = count; i < totalcount; ++i) {
+        esb_empty_string(&msg);
+        esb_append(&msg,"(harmless error not kept by -j worker)");
+        dwarf_insert_harmless_error(dbg,esb_get_string(&msg));
+    }
+    for (i = 0; i < count; ++i) {
+        if (!read_counted_string(f,&msg)) {
+            ok = FALSE;
+            break;
+        }
+        dwarf_insert_harmless_error(dbg,esb_get_string(&msg));
+    }
+    esb_destructor(&msg);
+    return ok;
+}
+
+/*  Write the record for the CU just finished (or, with
+    rectype 'E', for the end of the section walk). */
+static void
+parallel_write_record(Dwarf_Debug dbg,int rectype)
+{
+    Dwarf_Unsigned endoffset = 0;
+
+    fflush(stdout);
+    endoffset = (Dwarf_Unsigned)lseek(fileno(stdout),0,SEEK_CUR);
+    fprintf(parallel_record_file,"%c %d %" DW_PR_DUu " %u\n",
+        rectype,parallel_cu_index,endoffset,parallel_cu_flags);
+    if (parallel_cu_flags & PARALLEL_CU_PRODUCER) {
+        write_counted_string(parallel_record_file,
+            esb_get_string(&parallel_cu_producer));
+    }
+    if (parallel_cu_flags & PARALLEL_CU_NAME) {
+        write_counted_string(parallel_record_file,
+            esb_get_string(&parallel_cu_name));
+    }
+    save_harmless_errors(dbg,parallel_record_file);
+    parallel_cu_flags = 0;
+}
+
+/*  Runs in the forked worker; never returns. */
+static void
+run_die_section_worker(Dwarf_Debug dbg,int index,int count,
+    FILE *outfile,FILE *recfile)
+{
+    int nres = 0;
+    Dwarf_Error pi_err = 0;
+
+    if (dup2(fileno(outfile),fileno(stdout)) < 0) {
+        _exit(FAILED);
+    }
+    parallel_worker_count = count;
+    parallel_worker_index = index;
+    parallel_record_file = recfile;
+    esb_constructor(&parallel_cu_producer);
+    esb_constructor(&parallel_cu_name);
+
+    nres = print_one_die_section(dbg,TRUE,&pi_err);
+    if (nres == DW_DLV_ERROR &&
+        this_worker_owns_cu(parallel_cu_index)) {
+        report_die_section_error(pi_err,".debug_info");
+    }
+    if (!this_worker_owns_cu(parallel_cu_index)) {
+        /* Its owner reports these. */
+        dwarf_get_harmless_error_list(dbg,0,0,0);
+    }
+    parallel_write_record(dbg,'E');
+    save_check_results(recfile);
+    save_die_statistics(recfile);
+    fflush(stdout);
+    if (fflush(recfile)) {
+        _exit(FAILED);
+    }
+    _exit(0);
+}
+
+/*  Append outfile bytes up to endoffset to our stdout.
+    *copied is how much of outfile was already copied. */
+static void
+copy_worker_output(FILE *outfile,Dwarf_Unsigned *copied,
+    Dwarf_Unsigned endoffset)
+{
+    char buf[8192];
+
+    while (*copied < endoffset) {
+        Dwarf_Unsigned want = endoffset - *copied;
+        size_t got = 0;
+
+        if (want > sizeof(buf)) {
+            want = sizeof(buf);
+        }
+        got = fread(buf,1,(size_t)want,outfile);
+        if (!got) {
+            break;
+        }
+        fwrite(buf,1,got,stdout);
+        *copied += got;
+    }
+}
+
+/*  Read the next record header of a worker, replaying
+    its per-CU state.  Returns the record type
+    ('C' or 'E') or 0 if the record is missing or not for
+    cu_index, which means the worker stopped early. */
+static int
+merge_worker_record(Dwarf_Debug dbg,FILE *recfile,int cu_index,
+    Dwarf_Unsigned *endoffset)
+{
+    char rectype = 0;
+    int index = 0;
+    unsigned flags = 0;
+    struct esb_s str;
+    boolean ok = TRUE;
+
+    if (fscanf(recfile," %c %d %" DW_PR_DUu " %u",
+        &rectype,&index,endoffset,&flags) != 4 ||
+        fgetc(recfile) != '\n') {
+        return 0;
+    }
+    if (index != cu_index || (rectype != 'C' && rectype != 'E')) {
+        return 0;
+    }
+    esb_constructor(&str);
+    if (flags & PARALLEL_CU_PRODUCER) {
+        ok = read_counted_string(recfile,&str);
+        if (ok) {
+            update_compiler_target(esb_get_string(&str));
+        }
+    }
+    if (ok && (flags & PARALLEL_CU_NAME)) {
+        ok = read_counted_string(recfile,&str);
+        if (ok) {
+            add_cu_name_compiler_target(esb_get_string(&str));
+        }
+    }
+    esb_destructor(&str);
+    if (flags & PARALLEL_CU_DWP) {
+        suppress_checks_for_dwp();
+    }
+    if (!ok || !replay_harmless_errors(dbg,recfile)) {
+        return 0;
+    }
+    return rectype;
+}
+
+/*  -j <num>: print (or check) .debug_info with worker
+    processes.  Each worker is a fork() of this process so
+    each has its own copy of the Dwarf_Debug and of all the
+    dwarfdump globals; worker k does CUs k, k+num, k+2*num...
+    writing its output to a temporary file.  The outputs are
+    then copied to stdout in CU order and the check counts
+    summed, giving the same output as a serial run.
+    Returns FALSE (having done nothing) if the work
+    must be done serially.  */
+static boolean
+print_infos_in_parallel(Dwarf_Debug dbg)
+{
+    int count = parallel_jobs;
+    int k = 0;
+    int cu_index = 0;
+    int started = 0;
+    boolean failed = FALSE;
+    pid_t *pids = 0;
+    FILE **outfiles = 0;
+    FILE **recfiles = 0;
+    Dwarf_Unsigned *copied = 0;
+    FILE *prefile = 0;
+
+    /*  Macro import tracking, unique-error tracking
+        and -H span CUs; those stay serial. */
+    if (count < 2 || macro_flag || macinfo_flag ||
+        check_macros || print_unique_errors ||
+        break_after_n_units != INT_MAX) {
+        return FALSE;
+    }
+    if (count > PARALLEL_JOBS_MAX) {
+        count = PARALLEL_JOBS_MAX;
+    }
+    pids = (pid_t *)calloc(count,sizeof(pid_t));
+    outfiles = (FILE **)calloc(count,sizeof(FILE *));
+    recfiles = (FILE **)calloc(count,sizeof(FILE *));
+    copied = (Dwarf_Unsigned *)calloc(count,sizeof(Dwarf_Unsigned));
+    prefile = tmpfile();
+    if (!pids || !outfiles || !recfiles || !copied || !prefile) {
+        failed = TRUE;
+    }
+    for (k = 0; !failed && k < count; ++k) {
+        outfiles[k] = tmpfile();
+        recfiles[k] = tmpfile();
+        if (!outfiles[k] || !recfiles[k]) {
+            failed = TRUE;
+        }
+    }
+    if (!failed) {
+        /*  Workers must not inherit harmless errors already
+            noted, else each would report them again. */
+        save_harmless_errors(dbg,prefile);
+        fflush(stdout);
+        fflush(stderr);
+        for (started = 0; started < count; ++started) {
+            pid_t pid = fork();
+
+            if (pid == 0) {
+                run_die_section_worker(dbg,started,count,
+                    outfiles[started],recfiles[started]);
+            }
+            if (pid < 0) {
+                break;
+            }
+            pids[started] = pid;
+        }
+        rewind(prefile);
+        replay_harmless_errors(dbg,prefile);
+        if (started < count) {
+            /* fork() failed: give up on -j. */
+            for (k = 0; k < started; ++k) {
+                kill(pids[k],SIGKILL);
+                waitpid(pids[k],0,0);
+            }
+            failed = TRUE;
+        }
+    }
+    if (failed) {
+        for (k = 0; outfiles && k < count; ++k) {
+            if (outfiles[k]) {
+                fclose(outfiles[k]);
+            }
+            if (recfiles[k]) {
+                fclose(recfiles[k]);
+            }
+        }
+        if (prefile) {
+            fclose(prefile);
+        }
+        free(pids);
+        free(outfiles);
+        free(recfiles);
+        free(copied);
+        return FALSE;
+    }
+    for (k = 0; k < count; ++k) {
+        int status = 0;
+
+        if (waitpid(pids[k],&status,0) != pids[k] ||
+            !WIFEXITED(status) || WEXITSTATUS(status)) {
+            /*  Its output up to the failure is still
+                printed below, as a serial run would. */
+            failed = TRUE;
+        }
+        rewind(outfiles[k]);
+        rewind(recfiles[k]);
+    }
+
+    /* Merge in CU order. */
+    for (cu_index = 0; ; ++cu_index) {
+        Dwarf_Unsigned endoffset = 0;
+        int rectype = 0;
+
+        k = cu_index % count;
+        rectype = merge_worker_record(dbg,recfiles[k],cu_index,
+            &endoffset);
+        if (!rectype) {
+            /*  The worker stopped (print_error() exit)
+                during this CU. */
+            copy_worker_output(outfiles[k],&copied[k],
+                (Dwarf_Unsigned)-1);
+            failed = TRUE;
+            break;
+        }
+        copy_worker_output(outfiles[k],&copied[k],endoffset);
+        if (rectype == 'E') {
+            break;
+        }
+    }
+    if (!failed) {
+        for (k = 0; k < count; ++k) {
+            Dwarf_Unsigned endoffset = 0;
+
+            if (k != cu_index % count) {
+                if (merge_worker_record(dbg,recfiles[k],cu_index,
+                    &endoffset) != 'E') {
+                    failed = TRUE;
+                    break;
+                }
+                copy_worker_output(outfiles[k],&copied[k],endoffset);
+            }
+            if (!merge_check_results(recfiles[k]) ||
+                !merge_die_statistics(recfiles[k])) {
+                failed = TRUE;
+                break;
+            }
+        }
+    }
+    for (k = 0; k < count; ++k) {
+        fclose(outfiles[k]);
+        fclose(recfiles[k]);
+    }
+    fclose(prefile);
+    free(pids);
+    free(outfiles);
+    free(recfiles);
+    free(copied);
+    if (failed) {
+        fflush(stdout);
+        fprintf(stderr,"%s ERROR:  a -j worker failed printing "
+            ".debug_info\n",program_name);
+        exit(FAILED);
+    }
+    return TRUE;
+}
+#endif /* PARALLEL_INFO_PRINTING */
+
+static void
+parallel_end_cu(UNUSEDARG Dwarf_Debug dbg)
+{
+    if (!parallel_cu_pending) {
+        return;
+    }
+#ifdef PARALLEL_INFO_PRINTING
+    parallel_write_record(dbg,'C');
+#endif /* PARALLEL_INFO_PRINTING */
+    parallel_cu_pending = FALSE;
+}
+
 /* process each compilation unit in .debug_info */
 void
 print_infos(Dwarf_Debug dbg,Dwarf_Bool is_info)
@@ -368,27 +832,20 @@ print_infos(Dwarf_Debug dbg,Dwarf_Bool is_info)
     int nres = 0;
     Dwarf_Error pi_err = 0;
     if (is_info) {
+#ifdef PARALLEL_INFO_PRINTING
+        if (print_infos_in_parallel(dbg)) {
+            return;
+        }
+#endif /* PARALLEL_INFO_PRINTING */
         nres = print_one_die_section(dbg,TRUE,&pi_err);
         if (nres == DW_DLV_ERROR) {
-            char * errmsg = dwarf_errmsg(pi_err);
-            Dwarf_Unsigned myerr = dwarf_errno(pi_err);
-
-            fprintf(stderr, "%s ERROR:  %s:  %s (%lu)\n",
-                program_name, "attempting to print .debug_info",
-                errmsg, (unsigned long) myerr);
-            fprintf(stderr, "attempting to continue.\n");
+            report_die_section_error(pi_err,".debug_info");
         }
         return;
     }
     nres = print_one_die_section(dbg,FALSE,&pi_err);
     if (nres == DW_DLV_ERROR) {
-        char * errmsg = dwarf_errmsg(pi_err);
-        Dwarf_Unsigned myerr = dwarf_errno(pi_err);
-
-        fprintf(stderr, "%s ERROR:  %s:  %s (%lu)\n",
-            program_name, "attempting to print .debug_types",
-            errmsg, (unsigned long) myerr);
-        fprintf(stderr, "attempting to continue.\n");
+        report_die_section_error(pi_err,".debug_types");
     }
 }
 
@@ -644,7 +1101,8 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
             section_name = ".debug_types";
         }
     }
-    if (print_as_info_or_cu() && is_info && do_print_dwarf) {
+    if (print_as_info_or_cu() && is_info && do_print_dwarf &&
+        this_worker_owns_cu(0)) {
         printf("\n%s\n",section_name);
     }
 
@@ -656,6 +1114,8 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
         int fission_data_result = 0;
         Dwarf_Half cu_type = 0;
 
+        parallel_end_cu(dbg);
+        parallel_cu_index = cu_count;
         memset(&fission_data,0,sizeof(fission_data));
         nres = dwarf_next_cu_header_d(dbg,
             is_info,
@@ -678,10 +1138,20 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
             return nres;
         }
         if (cu_count >=  break_after_n_units) {
-            printf("Break at %d\n",cu_count);
+            if (this_worker_owns_cu(cu_count)) {
+                printf("Break at %d\n",cu_count);
+            }
             dieprint_cu_goffset = 0;
             break;
         }
+        if (!this_worker_owns_cu(cu_count)) {
+            /*  Another -j worker does this CU. Drop what
+                reading its header noted, the owner reports it. */
+            dwarf_get_harmless_error_list(dbg,0,0,0);
+            ++cu_count;
+            continue;
+        }
+        parallel_begin_cu();
         /*  Regardless of any options used, get basic
             information about the current CU: producer, name */
         sres = dwarf_siblingof_b(dbg, NULL,is_info, &cu_die, pod_err);
@@ -713,6 +1183,8 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
             get_producer_name(dbg,cu_die,
                 dieprint_cu_goffset,&producername);
             update_compiler_target(esb_get_string(&producername));
+            parallel_note_cu_string(PARALLEL_CU_PRODUCER,
+                esb_get_string(&producername));
             esb_destructor(&producername);
         }
 
@@ -724,6 +1196,7 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
             dieprint_cu_goffset,&cu_short_name,&cu_long_name);
             /* Add CU name to current compiler entry */
             add_cu_name_compiler_target(cu_long_name);
+            parallel_note_cu_string(PARALLEL_CU_NAME,cu_long_name);
         }
 
         /*  If the current compiler is not requested by the
@@ -744,13 +1217,8 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
         if(fission_data_result == DW_DLV_OK) {
             /*  In a .dwp file some checks get all sorts
                 of spurious errors.  */
-            suppress_checking_on_dwp = TRUE;
-            check_ranges = FALSE;
-            check_aranges = FALSE;
-            check_decl_file = FALSE;
-            check_lines = FALSE;
-            check_pubname_attr = FALSE;
-            check_fdes = FALSE;
+            suppress_checks_for_dwp();
+            parallel_cu_flags |= PARALLEL_CU_DWP;
         }
 
         /*  We have not seen the compile unit  yet, reset these
@@ -1311,7 +1779,9 @@ print_one_die(Dwarf_Debug dbg, Dwarf_Die die,
         /* Print just the Tags and Attributes */
         if (!display_offsets) {
             /* Print using indentation */
-            printf("%*s%s\n",die_stack_indent_level * 2 + 2," ",tagname);
+            outbuf_spaces(die_stack_indent_level * 2 + 2);
+            outbuf_puts(tagname);
+            outbuf_putc('\n');
         } else {
             if (dense) {
                 if (show_global_offsets) {
@@ -1334,11 +1804,16 @@ print_one_die(Dwarf_Debug dbg, Dwarf_Die die,
                             (Dwarf_Unsigned)(overall_offset - offset),
                             (Dwarf_Unsigned)offset);
                     } else {
-                        printf("<%d><0x%" DW_PR_DUx ">", die_indent_level,
-                            (Dwarf_Unsigned)offset);
+                        outbuf_putc('<');
+                        outbuf_sdec(die_indent_level,0);
+                        outbuf_puts("><0x");
+                        outbuf_hex((Dwarf_Unsigned)offset,0);
+                        outbuf_putc('>');
                     }
                 }
-                printf("<%s>",tagname);
+                outbuf_putc('<');
+                outbuf_puts(tagname);
+                outbuf_putc('>');
                 if (verbose) {
                     Dwarf_Off agoff = 0;
                     Dwarf_Unsigned acount = 0;
@@ -1370,13 +1845,16 @@ print_one_die(Dwarf_Debug dbg, Dwarf_Die die,
                         die_indent_level, (Dwarf_Unsigned)offset,
                         (Dwarf_Unsigned)overall_offset);
                 } else {
-                    printf("<%2d><0x%" DW_PR_XZEROS DW_PR_DUx ">",
-                        die_indent_level,
-                        (Dwarf_Unsigned)offset);
+                    outbuf_putc('<');
+                    outbuf_sdec(die_indent_level,2);
+                    outbuf_puts("><0x");
+                    outbuf_hex((Dwarf_Unsigned)offset,8);
+                    outbuf_putc('>');
                 }
 
                 /* Print using indentation */
-                printf("%*s%s",die_indent_level * 2 + 2," ",tagname);
+                outbuf_spaces(die_indent_level * 2 + 2);
+                outbuf_puts(tagname);
                 if (verbose) {
                     Dwarf_Off agoff = 0;
                     Dwarf_Unsigned acount = 0;
@@ -1401,7 +1879,7 @@ print_one_die(Dwarf_Debug dbg, Dwarf_Die die,
                     }
                     printf(">");
                 }
-                fputs("\n",stdout);
+                outbuf_putc('\n');
             }
         }
     }
@@ -1451,7 +1929,7 @@ print_one_die(Dwarf_Debug dbg, Dwarf_Die die,
 
             /* Print using indentation */
             if (!dense && PRINTING_DIES && print_information) {
-                printf("%*s",die_indent_level * 2 + 2 + nColumn," ");
+                outbuf_spaces(die_indent_level * 2 + 2 + nColumn);
             }
 
             {
@@ -2940,8 +3418,11 @@ print_attribute(Dwarf_Debug dbg, Dwarf_Die die,
 
                 int res = 0;
                 Dwarf_Addr addr = 0;
-                /* Calculate the real high_pc value */
-                if (offsetDetected && seen_PU_base_address) {
+                /*  Calculate the real high_pc value.
+                    Test bSawLow (this DIE's low_pc), not
+                    seen_PU_base_address, which could be left
+                    over from the last PU of the previous CU. */
+                if (offsetDetected && bSawLow) {
                     addr = lowAddr + highpcOff;
                     res = DW_DLV_OK;
                 } else {
@@ -3378,23 +3859,30 @@ print_attribute(Dwarf_Debug dbg, Dwarf_Die die,
     if ((PRINTING_UNIQUE && PRINTING_DIES && print_information) || bTextFound) {
         /*  Print just the Tags and Attributes */
         if (!display_offsets) {
-            printf("%-28s\n",atname);
+            outbuf_puts_left(atname,28);
+            outbuf_putc('\n');
         } else {
             if (dense) {
-                printf(" %s<%s>", atname, esb_get_string(&valname));
+                outbuf_putc(' ');
+                outbuf_puts(atname);
+                outbuf_putc('<');
+                outbuf_putsn(esb_get_string(&valname),
+                    esb_string_len(&valname));
+                outbuf_putc('>');
                 if (append_extra_string) {
-                    char *v = esb_get_string(&esb_extra);
-                    printf("%s", v);
+                    outbuf_putsn(esb_get_string(&esb_extra),
+                        esb_string_len(&esb_extra));
                 }
             } else {
-                printf("%-28s", atname);
+                outbuf_puts_left(atname,28);
                 if (strlen(atname) >= 28) {
-                    printf(" ");
+                    outbuf_putc(' ');
                 }
-                printf("%s\n", sanitized(esb_get_string(&valname)));
+                outbuf_puts(sanitized(esb_get_string(&valname)));
+                outbuf_putc('\n');
                 if (append_extra_string) {
                     char *v = esb_get_string(&esb_extra);
-                    printf("%s", sanitized(v));
+                    outbuf_puts(sanitized(v));
                 }
             }
         }
@@ -4523,9 +5011,12 @@ check_attributes_encoding(Dwarf_Half attr,Dwarf_Half theform,
     static boolean do_init = TRUE;
 
     if (do_init) {
-        /* Create table on first call */
-        attributes_encoding_table = (a_attr_encoding *)calloc(DW_AT_lo_user,
-            sizeof(a_attr_encoding));
+        /*  Create table on first call, unless merging -j
+            worker results created it already. */
+        if (!attributes_encoding_table) {
+            attributes_encoding_table = (a_attr_encoding *)calloc(
+                DW_AT_lo_user, sizeof(a_attr_encoding));
+        }
         /* We use only 4 slots in the table, for quick access */
         factor[DW_FORM_data1] = 1;  /* index 0x0b */
         factor[DW_FORM_data2] = 2;  /* index 0x05 */
@@ -5628,3 +6119,123 @@ print_tag_attributes_usage(UNUSEDARG Dwarf_Debug dbg)
 
 #endif /* HAVE_USAGE_TAG_ATTR */
 }
+
+#ifdef PARALLEL_INFO_PRINTING
+/*  -j workers pass back the attribute encoding and the
+    tag/attribute usage counts (print_attributes_encoding()
+    and print_tag_attributes_usage() data) for the parent
+    to sum. */
+static void
+save_die_statistics(FILE *f)
+{
+    int index = 0;
+
+    if (attributes_encoding_table) {
+        for (index = 0; index < DW_AT_lo_user; ++index) {
+            a_attr_encoding *e = &attributes_encoding_table[index];
+
+            if (e->entries || e->formx || e->leb128) {
+                fprintf(f,"A %d %" DW_PR_DUu " %" DW_PR_DUu
+                    " %" DW_PR_DUu "\n",
+                    index,e->entries,e->formx,e->leb128);
+            }
+        }
+    }
+#ifdef HAVE_USAGE_TAG_ATTR
+    for (index = 1; index < DW_TAG_last; ++index) {
+        Usage_Tag_Tree *usage_tag_tree_ptr = usage_tag_tree[index];
+        Usage_Tag_Attr *usage_tag_attr_ptr = usage_tag_attr[index];
+        int i = 0;
+
+        if (tag_usage[index]) {
+            fprintf(f,"T %d %u\n",index,tag_usage[index]);
+        }
+        for (i = 0; usage_tag_tree_ptr && usage_tag_tree_ptr[i].tag; ++i) {
+            if (usage_tag_tree_ptr[i].count) {
+                fprintf(f,"t %d %d %u\n",index,i,
+                    usage_tag_tree_ptr[i].count);
+            }
+        }
+        for (i = 0; usage_tag_attr_ptr && usage_tag_attr_ptr[i].attr; ++i) {
+            if (usage_tag_attr_ptr[i].count) {
+                fprintf(f,"a %d %d %u\n",index,i,
+                    usage_tag_attr_ptr[i].count);
+            }
+        }
+    }
+#endif /* HAVE_USAGE_TAG_ATTR */
+    fprintf(f,"Z\n");
+}
+
+static boolean
+merge_die_statistics(FILE *f)
+{
+    for (;;) {
+        char rectype = 0;
+        int index = 0;
+
+        if (fscanf(f," %c",&rectype) != 1) {
+            return FALSE;
+        }
+        if (rectype == 'Z') {
+            return TRUE;
+        }
+        if (fscanf(f,"%d",&index) != 1 || index < 0) {
+            return FALSE;
+        }
+        if (rectype == 'A') {
+            Dwarf_Unsigned entries = 0;
+            Dwarf_Unsigned formx = 0;
+            Dwarf_Unsigned leb128 = 0;
+
+            if (fscanf(f,"%" DW_PR_DUu " %" DW_PR_DUu " %" DW_PR_DUu,
+                &entries,&formx,&leb128) != 3 ||
+                index >= DW_AT_lo_user) {
+                return FALSE;
+            }
+            if (!attributes_encoding_table) {
+                attributes_encoding_table = (a_attr_encoding *)
+                    calloc(DW_AT_lo_user,sizeof(a_attr_encoding));
+                if (!attributes_encoding_table) {
+                    return FALSE;
+                }
+            }
+            attributes_encoding_table[index].entries += entries;
+            attributes_encoding_table[index].formx += formx;
+            attributes_encoding_table[index].leb128 += leb128;
+            continue;
+        }
+#ifdef HAVE_USAGE_TAG_ATTR
+        if (index >= DW_TAG_last) {
+            return FALSE;
+        }
+        if (rectype == 'T') {
+            unsigned count = 0;
+
+            if (fscanf(f,"%u",&count) != 1) {
+                return FALSE;
+            }
+            tag_usage[index] += count;
+            continue;
+        }
+        if (rectype == 't' || rectype == 'a') {
+            int i = 0;
+            unsigned count = 0;
+
+            if (fscanf(f,"%d %u",&i,&count) != 2 || i < 0) {
+                return FALSE;
+            }
+            /*  Same binary, same tables: slot i exists
+                in the parent too. */
+            if (rectype == 't' && usage_tag_tree[index]) {
+                usage_tag_tree[index][i].count += count;
+            } else if (rectype == 'a' && usage_tag_attr[index]) {
+                usage_tag_attr[index][i].count += count;
+            }
+            continue;
+        }
+#endif /* HAVE_USAGE_TAG_ATTR */
+        return FALSE;
+    }
+}
+#endif /* PARALLEL_INFO_PRINTING */
@@ -36,6 +36,7 @@
 
 #include "globals.h"
 #include "print_frames.h"
+#include "outbuf.h"
 #include "dwconf.h"
 #include "esb.h"
 #include "addrmap.h"
@@ -900,8 +901,9 @@ print_one_fde(Dwarf_Debug dbg,
             }
             /* Do not print if in check mode */
             if (!printed_intro_addr && do_print_dwarf) {
-                printf("        0x%" DW_PR_XZEROS DW_PR_DUx
-                    ": ", (Dwarf_Unsigned)jsave);
+                outbuf_puts("        0x");
+                outbuf_hex((Dwarf_Unsigned)jsave,8);
+                outbuf_puts(": ");
                 printed_intro_addr = 1;
             }
             print_one_frame_reg_col(dbg, config_data->cf_cfa_reg,
@@ -965,8 +967,9 @@ print_one_fde(Dwarf_Debug dbg,
 
             /* Do not print if in check mode */
             if (!printed_intro_addr && do_print_dwarf) {
-                printf("        0x%" DW_PR_XZEROS DW_PR_DUx ": ",
-                    (Dwarf_Unsigned)j);
+                outbuf_puts("        0x");
+                outbuf_hex((Dwarf_Unsigned)j,8);
+                outbuf_puts(": ");
                 printed_intro_addr = 1;
             }
             print_one_frame_reg_col(dbg,k,
@@ -978,7 +981,7 @@ print_one_fde(Dwarf_Debug dbg,
                 offset_relevant, offset, block_ptr);
         }
         if (printed_intro_addr) {
-            printf("\n");
+            outbuf_putc('\n');
             printed_intro_addr = 0;
         }
     }
@@ -2084,21 +2087,29 @@ print_one_frame_reg_col(Dwarf_Debug dbg,
         if (reg_used == config_data->cf_initial_rule_value) {
             break;
         }
-        if (print_type_title)
-            printf("<%s ", type_title);
+        if (print_type_title) {
+            outbuf_putc('<');
+            outbuf_puts(type_title);
+            outbuf_putc(' ');
+        }
         printreg(rule_id, config_data);
-        printf("=");
+        outbuf_putc('=');
         if (offset_relevant == 0) {
             printreg(reg_used, config_data);
-            printf(" ");
+            outbuf_putc(' ');
         } else {
-            printf("%02" DW_PR_DSd , offset);
-            printf("(");
+            /* As printf("%02" DW_PR_DSd , offset) */
+            if (offset >= 0 && offset < 10) {
+                outbuf_putc('0');
+            }
+            outbuf_sdec(offset,0);
+            outbuf_putc('(');
             printreg(reg_used, config_data);
-            printf(") ");
+            outbuf_puts(") ");
+        }
+        if (print_type_title) {
+            outbuf_puts("> ");
         }
-        if (print_type_title)
-            printf("%s", "> ");
         break;
     case DW_EXPR_EXPRESSION:
         type_title = "expr";
@@ -30,6 +30,7 @@
 #include "dwconf.h"
 #include "esb.h"
 #include "uri.h"
+#include "outbuf.h"
 #include <ctype.h>
 #include <time.h>
 
@@ -362,16 +363,26 @@ process_line_table(Dwarf_Debug dbg,
         }
         if (do_print_dwarf) {
             if (is_logicals_table || is_actuals_table) {
-                printf("[%4" DW_PR_DUu "]  ", i + 1);
+                outbuf_putc('[');
+                outbuf_udec(i + 1,4);
+                outbuf_puts("]  ");
             }
             /* Check if print of <pc> address is needed. */
             if (line_print_pc) {
-                printf("0x%" DW_PR_XZEROS DW_PR_DUx "  ", pc);
+                outbuf_puts("0x");
+                outbuf_hex(pc,8);
+                outbuf_puts("  ");
             }
             if (is_actuals_table) {
-                printf("[%7" DW_PR_DUu "]", logicalno);
+                outbuf_putc('[');
+                outbuf_udec(logicalno,7);
+                outbuf_putc(']');
             } else {
-                printf("[%4" DW_PR_DUu ",%2" DW_PR_DUu "]", lineno, column);
+                outbuf_putc('[');
+                outbuf_udec(lineno,4);
+                outbuf_putc(',');
+                outbuf_udec(column,2);
+                outbuf_putc(']');
             }
         }
 
@@ -379,7 +390,7 @@ process_line_table(Dwarf_Debug dbg,
             nsres = dwarf_linebeginstatement(line, &newstatement, &lt_err);
             if (nsres == DW_DLV_OK) {
                 if (newstatement && do_print_dwarf) {
-                    printf(" %s","NS");
+                    outbuf_puts(" NS");
                 }
             } else if (nsres == DW_DLV_ERROR) {
                 print_error(dbg, "linebeginstatment failed", nsres, lt_err);
@@ -390,7 +401,7 @@ process_line_table(Dwarf_Debug dbg,
             nsres = dwarf_lineblock(line, &new_basic_block, &lt_err);
             if (nsres == DW_DLV_OK) {
                 if (new_basic_block && do_print_dwarf) {
-                    printf(" %s","BB");
+                    outbuf_puts(" BB");
                 }
             } else if (nsres == DW_DLV_ERROR) {
                 print_error(dbg, "lineblock failed", nsres, lt_err);
@@ -398,7 +409,7 @@ process_line_table(Dwarf_Debug dbg,
             nsres = dwarf_lineendsequence(line, &lineendsequence, &lt_err);
             if (nsres == DW_DLV_OK) {
                 if (lineendsequence && do_print_dwarf) {
-                    printf(" %s", "ET");
+                    outbuf_puts(" ET");
                 }
             } else if (nsres == DW_DLV_ERROR) {
                 print_error(dbg, "lineendsequence failed", nsres, lt_err);
@@ -418,16 +429,18 @@ process_line_table(Dwarf_Debug dbg,
                     disres, lt_err);
             }
             if (prologue_end && !is_actuals_table) {
-                printf(" PE");
+                outbuf_puts(" PE");
             }
             if (epilogue_begin && !is_actuals_table) {
-                printf(" EB");
+                outbuf_puts(" EB");
             }
             if (isa && !is_logicals_table) {
-                printf(" IS=0x%" DW_PR_DUx, isa);
+                outbuf_puts(" IS=0x");
+                outbuf_hex(isa,0);
             }
             if (discriminator && !is_actuals_table) {
-                printf(" DI=0x%" DW_PR_DUx, discriminator);
+                outbuf_puts(" DI=0x");
+                outbuf_hex(discriminator,0);
             }
             if (is_logicals_table) {
                 call_context = 0;
@@ -437,7 +450,8 @@ process_line_table(Dwarf_Debug dbg,
                         disres, lt_err);
                 }
                 if (call_context) {
-                    printf(" CC=%" DW_PR_DUu, call_context);
+                    outbuf_puts(" CC=");
+                    outbuf_udec(call_context,0);
                 }
                 subprog_name = 0;
                 disres = dwarf_line_subprog(line, &subprog_name,
@@ -449,7 +463,9 @@ process_line_table(Dwarf_Debug dbg,
                 if (subprog_name && strlen(subprog_name)) {
                     /*  We do not print an empty name.
                         Clutters things up. */
-                    printf(" SB=\"%s\"", sanitized(subprog_name));
+                    outbuf_puts(" SB=\"");
+                    outbuf_puts(sanitized(subprog_name));
+                    outbuf_putc('"');
                 }
             }
         }
@@ -465,7 +481,8 @@ process_line_table(Dwarf_Debug dbg,
                 translate_to_uri(filename,&urs);
                 esb_append(&urs,"\"");
                 if (do_print_dwarf) {
-                    printf("%s",esb_get_string(&urs));
+                    outbuf_putsn(esb_get_string(&urs),
+                        esb_string_len(&urs));
                 }
                 esb_destructor(&urs);
                 esb_empty_string(&lastsrc);
@@ -477,7 +494,7 @@ process_line_table(Dwarf_Debug dbg,
         }
 
         if (do_print_dwarf) {
-            printf("\n");
+            outbuf_putc('\n');
         }
     }
     esb_destructor(&lastsrc);
@@ -0,0 +1,345 @@
+/*
+  Copyright (c) 2026 David Anderson.  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  * Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  * Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  * Neither the name of the example nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY David Anderson ''AS IS'' AND ANY
+  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL David Anderson BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+/*  decodebench.c
+    Times the libdwarf decoding paths that matter most
+    for reading .debug_info and .debug_line quickly:
+
+        cursor    every DIE of every CU through a
+                  Dwarf_Die_Cursor, with dwarf_die_cursor_attrs()
+                  filling Dwarf_Attr_View records (ns per DIE).
+        tree      every DIE through dwarf_child() and
+                  dwarf_siblingof_b(), the classic walk
+                  (ns per DIE).
+        lines     every line table row through
+                  dwarf_srclines_rows() (ns per row).
+
+    Each figure is the best of several passes over
+    one Dwarf_Debug (-n, default 5), so the first pass,
+    which also builds the abbreviation tables, does not count.
+    The address and offset sizes of the CUs are reported
+    as the decode paths used depend on them.
+
+    To use, try
+        make decodebench
+        ./decodebench -n 10 someobject
+*/
+#include "config.h"
+
+/* Windows specific header files */
+#ifdef HAVE_STDAFX_H
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#include <sys/types.h> /* For open() */
+#include <sys/stat.h>  /* For open() */
+#include <fcntl.h>     /* For open() */
+#include <stdlib.h>     /* For exit() */
+#include <unistd.h>     /* For close() */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>       /* For clock() */
+#include "dwarf.h"
+#include "libdwarf.h"
+
+#define TRUE 1
+#define FALSE 0
+
+#define VIEW_MAX 64
+
+/*  Counts of what one pass saw. */
+struct bench_counts {
+    Dwarf_Unsigned bc_cus;
+    Dwarf_Unsigned bc_dies;
+    Dwarf_Unsigned bc_attrs;
+    Dwarf_Unsigned bc_rows;
+    /*  Bit (1 << size) set for each address size
+        and each offset size seen. */
+    unsigned       bc_address_sizes;
+    unsigned       bc_offset_sizes;
+};
+
+typedef int (*bench_pass)(Dwarf_Debug dbg,struct bench_counts *bc);
+
+static Dwarf_Attr_View views[VIEW_MAX];
+
+static void
+bail(const char *msg,Dwarf_Error err)
+{
+    printf("decodebench: %s failed: %s\n",msg,
+        err?dwarf_errmsg(err):"no entry");
+    exit(1);
+}
+
+/*  Calls func once for each CU die of .debug_info.  */
+static int
+for_each_cu(Dwarf_Debug dbg,struct bench_counts *bc,
+    void (*func)(Dwarf_Debug,Dwarf_Die,struct bench_counts *))
+{
+    Dwarf_Error err = 0;
+
+    for (;;) {
+        Dwarf_Unsigned next_cu_header = 0;
+        Dwarf_Half address_size = 0;
+        Dwarf_Half offset_size = 0;
+        Dwarf_Die cu_die = 0;
+        int res = 0;
+
+        res = dwarf_next_cu_header_d(dbg,TRUE,0,0,0,
+            &address_size,&offset_size,0,0,0,
+            &next_cu_header,0,&err);
+        if (res == DW_DLV_ERROR) {
+            bail("dwarf_next_cu_header_d",err);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            return DW_DLV_OK;
+        }
+        bc->bc_cus++;
+        bc->bc_address_sizes |= 1u << address_size;
+        bc->bc_offset_sizes |= 1u << offset_size;
+        res = dwarf_siblingof_b(dbg,NULL,TRUE,&cu_die,&err);
+        if (res != DW_DLV_OK) {
+            bail("dwarf_siblingof_b",err);
+        }
+        func(dbg,cu_die,bc);
+        dwarf_dealloc(dbg,cu_die,DW_DLA_DIE);
+    }
+}
+
+static void
+cursor_cu(Dwarf_Debug dbg,Dwarf_Die cu_die,struct bench_counts *bc)
+{
+    Dwarf_Die_Cursor cursor = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_die_cursor_open(cu_die,&cursor,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_die_cursor_open",err);
+    }
+    for (;;) {
+        Dwarf_Half tag = 0;
+        Dwarf_Signed depth = 0;
+        Dwarf_Unsigned code = 0;
+        Dwarf_Unsigned count = 0;
+
+        res = dwarf_next_die(cursor,&tag,&depth,&code,&err);
+        if (res == DW_DLV_ERROR) {
+            bail("dwarf_next_die",err);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        res = dwarf_die_cursor_attrs(cursor,views,VIEW_MAX,
+            &count,&err);
+        if (res == DW_DLV_ERROR) {
+            bail("dwarf_die_cursor_attrs",err);
+        }
+        bc->bc_dies++;
+        bc->bc_attrs += count;
+    }
+    dwarf_dealloc(dbg,cursor,DW_DLA_DIE_CURSOR);
+}
+
+static int
+cursor_pass(Dwarf_Debug dbg,struct bench_counts *bc)
+{
+    return for_each_cu(dbg,bc,cursor_cu);
+}
+
+/*  Counts the descendants of parent.  */
+static void
+tree_children(Dwarf_Debug dbg,Dwarf_Die parent,struct bench_counts *bc)
+{
+    Dwarf_Die cur = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_child(parent,&cur,&err);
+    if (res == DW_DLV_ERROR) {
+        bail("dwarf_child",err);
+    }
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+
+        bc->bc_dies++;
+        tree_children(dbg,cur,bc);
+        res = dwarf_siblingof_b(dbg,cur,TRUE,&sib,&err);
+        if (res == DW_DLV_ERROR) {
+            bail("dwarf_siblingof_b",err);
+        }
+        dwarf_dealloc(dbg,cur,DW_DLA_DIE);
+        cur = sib;
+    }
+}
+
+static void
+tree_cu(Dwarf_Debug dbg,Dwarf_Die cu_die,struct bench_counts *bc)
+{
+    bc->bc_dies++;
+    tree_children(dbg,cu_die,bc);
+}
+
+static int
+tree_pass(Dwarf_Debug dbg,struct bench_counts *bc)
+{
+    return for_each_cu(dbg,bc,tree_cu);
+}
+
+static int
+count_row(Dwarf_Line_Context context,Dwarf_Line_Row *row,
+    void *user_data)
+{
+    struct bench_counts *bc = (struct bench_counts *)user_data;
+
+    (void)context;
+    (void)row;
+    bc->bc_rows++;
+    return DW_DLV_OK;
+}
+
+static void
+lines_cu(Dwarf_Debug dbg,Dwarf_Die cu_die,struct bench_counts *bc)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    (void)dbg;
+    res = dwarf_srclines_rows(cu_die,count_row,bc,&err);
+    if (res == DW_DLV_ERROR) {
+        bail("dwarf_srclines_rows",err);
+    }
+}
+
+static int
+lines_pass(Dwarf_Debug dbg,struct bench_counts *bc)
+{
+    return for_each_cu(dbg,bc,lines_cu);
+}
+
+/*  Runs pass passes times and prints the best time
+    per item (DIE or row).  */
+static void
+run_bench(Dwarf_Debug dbg,const char *name,bench_pass pass,
+    int passes,int by_rows)
+{
+    struct bench_counts bc;
+    double best = 0.0;
+    Dwarf_Unsigned items = 0;
+    int i = 0;
+
+    for (i = 0; i < passes; ++i) {
+        clock_t start = 0;
+        double secs = 0.0;
+
+        memset(&bc,0,sizeof(bc));
+        start = clock();
+        pass(dbg,&bc);
+        secs = (double)(clock() - start)/CLOCKS_PER_SEC;
+        if (i == 0 || secs < best) {
+            best = secs;
+        }
+    }
+    items = by_rows? bc.bc_rows:bc.bc_dies;
+    printf("%-7s %10" DW_PR_DUu " %-5s %10.1f ns/%s  %8.3f ms/pass\n",
+        name,items,by_rows?"rows":"dies",
+        items? best*1.0e9/(double)items:0.0,
+        by_rows?"row":"die",best*1.0e3);
+}
+
+static void
+print_sizes(const char *label,unsigned mask)
+{
+    unsigned s = 0;
+
+    printf("%s",label);
+    for (s = 1; s <= 8; ++s) {
+        if (mask & (1u << s)) {
+            printf(" %u",s);
+        }
+    }
+    printf("\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    struct bench_counts bc;
+    const char *filepath = 0;
+    int passes = 5;
+    int fd = -1;
+    int res = 0;
+    int i = 0;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i],"-n") == 0 && i+1 < argc) {
+            passes = atoi(argv[++i]);
+            if (passes < 1) {
+                passes = 1;
+            }
+        } else if (filepath == 0) {
+            filepath = argv[i];
+        } else {
+            filepath = 0;
+            break;
+        }
+    }
+    if (filepath == 0) {
+        printf("Usage: decodebench [-n passes] objectfile\n");
+        exit(1);
+    }
+    fd = open(filepath,O_RDONLY);
+    if (fd < 0) {
+        printf("decodebench: unable to open %s\n",filepath);
+        exit(1);
+    }
+    res = dwarf_init_mmap(fd,DW_DLC_READ,0,0,&dbg,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_init_mmap",res == DW_DLV_ERROR?err:0);
+    }
+
+    /*  The first pass builds the abbreviation tables
+        and CU contexts; it also gets the sizes. */
+    memset(&bc,0,sizeof(bc));
+    tree_pass(dbg,&bc);
+    printf("%s: %" DW_PR_DUu " CUs\n",filepath,bc.bc_cus);
+    print_sizes("address size:",bc.bc_address_sizes);
+    print_sizes("offset size: ",bc.bc_offset_sizes);
+    printf("best of %d passes\n",passes);
+
+    run_bench(dbg,"cursor",cursor_pass,passes,FALSE);
+    run_bench(dbg,"tree",tree_pass,passes,FALSE);
+    run_bench(dbg,"lines",lines_pass,passes,TRUE);
+
+    res = dwarf_finish_mmap(dbg,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_finish_mmap",err);
+    }
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+  Copyright (c) 2026 David Anderson.  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  * Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  * Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  * Neither the name of the example nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY David Anderson ''AS IS'' AND ANY
+  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL David Anderson BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+/*  namelookup.c
+    Looks up each name given with dwarf_name_lookup() and
+    prints, for each DIE found, its tag and DW_AT_decl_line
+    (offsets are left out so the output does not depend on
+    the compiler version).  For a definition whose
+    DW_AT_specification gives the declaration, the line
+    is that of the declaration.
+
+    To use, try
+        make namelookup
+        ./namelookup someobject main ns::get
+
+    'make test' runs it on namescope.cc, built with
+    a .gdb_index, and compares with namescope.base.
+*/
+#include "config.h"
+
+/* Windows specific header files */
+#ifdef HAVE_STDAFX_H
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#include <sys/types.h> /* For open() */
+#include <sys/stat.h>  /* For open() */
+#include <fcntl.h>     /* For open() */
+#include <stdlib.h>     /* For exit() */
+#include <unistd.h>     /* For close() */
+#include <stdio.h>
+#include <string.h>
+#include "dwarf.h"
+#include "libdwarf.h"
+
+#define RESULT_MAX 16
+
+static void
+bail(const char *msg,Dwarf_Error err)
+{
+    printf("namelookup: %s failed: %s\n",msg,
+        err?dwarf_errmsg(err):"no entry");
+    exit(1);
+}
+
+/*  Returns the DW_AT_decl_line of die, zero if none. */
+static Dwarf_Unsigned
+decl_line(Dwarf_Debug dbg,Dwarf_Die die)
+{
+    Dwarf_Attribute attr = 0;
+    Dwarf_Unsigned line = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,DW_AT_decl_line,&attr,&err);
+    if (res == DW_DLV_OK) {
+        res = dwarf_formudata(attr,&line,&err);
+        dwarf_dealloc(dbg,attr,DW_DLA_ATTR);
+    }
+    if (res == DW_DLV_ERROR) {
+        bail("DW_AT_decl_line",err);
+    }
+    return line;
+}
+
+/*  Prints the tag and declaration line of the DIE. */
+static void
+print_die(Dwarf_Debug dbg,Dwarf_Name_Result *result)
+{
+    Dwarf_Die die = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Half tag = 0;
+    Dwarf_Unsigned line = 0;
+    const char *tagname = "<unknown tag>";
+    const char *spec = "";
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    if (!result->nr_die_offset) {
+        printf(" no DIE\n");
+        return;
+    }
+    res = dwarf_offdie_b(dbg,result->nr_die_offset,
+        result->nr_is_info,&die,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_offdie_b",err);
+    }
+    res = dwarf_tag(die,&tag,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_tag",err);
+    }
+    dwarf_get_TAG_name(tag,&tagname);
+    line = decl_line(dbg,die);
+    res = dwarf_attr(die,DW_AT_specification,&attr,&err);
+    if (res == DW_DLV_OK) {
+        Dwarf_Off offset = 0;
+        Dwarf_Die decl = 0;
+
+        res = dwarf_global_formref(attr,&offset,&err);
+        dwarf_dealloc(dbg,attr,DW_DLA_ATTR);
+        if (res == DW_DLV_OK) {
+            res = dwarf_offdie_b(dbg,offset,result->nr_is_info,
+                &decl,&err);
+        }
+        if (res == DW_DLV_OK) {
+            line = decl_line(dbg,decl);
+            spec = " (specification)";
+            dwarf_dealloc(dbg,decl,DW_DLA_DIE);
+        }
+    }
+    if (res == DW_DLV_ERROR) {
+        bail("DW_AT_specification",err);
+    }
+    printf(" %s line %" DW_PR_DUu "%s\n",tagname,line,spec);
+    dwarf_dealloc(dbg,die,DW_DLA_DIE);
+}
+
+int
+main(int argc, char **argv)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Name_Result results[RESULT_MAX];
+    int fd = -1;
+    int res = 0;
+    int i = 0;
+
+    if (argc < 3) {
+        printf("Usage: namelookup objectfile name ...\n");
+        exit(1);
+    }
+    fd = open(argv[1],O_RDONLY);
+    if (fd < 0) {
+        printf("namelookup: unable to open %s\n",argv[1]);
+        exit(1);
+    }
+    res = dwarf_init_mmap(fd,DW_DLC_READ,0,0,&dbg,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_init_mmap",res == DW_DLV_ERROR?err:0);
+    }
+    for (i = 2; i < argc; ++i) {
+        Dwarf_Unsigned count = 0;
+        Dwarf_Unsigned j = 0;
+
+        res = dwarf_name_lookup(dbg,argv[i],results,RESULT_MAX,
+            &count,&err);
+        if (res == DW_DLV_ERROR) {
+            bail("dwarf_name_lookup",err);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            printf("%s: not found\n",argv[i]);
+            continue;
+        }
+        if (count > RESULT_MAX) {
+            count = RESULT_MAX;
+        }
+        for (j = 0; j < count; ++j) {
+            printf("%s: kind %u",argv[i],
+                (unsigned)results[j].nr_kind);
+            print_die(dbg,results+j);
+        }
+    }
+    res = dwarf_finish_mmap(dbg,&err);
+    if (res != DW_DLV_OK) {
+        bail("dwarf_finish_mmap",err);
+    }
+    close(fd);
+    return 0;
+}
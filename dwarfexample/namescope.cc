@@ -0,0 +1,30 @@
+/*  Fixture for 'make test': one name in several scopes.
+    Compiled with g++ and linked by gold with --gdb-index
+    so dwarf_name_lookup() uses the .gdb_index, which
+    records only the unit of each name. */
+struct S {
+    int get;
+};
+namespace ns {
+int get() { return 1; }
+}
+class C {
+public:
+    int get();
+    static int count;
+};
+int C::count = 3;
+int C::get() { return count; }
+enum class E { get, put };
+int get(int x)
+{
+    S s;
+    C c;
+    s.get = x;
+    return s.get + ns::get() + c.get() + (int)E::put;
+}
+int main()
+{
+    int get = ::get(2);
+    return get;
+}
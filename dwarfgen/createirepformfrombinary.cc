@@ -440,14 +440,13 @@ IRFormReference::IRFormReference(IRFormInterface * interface)
     reftype_ = RT_NONE;
     globalOffset_ = 0;
     cuRelativeOffset_ = 0;
-    targetInputDie_= 0;
+    targetInputDie_= IRDIE_NONE;
     target_die_=  0;
     initSig8();
 
     extractInterafaceForms(interface,&finalform,&initialform);
     setFinalForm(finalform);
     setInitialForm(initialform);
-    IRCUdata &cudata = interface->cudata_;
 
     if(finalform == DW_FORM_ref_sig8) {
         Dwarf_Sig8 val8;
@@ -474,6 +473,8 @@ IRFormReference::IRFormReference(IRFormInterface * interface)
     }
     // Otherwise it is (if a correct FORM for a .debug_info reference)
     // a local CU offset, and we record it as such..
+    // The caller records the attribute so the target DIE
+    // is set once the whole CU is read.
     int res = dwarf_formref(interface->attr_,&val, &error);
     if(res != DW_DLV_OK) {
         cerr << "Unable to read reference.. Impossible error. finalform " <<
@@ -481,12 +482,6 @@ IRFormReference::IRFormReference(IRFormInterface * interface)
         exit(1);
     }
     setCUOffset(val);
-    cudata.insertLocalReferenceAttrTargetRef(val,this);
-    IRDie *targdie = cudata.getLocalDie(val);
-    if (targdie) {
-        // Record local offset's IRDie when it is already known.
-        setTargetInDie(targdie);
-    }
 }
 
 // Global static data used to initialized a sig8 reliably.
@@ -311,7 +311,7 @@ get_basic_die_data(Dwarf_Debug dbg,
 
 
 static void
-get_attrs_of_die(Dwarf_Die in_die,IRDie &irdie,
+get_attrs_of_die(Dwarf_Die in_die,IRDieIndex irdie,
     IRCUdata &cudata,
     IRepresentation &irep,
     Dwarf_Debug dbg)
@@ -319,7 +319,6 @@ get_attrs_of_die(Dwarf_Die in_die,IRDie &irdie,
     Dwarf_Error error = 0;
     Dwarf_Attribute *atlist = 0;
     Dwarf_Signed atcnt = 0;
-    std::list<IRAttr> &attrlist = irdie.getAttributes();
     int res = dwarf_attrlist(in_die, &atlist,&atcnt,&error);
     if(res == DW_DLV_NO_ENTRY) {
         return;
@@ -333,21 +332,28 @@ get_attrs_of_die(Dwarf_Die in_die,IRDie &irdie,
         Dwarf_Attribute attr = atlist[i];
         // Use an empty attr to get a placeholder on
         // the attr list for this IRDie.
-        IRAttr irattr;
-        attrlist.push_back(irattr);
-        // We want a pointer to the final attr to be
-        // recorded for references, not a local temp IRAttr.
-        IRAttr & lastirattr = attrlist.back();
+        unsigned attrindex = cudata.getAttrCount();
+        IRAttr & lastirattr = cudata.addAttr(irdie,IRAttr());
         get_basic_attr_data_one_attr(dbg,attr,cudata,lastirattr);
-
+        if (lastirattr.getFormClass() == DW_FORM_CLASS_REFERENCE) {
+            // Record CU-local references so the target
+            // can be set once all the CU DIEs are read.
+            IRFormReference *r = dynamic_cast<IRFormReference *>(
+                lastirattr.getFormData());
+            if (r && r->getReferenceType() ==
+                IRFormReference::RT_CUREL) {
+                cudata.insertLocalReferenceAttrTargetRef(
+                    r->getCUOffset(),attrindex);
+            }
+        }
     }
     dwarf_dealloc(dbg,atlist, DW_DLA_LIST);
 }
 
-// Invariant: IRDie and IRCUdata are in the irep tree,
+// Invariant: IRCUdata is in the irep tree,
 // not local record references to local scopes.
 static void
-get_children_of_die(Dwarf_Die in_die,IRDie&irdie,
+get_children_of_die(Dwarf_Die in_die,IRDieIndex irdie,
     IRCUdata &ircudata,
     IRepresentation &irep,
     Dwarf_Debug dbg)
@@ -363,19 +369,15 @@ get_children_of_die(Dwarf_Die in_die,IRDie&irdie,
         cerr << "dwarf_child failed " << endl;
         exit(1);
     }
-    //std::list<IRDie> & childlist =  irdie.getChildren();
     int childcount = 0;
     for(;;) {
-        IRDie child;
-        get_basic_die_data(dbg,curchilddie,child);
-        irdie.addChild(child);
-        IRDie &lastchild = irdie.lastChild();
-        get_attrs_of_die(curchilddie,lastchild,ircudata,irep,dbg);
-
+        IRDieIndex child = ircudata.addChild(irdie);
+        IRDie &lastchild = ircudata.getDie(child);
+        get_basic_die_data(dbg,curchilddie,lastchild);
         ircudata.insertLocalDieOffset(lastchild.getCURelativeOffset(),
-            &lastchild);
-
-        get_children_of_die(curchilddie,lastchild,ircudata,irep,dbg);
+            child);
+        get_attrs_of_die(curchilddie,child,ircudata,irep,dbg);
+        get_children_of_die(curchilddie,child,ircudata,irep,dbg);
         ++childcount;
 
         Dwarf_Die tchild = 0;
@@ -628,15 +630,15 @@ readCUDataFromBinary(Dwarf_Debug dbg, IRepresentation & irep)
         IRCUdata & treecu = irep.infodata().lastCU();
         IRDie &cuirdie = treecu.baseDie();
         get_basic_die_data(dbg,cu_die,cuirdie);
-        treecu.insertLocalDieOffset(cuirdie.getCURelativeOffset(),
-            &cuirdie);
-        get_attrs_of_die(cu_die,cuirdie,treecu,irep,dbg);
-        get_children_of_die(cu_die,cuirdie,treecu,irep,dbg);
-        get_linedata_of_cu_die(cu_die,cuirdie,treecu,irep,dbg);
+        treecu.insertLocalDieOffset(cuirdie.getCURelativeOffset(),0);
+        get_attrs_of_die(cu_die,0,treecu,irep,dbg);
+        get_children_of_die(cu_die,0,treecu,irep,dbg);
+        // Adding children moved the CU die.
+        get_linedata_of_cu_die(cu_die,treecu.baseDie(),treecu,irep,dbg);
 
         // Now we have all local DIEs in the CU so we
         // can identify all targets of local CLASS_REFERENCE
-        // and insert the IRDie * into the IRFormReference
+        // and insert the IRDieIndex into the IRFormReference
         treecu.updateReferenceAttrDieTargets();
 
         dwarf_dealloc(dbg,cu_die,DW_DLA_DIE);
@@ -0,0 +1,173 @@
+/*
+  Copyright (C) 2026 David Anderson.  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  * Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  * Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  * Neither the name of the example nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY David Anderson ''AS IS'' AND ANY
+  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL David Anderson BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// createirepsynthetic.cc
+
+// Creates, with no input file, a single CU with
+// a large number of DIEs of many different shapes
+// (tag, attributes and forms), so that the producer
+// abbreviation and DIE handling can be timed
+// (dwarfgen -t def).
+
+#include "config.h"
+
+/* Windows specific header files */
+#ifdef HAVE_STDAFX_H
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#include <stdlib.h> // for exit
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <list>
+#include <map>
+#include <vector>
+#include <string.h> // For memcpy etc
+#include "strtabdata.h"
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "irepresentation.h"
+#include "createirepsynthetic.h"
+
+using std::string;
+using std::cerr;
+using std::endl;
+
+static const Dwarf_Half synthTags[] = {
+    DW_TAG_variable,
+    DW_TAG_member,
+    DW_TAG_formal_parameter,
+    DW_TAG_typedef,
+    DW_TAG_base_type,
+    DW_TAG_enumerator,
+    DW_TAG_constant,
+    DW_TAG_label
+};
+static const unsigned synthTagCount =
+    sizeof(synthTags)/sizeof(synthTags[0]);
+
+// Each bit of a shape number above the tag bits
+// selects one of these attributes.
+static const Dwarf_Half synthAttrs[] = {
+    DW_AT_decl_line,
+    DW_AT_decl_column,
+    DW_AT_byte_size,
+    DW_AT_bit_size,
+    DW_AT_bit_offset,
+    DW_AT_decl_file,
+    DW_AT_encoding,
+    DW_AT_const_value,
+    DW_AT_accessibility,
+    DW_AT_start_scope
+};
+static const unsigned synthAttrCount =
+    sizeof(synthAttrs)/sizeof(synthAttrs[0]);
+
+static void
+addStringAttr(IRCUdata &cu,IRDieIndex die,Dwarf_Half attrnum,
+    const string &val)
+{
+    IRAttr &a = cu.addAttr(die,
+        IRAttr(attrnum,DW_FORM_string,DW_FORM_string));
+    a.setFormClass(DW_FORM_CLASS_STRING);
+    IRFormString *f = new IRFormString();
+    f->setFinalForm(DW_FORM_string);
+    f->setInitialForm(DW_FORM_string);
+    f->setString(val.c_str());
+    a.setFormData(f);
+}
+
+// The producer picks DW_FORM_data1/2/4/8 by the value,
+// so the value size is part of the shape.
+static void
+addConstAttr(IRCUdata &cu,IRDieIndex die,Dwarf_Half attrnum,
+    Dwarf_Unsigned val)
+{
+    Dwarf_Half form = DW_FORM_data1;
+    if (val > 0xffff) {
+        form = DW_FORM_data4;
+    } else if (val > 0xff) {
+        form = DW_FORM_data2;
+    }
+    IRAttr &a = cu.addAttr(die,IRAttr(attrnum,form,form));
+    a.setFormClass(DW_FORM_CLASS_CONSTANT);
+    a.setFormData(new IRFormConstant(form,form,
+        DW_FORM_CLASS_CONSTANT,IRFormConstant::UNSIGNED,val,val));
+}
+
+void
+createIrepSynthetic(IRepresentation & irep,
+    unsigned long diecount,
+    unsigned long shapecount)
+{
+    // Tag bits, attribute bits, and one bit for value size.
+    unsigned long maxshapes = synthTagCount << (synthAttrCount+1);
+    if (shapecount == 0 || shapecount > maxshapes) {
+        cerr << "dwarfgen: synthetic shape count must be 1 to " <<
+            maxshapes << endl;
+        exit(EXIT_FAILURE);
+    }
+    std::list<IRCUdata> &culist = irep.infodata().getCUData();
+    IRCUdata cudata(0,/*version*/ 2,/*abbrev_offset*/ 0,
+        /*addr_size*/ 4, /*length_size*/ 4,/*extension_size*/ 0,
+        /*next_cu_header*/ 0);
+    culist.push_back(cudata);
+    IRCUdata & treecu = irep.infodata().lastCU();
+    // Each DIE has a name and up to half the
+    // attributes on average.
+    treecu.reserve(diecount+1,
+        2 + diecount*(1 + synthAttrCount/2));
+    IRDie &cuirdie = treecu.baseDie();
+    cuirdie.setBaseData(DW_TAG_compile_unit,0,0);
+    addStringAttr(treecu,0,DW_AT_name,"synthetic.c");
+    addStringAttr(treecu,0,DW_AT_producer,"dwarfgen -t def");
+
+    for (unsigned long i = 0; i < diecount; ++i) {
+        // Step through the shapes in a scattered order
+        // (7919 is prime) so consecutive DIEs differ,
+        // as in real compiler output.
+        unsigned long shape = (i*7919UL) % shapecount;
+        unsigned long attrbits = shape / synthTagCount;
+        Dwarf_Unsigned valbase = 1;
+        IRDieIndex child = treecu.addChild(0);
+
+        treecu.getDie(child).setBaseData(
+            synthTags[shape % synthTagCount],0,0);
+        if (attrbits & (1UL << synthAttrCount)) {
+            valbase = 300;
+        }
+        std::ostringstream name;
+        name << "v" << i;
+        addStringAttr(treecu,child,DW_AT_name,name.str());
+        for (unsigned k = 0; k < synthAttrCount; ++k) {
+            if (attrbits & (1UL << k)) {
+                addConstAttr(treecu,child,synthAttrs[k],valbase+k);
+            }
+        }
+    }
+}
@@ -73,6 +73,7 @@
 #include <string.h> // For memset etc
 #include <sys/stat.h> //open
 #include <fcntl.h> //open
+#include <time.h> // clock
 #include "general.h"
 #include "dwgetopt.h"
 #include "gelf.h"
@@ -82,6 +83,7 @@
 #include "irepresentation.h"
 #include "ireptodbg.h"
 #include "createirepfrombinary.h"
+#include "createirepsynthetic.h"
 
 using std::string;
 using std::cout;
@@ -90,6 +92,8 @@ using std::endl;
 using std::vector;
 
 static void write_object_file(Dwarf_P_Debug dbg, IRepresentation &irep);
+static void report_stats(IRepresentation &irep,clock_t readtime,
+    clock_t transformtime, clock_t writetime);
 static void write_text_section(Elf * elf);
 static void write_generated_dbg(Dwarf_P_Debug dbg,Elf * elf,
     IRepresentation &irep);
@@ -116,6 +120,8 @@ static strtabdata secstrtab;
 bool transformHighpcToConst = false;
 int  defaultInfoStringForm = DW_FORM_string;
 bool showrelocdetails = false;
+// Set by --stats.
+static bool showstats = false;
 
 // loff_t is signed for some reason (strange) but we make offsets unsigned.
 #define LOFFTODWUNS(x)  ( (Dwarf_Unsigned)(x))
@@ -370,7 +376,12 @@ main(int argc, char **argv)
         int opt;
         bool pathrequired(false);
         long cu_of_input_we_output = -1;
-        while((opt=dwgetopt(argc,argv,"o:t:c:hsr")) != -1) {
+        // For -t def, the synthetic CU size.
+        unsigned long synthdiecount = 100000;
+        unsigned long synthshapecount = 1000;
+        // "-:" lets dwgetopt hand us --word as option '-'
+        // with argument "word".
+        while((opt=dwgetopt(argc,argv,"o:t:c:hsrn:m:-:")) != -1) {
             switch(opt) {
             case 'c':
                 // At present we can only create a single
@@ -380,6 +391,15 @@ main(int argc, char **argv)
             case 'r':
                 showrelocdetails=true;
                 break;
+            case 'n':
+                // Number of DIEs for -t def.
+                synthdiecount = strtoul(dwoptarg,0,0);
+                break;
+            case 'm':
+                // Number of distinct DIE shapes
+                // (so abbreviations) for -t def.
+                synthshapecount = strtoul(dwoptarg,0,0);
+                break;
             case 's':
                 defaultInfoStringForm = DW_FORM_strp;
                 break;
@@ -392,6 +412,13 @@ main(int argc, char **argv)
             case 'o':
                 outfile = dwoptarg;
                 break;
+            case '-':
+                if (!strcmp(dwoptarg,"stats")) {
+                    showstats = true;
+                    break;
+                }
+                cerr << "dwarfgen: Invalid option --" << dwoptarg << endl;
+                exit(1);
             case '?':
                 cerr << "dwarfgen: Invalid quest? option input " << endl;
                 exit(1);
@@ -409,14 +436,18 @@ main(int argc, char **argv)
             infile = argv[dwoptind];
         }
 
+        clock_t readstart = clock();
         if(whichinput == OptReadBin) {
             createIrepFromBinary(infile,Irep);
         } else if (whichinput == OptReadText) {
             cerr << "dwarfgen: dwarfgen: text read not supported yet" << endl;
             exit(EXIT_FAILURE);
         } else if (whichinput == OptPredefined) {
-            cerr << "dwarfgen: predefined not supported yet" << endl;
-            exit(EXIT_FAILURE);
+            // A synthetic CU, for timing the producer.
+            createIrepSynthetic(Irep,synthdiecount,synthshapecount);
+            if (cu_of_input_we_output < 0) {
+                cu_of_input_we_output = 0;
+            }
         } else {
             cerr << "dwarfgen: Impossible: unknown input style." << endl;
             exit(EXIT_FAILURE);
@@ -459,8 +490,22 @@ main(int argc, char **argv)
                 << endl;
             exit(EXIT_FAILURE);
         }
+        clock_t producerstart = clock();
         transform_irep_to_dbg(dbg,Irep,cu_of_input_we_output);
+        clock_t writestart = clock();
         write_object_file(dbg,Irep);
+        clock_t writeend = clock();
+        if (whichinput == OptPredefined) {
+            double secs = (double)(writeend - producerstart)/
+                CLOCKS_PER_SEC;
+            cout << "Synthetic: " << synthdiecount << " DIEs, " <<
+                synthshapecount << " shapes, producer seconds " <<
+                secs << endl;
+        }
+        if (showstats) {
+            report_stats(Irep,producerstart - readstart,
+                writestart - producerstart, writeend - writestart);
+        }
         // Example calls ErrorHandler if there is an error
         // (which does not return, see above)
         // so no need to test for error.
@@ -500,6 +545,44 @@ main(int argc, char **argv)
     exit(1);
 }
 
+// The --stats report: the size of the IR and the processor
+// time of each phase. read is building the IR (from the
+// object or -t def), transform is creating the producer
+// DIEs, attributes and other data from the IR, write is
+// libdwarf creating the section bytes and the Elf output.
+static void
+report_stats(IRepresentation &irep,clock_t readtime,
+    clock_t transformtime, clock_t writetime)
+{
+    std::list<IRCUdata> &culist = irep.infodata().getCUData();
+    size_t cucount = 0;
+    size_t diecount = 0;
+    size_t attrcount = 0;
+    for (std::list<IRCUdata>::iterator it = culist.begin();
+        it != culist.end();
+        ++it,++cucount) {
+        diecount += it->getDieCount();
+        attrcount += it->getAttrCount();
+    }
+    double readsecs = (double)readtime/CLOCKS_PER_SEC;
+    double transformsecs = (double)transformtime/CLOCKS_PER_SEC;
+    double writesecs = (double)writetime/CLOCKS_PER_SEC;
+    double totalsecs = readsecs + transformsecs + writesecs;
+    cout << "Stats: IR " << cucount << " CUs, " << diecount <<
+        " DIEs, " << attrcount << " attributes" << endl;
+    cout << std::fixed << std::setprecision(3);
+    cout << "Stats: read      seconds " << readsecs << endl;
+    cout << "Stats: transform seconds " << transformsecs << endl;
+    cout << "Stats: write     seconds " << writesecs << endl;
+    cout << "Stats: total     seconds " << totalsecs << endl;
+    if (totalsecs > 0) {
+        cout << std::setprecision(0);
+        cout << "Stats: DIEs per second " << diecount/totalsecs << endl;
+    }
+    cout.unsetf(std::ios::floatfield);
+    cout << std::setprecision(6);
+}
+
 static void
 write_object_file(Dwarf_P_Debug dbg, IRepresentation &irep)
 {
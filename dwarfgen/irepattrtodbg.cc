@@ -257,13 +257,13 @@ AddAttrToDie(Dwarf_P_Debug dbg,
             break;
         case IRFormReference::RT_CUREL:
             {
-            IRDie *targetofref = r->getTargetInDie();
+            IRDieIndex targetofref = r->getTargetInDie();
             Dwarf_P_Die targetoutdie = 0;
-            if(targetofref) {
-                targetoutdie = targetofref->getGeneratedDie();
+            if(targetofref != IRDIE_NONE) {
+                targetoutdie = cu.getDie(targetofref).getGeneratedDie();
             }
             if(!targetoutdie) {
-                if(!targetofref) {
+                if(targetofref == IRDIE_NONE) {
                     cerr << "ERROR CLASS REFERENCE targetdie of reference unknown"
                         <<attrnum << endl;
                     break;
@@ -367,13 +367,13 @@ AddAttrToDie(Dwarf_P_Debug dbg,
 void
 IRCUdata::updateClassReferenceTargets()
 {
-    for(std::list<ClassReferenceFixupData>::iterator it =
+    for(std::vector<ClassReferenceFixupData>::iterator it =
         classReferenceFixupList_.begin();
         it != classReferenceFixupList_.end();
         ++it) {
-            IRDie* d = it->target_;
+            IRDie &d = getDie(it->target_);
             Dwarf_P_Die sourcedie = it->sourcedie_;
-            Dwarf_P_Die targetdie = d->getGeneratedDie();
+            Dwarf_P_Die targetdie = d.getGeneratedDie();
             Dwarf_Error error = 0;
             int res = dwarf_fixup_AT_reference_die(it->dbg_,
                 it->attrnum_,sourcedie,targetdie,&error);
@@ -29,6 +29,13 @@
 //
 // irepdie.h
 //
+// The DIEs and attributes of a CU are held in two vectors
+// in its IRCUdata, DIEs in input (preorder) order.
+// A DIE names its parent, children and next sibling by index
+// in the DIE vector, and its attributes are a contiguous
+// run of the attribute vector.  So a large CU costs a few
+// vector growths, not an allocation per DIE and attribute,
+// and a walk of the DIEs is a walk through memory.
 //
 class IRCUdata;
 class IRDie;
@@ -53,6 +60,18 @@ public:
             formdata_ = 0;
         }
     };
+#if __cplusplus >= 201103L
+    // So growing an attribute vector moves the form data
+    // instead of cloning it.
+    IRAttr(IRAttr &&r) noexcept {
+        attr_ = r.attr_;
+        finalform_ = r.finalform_;
+        initialform_ = r.initialform_;
+        formclass_ = r.formclass_;
+        formdata_ = r.formdata_;
+        r.formdata_ = 0;
+    };
+#endif
     ~IRAttr() { delete formdata_; };
     IRAttr & operator=( const IRAttr &r) {
         if(this == &r) {
@@ -62,6 +81,7 @@ public:
         finalform_ = r.finalform_;
         initialform_ = r.initialform_;
         formclass_ = r.formclass_;
+        delete formdata_;
         if(r.formdata_) {
             formdata_ =  r.formdata_->clone();
         } else {
@@ -94,40 +114,16 @@ private:
     IRForm *formdata_;
 };
 
+// Children, siblings and attributes are only added
+// through the IRCUdata owning the DIE.
 class IRDie {
 public:
     IRDie():tag_(0),globalOffset_(0), cuRelativeOffset_(0),
-        generatedDie_(0) {};
+        generatedDie_(0),
+        parent_(IRDIE_NONE),firstChild_(IRDIE_NONE),
+        lastChild_(IRDIE_NONE),nextSibling_(IRDIE_NONE),
+        firstAttr_(0),attrCount_(0) {};
     ~IRDie() {};
-    void addChild(const IRDie & newdie ) {
-        children_.push_back(newdie);
-    };
-    std::string  getName() {
-        std::list<IRAttr>::iterator it = attrs_.begin();
-        for( ; it != attrs_.end() ; ++it) {
-            if (it->getAttrNum() == DW_AT_name) {
-                IRForm *f = it->getFormData();
-                const IRFormString * isv =
-                    dynamic_cast<const IRFormString *>(f);
-                if(isv) {
-                    return isv->getString();
-                }
-            }
-        }
-        return "";
-    };
-    std::list<IRAttr> & getAttributes() {return attrs_; };
-    std::list<IRDie> & getChildren() {return children_; };
-    bool hasNewestChild(IRDie **lastch) { size_t N = children_.size();
-        if(N < 1) {
-            return false;
-        }
-        *lastch = &children_.back();
-        return true;
-    };
-    // lastChild and lastAttr will throw if no entry exists.
-    IRDie &lastChild() { return children_.back(); };
-    IRAttr &lastAttr() { return attrs_.back(); };
     void setBaseData(Dwarf_Half tag,Dwarf_Unsigned goff,
         Dwarf_Unsigned cuoff) {
         tag_ = tag;
@@ -141,12 +137,19 @@ public:
     Dwarf_P_Die getGeneratedDie() const { return generatedDie_;};
     unsigned getTag() {return tag_; }
 
+    // IRDIE_NONE where there is no such DIE.
+    IRDieIndex getParent() const { return parent_; };
+    IRDieIndex getFirstChild() const { return firstChild_; };
+    IRDieIndex getNextSibling() const { return nextSibling_; };
+
+    // The attributes are getFirstAttr() up to (not including)
+    // getFirstAttr()+getAttrCount() in the CU attribute vector.
+    unsigned getFirstAttr() const { return firstAttr_; };
+    unsigned getAttrCount() const { return attrCount_; };
+
 private:
-   // We rely on the IRDie container being one which does not
-   // invalidate pointers with addition/deletion.
-   std::list<IRDie>  children_;
+   friend class IRCUdata;
 
-   std::list<IRAttr> attrs_;
    unsigned tag_;
    // The following are data from input.
    Dwarf_Unsigned globalOffset_;
@@ -154,30 +157,110 @@ private:
 
    // the following is generated during output.
    Dwarf_P_Die generatedDie_;
+
+   IRDieIndex parent_;
+   IRDieIndex firstChild_;
+   IRDieIndex lastChild_;
+   IRDieIndex nextSibling_;
+
+   unsigned firstAttr_;
+   unsigned attrCount_;
 };
 
+// Maps a CU-relative input DIE offset to the IRDieIndex
+// of that DIE. Open addressing with linear probing, the
+// slot count a power of two at least twice the entry count.
+class IRDieOffsetTable {
+public:
+    IRDieOffsetTable():count_(0) {};
+    ~IRDieOffsetTable() {};
+    void insert(Dwarf_Unsigned off,IRDieIndex die) {
+        if (2*(count_+1) > slots_.size()) {
+            grow();
+        }
+        size_t mask = slots_.size()-1;
+        size_t i = slotHash(off) & mask;
+        for (;; i = (i+1) & mask) {
+            Slot &sl = slots_[i];
+            if (sl.die_ == IRDIE_NONE) {
+                sl.off_ = off;
+                sl.die_ = die;
+                ++count_;
+                return;
+            }
+            if (sl.off_ == off) {
+                sl.die_ = die;
+                return;
+            }
+        }
+    };
+    IRDieIndex find(Dwarf_Unsigned off) const {
+        if (!count_) {
+            return IRDIE_NONE;
+        }
+        size_t mask = slots_.size()-1;
+        size_t i = slotHash(off) & mask;
+        for (;; i = (i+1) & mask) {
+            const Slot &sl = slots_[i];
+            if (sl.die_ == IRDIE_NONE) {
+                return IRDIE_NONE;
+            }
+            if (sl.off_ == off) {
+                return sl.die_;
+            }
+        }
+    };
+private:
+    struct Slot {
+        Slot():off_(0),die_(IRDIE_NONE) {};
+        Dwarf_Unsigned off_;
+        IRDieIndex die_;
+    };
+    // Offsets are dense and increasing, Fibonacci hashing
+    // spreads them over the table.
+    static size_t slotHash(Dwarf_Unsigned off) {
+        return static_cast<size_t>(
+            (off * 0x9e3779b97f4a7c15ULL) >> 24);
+    };
+    void grow() {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.resize(old.empty()? 64: 2*old.size());
+        count_ = 0;
+        for (size_t i = 0; i < old.size(); ++i) {
+            if (old[i].die_ != IRDIE_NONE) {
+                insert(old[i].off_,old[i].die_);
+            }
+        }
+    };
+
+    std::vector<Slot> slots_;
+    size_t count_;
+};
 
 struct OffsetFormEntry {
-    OffsetFormEntry(): off_(0),form_(0){};
+    OffsetFormEntry(): off_(0),attr_(0){};
     OffsetFormEntry(Dwarf_Unsigned o,
-        IRFormReference* f): off_(o),form_(f){};
+        unsigned a): off_(o),attr_(a){};
     ~OffsetFormEntry(){};
 
     Dwarf_Unsigned  off_;
-    IRFormReference *form_;
+    // Index in the CU attribute vector of an attribute
+    // with an IRFormReference.
+    unsigned attr_;
 };
 struct ClassReferenceFixupData {
     ClassReferenceFixupData():
         dbg_(0),
         attrnum_(0),
         sourcedie_(0),
-        target_(0) {}
+        target_(IRDIE_NONE) {}
     ~ClassReferenceFixupData(){};
     ClassReferenceFixupData(
         Dwarf_P_Debug dbg,
         Dwarf_Half attrnum,
         Dwarf_P_Die sourcedie,
-        IRDie *d):
+        IRDieIndex d):
         dbg_(dbg),
         attrnum_(attrnum),
         sourcedie_(sourcedie),
@@ -188,7 +271,7 @@ struct ClassReferenceFixupData {
     //  can exist on a given DIE.
     Dwarf_Half attrnum_;
     Dwarf_P_Die sourcedie_;
-    IRDie *target_;
+    IRDieIndex target_;
 };
 
 class IRCUdata {
@@ -206,7 +289,7 @@ public:
         has_linedata_(false),
         linedata_offset_(0),
         cudie_offset_(0)
-        {};
+        { dies_.push_back(IRDie()); };
     IRCUdata(Dwarf_Unsigned len,Dwarf_Half version,
         Dwarf_Unsigned abbrev_offset,
         Dwarf_Half addr_size,
@@ -224,7 +307,7 @@ public:
             macrodata_offset_(0),
             has_linedata_(false),
             linedata_offset_(0),
-            cudie_offset_(0) {};
+            cudie_offset_(0) { dies_.push_back(IRDie()); };
     ~IRCUdata() { };
     bool hasMacroData(Dwarf_Unsigned *offset_out,Dwarf_Unsigned *cudie_off) {
         *offset_out = macrodata_offset_;
@@ -246,46 +329,101 @@ public:
         linedata_offset_ = offset;
         cudie_offset_ = cudieoff;
     };
-    IRDie & baseDie() { return cudie_; };
+    // The CU die is always DIE index 0.
+    // Any IRDie or IRAttr reference is invalidated by adding
+    // a DIE or attribute to the CU. Keep indexes instead.
+    IRDie & baseDie() { return dies_[0]; };
+    IRDie & getDie(IRDieIndex i) { return dies_[i]; };
+    IRAttr & getAttr(unsigned i) { return attrs_[i]; };
+    size_t getDieCount() const { return dies_.size(); };
+    size_t getAttrCount() const { return attrs_.size(); };
+    // Room for this many DIEs and attributes in all.
+    void reserve(size_t diecount,size_t attrcount) {
+        dies_.reserve(diecount);
+        attrs_.reserve(attrcount);
+    };
+    // Adds a DIE as the last child of parent.
+    IRDieIndex addChild(IRDieIndex parent) {
+        IRDieIndex child = static_cast<IRDieIndex>(dies_.size());
+        dies_.push_back(IRDie());
+        dies_[child].parent_ = parent;
+        IRDie &p = dies_[parent];
+        if (p.lastChild_ == IRDIE_NONE) {
+            p.firstChild_ = child;
+        } else {
+            dies_[p.lastChild_].nextSibling_ = child;
+        }
+        p.lastChild_ = child;
+        return child;
+    };
+    // Adds a copy of a as the last attribute of die.
+    // All the attributes of a DIE must be added
+    // before any attribute of another DIE.
+    IRAttr & addAttr(IRDieIndex die,const IRAttr &a) {
+        IRDie &d = dies_[die];
+        if (!d.attrCount_) {
+            d.firstAttr_ = static_cast<unsigned>(attrs_.size());
+        } else if (d.firstAttr_ + d.attrCount_ != attrs_.size()) {
+            std::cerr << "dwarfgen: Attributes of a DIE added "
+                "after those of another DIE." << std::endl;
+            exit(1);
+        }
+        attrs_.push_back(a);
+        ++d.attrCount_;
+        return attrs_.back();
+    };
+    IRCULineData & getCULines() { return cu_lines_; };
     Dwarf_Half getVersionStamp() { return version_stamp_; };
     Dwarf_Half getOffsetSize() { return length_size_; };
     Dwarf_Unsigned getCUdieOffset() { return cudie_offset_; };
-    IRCULineData & getCULines() { return cu_lines_; };
 
-    void insertLocalDieOffset(Dwarf_Unsigned localoff,IRDie* dieptr) {
-        cuOffInLocalToIRDie_[localoff] = dieptr;
+    void insertLocalDieOffset(Dwarf_Unsigned localoff,IRDieIndex die) {
+        cuOffInLocalToIRDie_.insert(localoff,die);
     };
+    // attrindex is the attribute with the IRFormReference.
     void insertLocalReferenceAttrTargetRef(Dwarf_Unsigned localoff,
-        IRFormReference* attrptr) {
+        unsigned attrindex) {
 
         cuOffInLocalToIRFormRef_.push_back(OffsetFormEntry(localoff,
-            attrptr));
+            attrindex));
     };
-    IRDie * getLocalDie(Dwarf_Unsigned localoff) {
-        std::map<Dwarf_Unsigned,IRDie*>::iterator pos;
-        pos = cuOffInLocalToIRDie_.find(localoff);
-        if(pos != cuOffInLocalToIRDie_.end()) {
-            return pos->second;
-        }
-        return NULL;
+    // Returns IRDIE_NONE if no DIE has that CU-relative offset.
+    IRDieIndex getLocalDie(Dwarf_Unsigned localoff) const {
+        return cuOffInLocalToIRDie_.find(localoff);
     };
     void insertClassReferenceFixupData(ClassReferenceFixupData &c) {
         classReferenceFixupList_.push_back(c);
     }
     void updateClassReferenceTargets();
+    std::string  getDieName(IRDieIndex die) {
+        IRDie &d = dies_[die];
+        unsigned end = d.firstAttr_ + d.attrCount_;
+        for(unsigned i = d.firstAttr_; i < end; ++i) {
+            if (attrs_[i].getAttrNum() == DW_AT_name) {
+                IRForm *f = attrs_[i].getFormData();
+                const IRFormString * isv =
+                    dynamic_cast<const IRFormString *>(f);
+                if(isv) {
+                    return isv->getString();
+                }
+            }
+        }
+        return "";
+    };
     std::string  getCUName() {
-        return cudie_.getName();
+        return getDieName(0);
     };
     // Use  cuOffInLocalToIRDie_ and
-    // cuOffInLocalToIRAttr_ to update attr targets.
+    // cuOffInLocalToIRFormRef_ to update attr targets.
     void updateReferenceAttrDieTargets() {
-        for(std::list<OffsetFormEntry>::iterator it =
+        for(std::vector<OffsetFormEntry>::iterator it =
             cuOffInLocalToIRFormRef_.begin();
             it != cuOffInLocalToIRFormRef_.end();
             ++it) {
-            IRFormReference* r = it->form_;
-            IRDie * tdie = getLocalDie(it->off_);
-            if(tdie) {
+            IRFormReference* r = dynamic_cast<IRFormReference *>(
+                attrs_[it->attr_].getFormData());
+            IRDieIndex tdie = getLocalDie(it->off_);
+            if(r && tdie != IRDIE_NONE) {
                 r->setTargetInDie(tdie);
             } else {
                 // Missing die in r
@@ -312,23 +450,25 @@ private:
     // If true, is 32bit dwarf,else 64bit. Gives the size of a reference.
     bool dwarf32bit_;
 
-    IRDie   cudie_;
+    // dies_[0] is the CU die.
+    std::vector<IRDie>  dies_;
+    std::vector<IRAttr> attrs_;
 
     // Refers to cu-local offsets in the input CU and which DIE
     // in the input they target for this CU.
     // Used to find the target DIE for the IRAttrs
-    // referenced by  cuOffInLocalToIRAttr_
-    std::map<Dwarf_Unsigned,IRDie*> cuOffInLocalToIRDie_;
+    // referenced by  cuOffInLocalToIRFormRef_
+    IRDieOffsetTable cuOffInLocalToIRDie_;
 
     // Refers to IRAttrs which make a CU local reference
     // meaning CLASS_REFERENCE IRFormReference to a cu-local die
     // Once Input dies read in this and cuOffInLocalToIRDie_
     // are used to update the IRAttr itself.
-    std::list<OffsetFormEntry> cuOffInLocalToIRFormRef_;
+    std::vector<OffsetFormEntry> cuOffInLocalToIRFormRef_;
 
     // The data needed to get the Dwarf_P_Die  set for
     // some class reference instances.
-    std::list<ClassReferenceFixupData> classReferenceFixupList_;
+    std::vector<ClassReferenceFixupData> classReferenceFixupList_;
 };
 
 class IRDInfo {
@@ -35,6 +35,10 @@ class IRDie;
 class IRAttr;
 class IRFormInterface;
 
+// The index of an IRDie in the DIE vector of its IRCUdata.
+typedef unsigned IRDieIndex;
+const IRDieIndex IRDIE_NONE = ~0U;
+
 // An Abstract class.
 class IRForm {
 public:
@@ -579,7 +583,7 @@ public:
         formclass_(DW_FORM_CLASS_REFERENCE),
         reftype_(RT_NONE),
         globalOffset_(0),cuRelativeOffset_(0),
-        targetInputDie_(0),
+        targetInputDie_(IRDIE_NONE),
         target_die_(0)
         {initSig8();};
     IRFormReference(IRFormInterface *);
@@ -619,6 +623,7 @@ public:
         reftype_ = RT_GLOBAL;};
     void setCUOffset(Dwarf_Off off) { cuRelativeOffset_= off;
         reftype_ = RT_CUREL;};
+    Dwarf_Off getCUOffset() const { return cuRelativeOffset_;};
     void setSignature(Dwarf_Sig8 * sig) { typeSig8_ = *sig;
         reftype_ = RT_SIG;};
     const Dwarf_Sig8 *getSignature() { return &typeSig8_;};
@@ -626,9 +631,9 @@ public:
     enum RefType { RT_NONE,RT_GLOBAL, RT_CUREL,RT_SIG };
     enum RefType getReferenceType() { return reftype_;};
     Dwarf_P_Die getTargetGenDie() { return target_die_;};
-    IRDie * getTargetInDie() { return targetInputDie_;};
+    IRDieIndex getTargetInDie() { return targetInputDie_;};
     void setTargetGenDie(Dwarf_P_Die targ) { target_die_ = targ; };
-    void setTargetInDie(IRDie* targ) { targetInputDie_ = targ; };
+    void setTargetInDie(IRDieIndex targ) { targetInputDie_ = targ; };
 
 private:
     void initSig8();
@@ -650,9 +655,9 @@ private:
     // For RT_SIG we do not need extra data.
     // For RT_CUREL and RT_GLOBAL we do.
 
-    // For RT_CUREL.  Points at the target input DIE
+    // For RT_CUREL.  Indexes the target input DIE
     // after all input DIEs set up for a CU .
-    IRDie * targetInputDie_;
+    IRDieIndex targetInputDie_;
     // FIXME
     Dwarf_P_Die target_die_; //for RT_CUREL, this is known
         // for sure only after all target DIEs generated!
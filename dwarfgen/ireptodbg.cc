@@ -68,14 +68,14 @@ typedef std::map<std::string,unsigned> pathToUnsignedType;
 
 // The first special transformation is converting DW_AT_high_pc
 // from FORM_addr to an offset and we choose FORM_uleb
-// The attrs ref passed in is (sometimes) used to generate
-// a new attrs list for the caller.
+// The attributes of inDie in cu are (sometimes) revised
+// in place for the caller.
 static void
 specialAttrTransformations(Dwarf_P_Debug dbg,
     IRepresentation & Irep,
     Dwarf_P_Die ourdie,
+    IRCUdata &cu,
     IRDie &inDie,
-    list<IRAttr>& attrs,
     unsigned level)
 {
     if(!transformHighpcToConst) {
@@ -90,10 +90,10 @@ specialAttrTransformations(Dwarf_P_Debug dbg,
     bool foundlopc= false;
     Dwarf_Addr lopcval = 0;
     Dwarf_Addr hipcval = 0;
-    for (list<IRAttr>::iterator it = attrs.begin();
-        it != attrs.end();
-        it++) {
-        IRAttr & attr = *it;
+    unsigned firstattr = inDie.getFirstAttr();
+    unsigned endattr = firstattr + inDie.getAttrCount();
+    for (unsigned i = firstattr; i < endattr; ++i) {
+        IRAttr & attr = cu.getAttr(i);
         Dwarf_Half attrnum = attr.getAttrNum();
         Dwarf_Half attrform = attr.getFinalForm();
         Dwarf_Form_Class formclass = attr.getFormClass();
@@ -130,14 +130,9 @@ specialAttrTransformations(Dwarf_P_Debug dbg,
     }
     Dwarf_Addr hipcoffset = hipcval - lopcval;
     // Now we create a revised attribute.
-    list<IRAttr> revisedattrs;
-    for (list<IRAttr>::iterator it = attrs.begin();
-        it != attrs.end();
-        it++) {
-        IRAttr & attr = *it;
+    for (unsigned i = firstattr; i < endattr; ++i) {
+        IRAttr & attr = cu.getAttr(i);
         Dwarf_Half attrnum = attr.getAttrNum();
-        Dwarf_Half attrform = attr.getFinalForm();
-        Dwarf_Form_Class formclass = attr.getFormClass();
         if(attrnum == DW_AT_high_pc) {
             // Here we want to creat a constant form.
             // We will assign a FORM of DW_FORM_uleb
@@ -153,20 +148,11 @@ specialAttrTransformations(Dwarf_P_Debug dbg,
                 hipcoffset,
                 0);
             attr2.setFormData(f);
-            revisedattrs.push_back(attr2);
-            foundhipc = true;
-            continue;
-        }
-        if(attrnum == DW_AT_low_pc) {
-            foundlopc = true;
-            revisedattrs.push_back(attr);
-            continue;
+            // Now we make the attr list have the revised attribute.
+            attr = attr2;
+            break;
         }
-        revisedattrs.push_back(attr);
-        continue;
     }
-    // Now we make the attr list have the revised attribute.
-    attrs = revisedattrs;
 }
 
 
@@ -179,7 +165,6 @@ HandleOneDieAndChildren(Dwarf_P_Debug dbg,
     IRCUdata &cu,
     IRDie    &inDie, unsigned level)
 {
-    list<IRDie>& children = inDie.getChildren();
     // We create our target DIE first so we can link
     // children to it, but add no content yet.
     Dwarf_P_Die ourdie = dwarf_new_die(dbg,inDie.getTag(),NULL,NULL,
@@ -191,10 +176,10 @@ HandleOneDieAndChildren(Dwarf_P_Debug dbg,
     inDie.setGeneratedDie(ourdie);
 
     Dwarf_P_Die lastch = 0;
-    for ( list<IRDie>::iterator it = children.begin();
-        it != children.end();
-        it++) {
-        IRDie & ch = *it;
+    for (IRDieIndex chi = inDie.getFirstChild();
+        chi != IRDIE_NONE;
+        chi = cu.getDie(chi).getNextSibling()) {
+        IRDie & ch = cu.getDie(chi);
         Dwarf_P_Die chp = HandleOneDieAndChildren(dbg,Irep,cu,ch,level+1);
         Dwarf_P_Die res = 0;
         if(lastch) {
@@ -211,17 +196,15 @@ HandleOneDieAndChildren(Dwarf_P_Debug dbg,
         }
         lastch = chp;
     }
-    list<IRAttr>& attrs = inDie.getAttributes();
-
     // Now any special transformations to the attrs list.
-    specialAttrTransformations(dbg,Irep,ourdie,inDie,attrs,level);
+    specialAttrTransformations(dbg,Irep,ourdie,cu,inDie,level);
 
     // Now we add attributes (content), if any, to the
     // output die 'ourdie'.
-    for (list<IRAttr>::iterator it = attrs.begin();
-        it != attrs.end();
-        it++) {
-        IRAttr & attr = *it;
+    unsigned firstattr = inDie.getFirstAttr();
+    unsigned endattr = firstattr + inDie.getAttrCount();
+    for (unsigned i = firstattr; i < endattr; ++i) {
+        IRAttr & attr = cu.getAttr(i);
 
         AddAttrToDie(dbg,Irep,cu,ourdie,inDie,attr);
     }
@@ -498,29 +481,24 @@ transform_macro_info(Dwarf_P_Debug dbg,
     }
 }
 
-// Starting at a Die, look through its children
-// in its input to find which one we have by
-// comparing the input-die global offset.
+// Find the generated DIE for the input DIE at
+// the input-die global offset, if that DIE is in cu,
+// with the CU offset table.
 static
-Dwarf_P_Die findTargetDieByOffset(IRDie& indie,
+Dwarf_P_Die findTargetDieByOffset(IRCUdata &cu,
    Dwarf_Unsigned targetglobaloff)
 {
-    Dwarf_Unsigned globoff = indie.getGlobalOffset();
-    if(globoff == targetglobaloff) {
-        return indie.getGeneratedDie();
+    IRDie &basedie = cu.baseDie();
+    Dwarf_Unsigned cubase = basedie.getGlobalOffset() -
+        basedie.getCURelativeOffset();
+    if(targetglobaloff < cubase) {
+        return NULL;
     }
-    std::list<IRDie> dielist =  indie.getChildren();
-    for ( list<IRDie>::iterator it = dielist.begin();
-        it != dielist.end();
-        it++) {
-        IRDie &ldie = *it;
-        Dwarf_P_Die foundDie = findTargetDieByOffset(ldie,
-            targetglobaloff);
-        if(foundDie) {
-            return foundDie;
-        }
+    IRDieIndex found = cu.getLocalDie(targetglobaloff - cubase);
+    if(found == IRDIE_NONE) {
+        return NULL;
     }
-    return NULL;
+    return cu.getDie(found).getGeneratedDie();
 }
 
 // If the pubnames/pubtypes entry is in the
@@ -550,7 +528,7 @@ transform_debug_pubnames_types_inner(Dwarf_P_Debug dbg,
             if (pubcuoff != targetcuoff) {
                 continue;
             }
-            Dwarf_P_Die targdie = findTargetDieByOffset(basedie,
+            Dwarf_P_Die targdie = findTargetDieByOffset(cu,
                 ourdieoff);
             if(targdie) {
                 // Ugly. Old mistake in libdwarf declaration.
@@ -583,7 +561,7 @@ transform_debug_pubnames_types_inner(Dwarf_P_Debug dbg,
             if (pubcuoff != targetcuoff) {
                 continue;
             }
-            Dwarf_P_Die targdie = findTargetDieByOffset(basedie,
+            Dwarf_P_Die targdie = findTargetDieByOffset(cu,
                 ourdieoff);
             if(targdie) {
                 // Ugly. Old mistake in libdwarf declaration.
@@ -0,0 +1,624 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    Address to CU lookup.
+    dwarf_get_arange() looks through the (unsorted)
+    .debug_aranges entries one by one for each address.
+    Here the entries, plus the CU DIE address ranges of
+    any CU that .debug_aranges leaves out (or of every
+    CU if there is no .debug_aranges), are made once into
+    a sorted array of disjoint ranges (see dwarf_addr_cu.h)
+    so a lookup is a binary search and a batch of
+    pc values sorted in increasing order is a single
+    forward walk over the array.  */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include "dwarf_arange.h"
+#include "dwarf_addr_cu.h"
+#include "dwarf_concurrent.h"
+
+#define FALSE 0
+#define TRUE 1
+
+/*  Starting sizes of the growable arrays. */
+#define ADDR_CU_RANGES_START  256
+#define ADDR_CU_OFFSETS_START 64
+
+/*  An address range as read, before sorting and
+    merging. cr_order is the order read, to keep the
+    sort stable. */
+struct addr_cu_range_s {
+    Dwarf_Addr     cr_lowpc;
+    Dwarf_Addr     cr_highpc;
+    Dwarf_Off      cr_cu_die_offset;
+    Dwarf_Off      cr_cu_header_offset;
+    Dwarf_Unsigned cr_order;
+};
+
+struct addr_cu_build_s {
+    struct addr_cu_range_s *ab_ranges;
+    Dwarf_Unsigned          ab_range_count;
+    Dwarf_Unsigned          ab_range_size;
+
+    /*  The CU header offsets .debug_aranges covers,
+        sorted once the aranges are all read. */
+    Dwarf_Off              *ab_covered;
+    Dwarf_Unsigned          ab_covered_count;
+    Dwarf_Unsigned          ab_covered_size;
+};
+
+/*  Doubles *size (starting at start_size)
+    and reallocs *array to match. */
+static int
+grow_array(void **array,Dwarf_Unsigned *size,
+    Dwarf_Unsigned start_size, size_t entry_size)
+{
+    Dwarf_Unsigned newsize = *size? *size*2: start_size;
+    void *newarray = realloc(*array,newsize*entry_size);
+
+    if (!newarray) {
+        return DW_DLV_ERROR;
+    }
+    *array = newarray;
+    *size = newsize;
+    return DW_DLV_OK;
+}
+
+/*  Records [lowpc,highpc), ignoring an empty range. */
+static int
+add_range(struct addr_cu_build_s *build,
+    Dwarf_Addr lowpc,
+    Dwarf_Addr highpc,
+    Dwarf_Off cu_die_offset,
+    Dwarf_Off cu_header_offset)
+{
+    struct addr_cu_range_s *r = 0;
+
+    if (highpc <= lowpc) {
+        return DW_DLV_OK;
+    }
+    if (build->ab_range_count >= build->ab_range_size) {
+        if (grow_array((void **)&build->ab_ranges,&build->ab_range_size,
+            ADDR_CU_RANGES_START,
+            sizeof(struct addr_cu_range_s)) != DW_DLV_OK) {
+            return DW_DLV_ERROR;
+        }
+    }
+    r = build->ab_ranges + build->ab_range_count;
+    r->cr_lowpc = lowpc;
+    r->cr_highpc = highpc;
+    r->cr_cu_die_offset = cu_die_offset;
+    r->cr_cu_header_offset = cu_header_offset;
+    r->cr_order = build->ab_range_count;
+    build->ab_range_count++;
+    return DW_DLV_OK;
+}
+
+static int
+add_covered(struct addr_cu_build_s *build,
+    Dwarf_Off cu_header_offset)
+{
+    if (build->ab_covered_count >= build->ab_covered_size) {
+        if (grow_array((void **)&build->ab_covered,
+            &build->ab_covered_size,
+            ADDR_CU_OFFSETS_START,sizeof(Dwarf_Off)) != DW_DLV_OK) {
+            return DW_DLV_ERROR;
+        }
+    }
+    build->ab_covered[build->ab_covered_count] = cu_header_offset;
+    build->ab_covered_count++;
+    return DW_DLV_OK;
+}
+
+static int
+offset_compare(const void *l, const void *r)
+{
+    Dwarf_Off lo = *(const Dwarf_Off *)l;
+    Dwarf_Off ro = *(const Dwarf_Off *)r;
+
+    if (lo < ro) {
+        return -1;
+    }
+    if (lo > ro) {
+        return 1;
+    }
+    return 0;
+}
+
+static Dwarf_Bool
+is_covered(struct addr_cu_build_s *build,
+    Dwarf_Off cu_header_offset)
+{
+    if (!build->ab_covered_count) {
+        return FALSE;
+    }
+    return bsearch(&cu_header_offset,build->ab_covered,
+        build->ab_covered_count,sizeof(Dwarf_Off),
+        offset_compare) != 0;
+}
+
+/*  Reads the .debug_aranges entries.
+    If there is no .debug_aranges, or it cannot be read,
+    nothing is covered and every CU is looked at.  */
+static int
+add_aranges(Dwarf_Debug dbg,
+    struct addr_cu_build_s *build)
+{
+    Dwarf_Arange *aranges = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Off last_header_offset = 0;
+    Dwarf_Off cu_die_offset = 0;
+    Dwarf_Bool have_cu = FALSE;
+    Dwarf_Bool cu_ok = FALSE;
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    res = dwarf_get_aranges(dbg,&aranges,&count,&lerr);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        }
+        return DW_DLV_OK;
+    }
+    res = DW_DLV_OK;
+    for (i = 0; i < count; ++i) {
+        Dwarf_Arange ar = aranges[i];
+        Dwarf_Addr highpc = 0;
+
+        if (res == DW_DLV_OK &&
+            (!have_cu || ar->ar_info_offset != last_header_offset)) {
+            have_cu = TRUE;
+            last_header_offset = ar->ar_info_offset;
+            cu_ok = FALSE;
+            if (dwarf_get_cu_die_offset(ar,&cu_die_offset,&lerr) ==
+                DW_DLV_OK) {
+                cu_ok = TRUE;
+                res = add_covered(build,last_header_offset);
+            } else {
+                dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+                lerr = 0;
+            }
+        }
+        if (res == DW_DLV_OK && cu_ok) {
+            highpc = ar->ar_address + ar->ar_length;
+            if (highpc < ar->ar_address) {
+                /* Wrapped around. */
+                highpc = ~(Dwarf_Addr)0;
+            }
+            res = add_range(build,ar->ar_address,highpc,
+                cu_die_offset,last_header_offset);
+        }
+        dwarf_dealloc(dbg,ar,DW_DLA_ARANGE);
+    }
+    dwarf_dealloc(dbg,aranges,DW_DLA_LIST);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    qsort(build->ab_covered,build->ab_covered_count,sizeof(Dwarf_Off),
+        offset_compare);
+    return DW_DLV_OK;
+}
+
+/*  Adds the address ranges of one CU DIE:
+    its DW_AT_ranges list if it has one, else its
+    DW_AT_low_pc and DW_AT_high_pc.  A CU without
+    usable attributes just adds nothing.  */
+static int
+add_cu_die_ranges(Dwarf_Debug dbg,
+    struct addr_cu_build_s *build,
+    Dwarf_Die cu_die,
+    Dwarf_Off cu_header_offset)
+{
+    Dwarf_Off cu_die_offset = 0;
+    Dwarf_Addr lowpc = 0;
+    Dwarf_Bool have_lowpc = FALSE;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    if (dwarf_dieoffset(cu_die,&cu_die_offset,&lerr) != DW_DLV_OK) {
+        dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        return DW_DLV_OK;
+    }
+    res = dwarf_lowpc(cu_die,&lowpc,&lerr);
+    if (res == DW_DLV_OK) {
+        have_lowpc = TRUE;
+    } else if (res == DW_DLV_ERROR) {
+        dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        lerr = 0;
+    }
+
+    res = dwarf_attr(cu_die,DW_AT_ranges,&attr,&lerr);
+    if (res == DW_DLV_OK) {
+        Dwarf_Off ranges_offset = 0;
+        Dwarf_Ranges *ranges = 0;
+        Dwarf_Signed range_count = 0;
+        Dwarf_Unsigned bytecount = 0;
+        /*  Range list entries are relative to the
+            CU base address, the CU low pc. */
+        Dwarf_Addr base = lowpc;
+        Dwarf_Signed i = 0;
+
+        res = dwarf_global_formref(attr,&ranges_offset,&lerr);
+        dwarf_dealloc(dbg,attr,DW_DLA_ATTR);
+        if (res == DW_DLV_OK) {
+            res = dwarf_get_ranges_a(dbg,ranges_offset,cu_die,
+                &ranges,&range_count,&bytecount,&lerr);
+        }
+        if (res != DW_DLV_OK) {
+            if (res == DW_DLV_ERROR) {
+                dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+            }
+            return DW_DLV_OK;
+        }
+        res = DW_DLV_OK;
+        for (i = 0; i < range_count && res == DW_DLV_OK; ++i) {
+            Dwarf_Ranges *r = ranges+i;
+
+            if (r->dwr_type == DW_RANGES_END) {
+                break;
+            }
+            if (r->dwr_type == DW_RANGES_ADDRESS_SELECTION) {
+                base = r->dwr_addr2;
+                continue;
+            }
+            res = add_range(build,base + r->dwr_addr1,
+                base + r->dwr_addr2,cu_die_offset,cu_header_offset);
+        }
+        dwarf_ranges_dealloc(dbg,ranges,range_count);
+        return res;
+    }
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        lerr = 0;
+    }
+    if (have_lowpc) {
+        Dwarf_Addr highpc = 0;
+        Dwarf_Half form = 0;
+        enum Dwarf_Form_Class formclass = DW_FORM_CLASS_UNKNOWN;
+
+        res = dwarf_highpc_b(cu_die,&highpc,&form,&formclass,&lerr);
+        if (res == DW_DLV_OK) {
+            if (formclass == DW_FORM_CLASS_CONSTANT) {
+                /* DWARF4: high pc is the length. */
+                highpc += lowpc;
+            }
+            return add_range(build,lowpc,highpc,cu_die_offset,
+                cu_header_offset);
+        }
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        }
+    }
+    return DW_DLV_OK;
+}
+
+/*  Adds the CU DIE ranges of every CU of .debug_info
+    not covered by .debug_aranges.
+    The position used by dwarf_next_cu_header_d() is saved
+    and restored so building the map at any time does not
+    disturb a caller part way through its own walk
+    of the CUs. */
+static int
+add_uncovered_cus(Dwarf_Debug dbg,
+    struct addr_cu_build_s *build,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug_InfoTypes dis = &dbg->de_info_reading;
+    Dwarf_CU_Context saved_context = dis->de_cu_context;
+    Dwarf_Byte_Ptr saved_last_di_ptr = dis->de_last_di_ptr;
+    Dwarf_Die saved_last_die = dis->de_last_die;
+    Dwarf_Unsigned cu_header_offset = 0;
+    int res = DW_DLV_OK;
+
+    dis->de_cu_context = 0;
+    for (;;) {
+        Dwarf_Unsigned next_cu_offset = 0;
+        Dwarf_Die cu_die = 0;
+        Dwarf_Off this_cu = cu_header_offset;
+
+        res = dwarf_next_cu_header_d(dbg,TRUE,0,0,0,0,0,0,0,0,
+            &next_cu_offset,0,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        cu_header_offset = next_cu_offset;
+        if (is_covered(build,this_cu)) {
+            continue;
+        }
+        res = dwarf_siblingof_b(dbg,NULL,TRUE,&cu_die,error);
+        if (res == DW_DLV_ERROR) {
+            break;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            continue;
+        }
+        res = add_cu_die_ranges(dbg,build,cu_die,this_cu);
+        dwarf_dealloc(dbg,cu_die,DW_DLA_DIE);
+        if (res == DW_DLV_ERROR) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            break;
+        }
+    }
+    dis->de_cu_context = saved_context;
+    dis->de_last_di_ptr = saved_last_di_ptr;
+    dis->de_last_die = saved_last_die;
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+range_compare(const void *l, const void *r)
+{
+    const struct addr_cu_range_s *lp = l;
+    const struct addr_cu_range_s *rp = r;
+
+    if (lp->cr_lowpc < rp->cr_lowpc) {
+        return -1;
+    }
+    if (lp->cr_lowpc > rp->cr_lowpc) {
+        return 1;
+    }
+    if (lp->cr_order < rp->cr_order) {
+        return -1;
+    }
+    if (lp->cr_order > rp->cr_order) {
+        return 1;
+    }
+    return 0;
+}
+
+/*  Sorts the ranges and makes them into the map
+    entries: each range contributes only the part of it
+    above every range sorted before it, and such parts
+    that touch and belong to the same CU are merged.
+    The entries array is never larger than the ranges
+    array, so it is made in place.  */
+static void
+make_entries(struct addr_cu_build_s *build,
+    struct Dwarf_Addr_CU_Map_s *map)
+{
+    struct addr_cu_range_s *ranges = build->ab_ranges;
+    struct Dwarf_Addr_CU_Entry_s *entries =
+        (struct Dwarf_Addr_CU_Entry_s *)build->ab_ranges;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Addr covered = 0;
+    Dwarf_Unsigned i = 0;
+
+    qsort(ranges,build->ab_range_count,
+        sizeof(struct addr_cu_range_s),range_compare);
+    for (i = 0; i < build->ab_range_count; ++i) {
+        struct addr_cu_range_s r = ranges[i];
+        struct Dwarf_Addr_CU_Entry_s *last = count?
+            entries+count-1: 0;
+
+        if (count && r.cr_lowpc < covered) {
+            if (r.cr_highpc <= covered) {
+                continue;
+            }
+            r.cr_lowpc = covered;
+        }
+        covered = r.cr_highpc;
+        if (last && last->ae_highpc == r.cr_lowpc &&
+            last->ae_cu_header_offset == r.cr_cu_header_offset) {
+            last->ae_highpc = r.cr_highpc;
+            continue;
+        }
+        /*  entries+count does not overlap ranges+i
+            (or any later range) as an entry is
+            smaller than a range. */
+        entries[count].ae_lowpc = r.cr_lowpc;
+        entries[count].ae_highpc = r.cr_highpc;
+        entries[count].ae_cu_die_offset = r.cr_cu_die_offset;
+        entries[count].ae_cu_header_offset = r.cr_cu_header_offset;
+        count++;
+    }
+    map->am_entries = entries;
+    map->am_entry_count = count;
+    build->ab_ranges = 0;
+    if (count) {
+        /* Give back the unused space. */
+        void *smaller = realloc(entries,
+            count*sizeof(struct Dwarf_Addr_CU_Entry_s));
+
+        if (smaller) {
+            map->am_entries = smaller;
+        }
+    } else {
+        free(entries);
+        map->am_entries = 0;
+    }
+}
+
+static int
+map_build(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    struct addr_cu_build_s build;
+    struct Dwarf_Addr_CU_Map_s *map = 0;
+    int res = 0;
+
+    if (dbg->de_addr_cu_map) {
+        return DW_DLV_OK;
+    }
+    memset(&build,0,sizeof(build));
+    res = add_aranges(dbg,&build);
+    if (res == DW_DLV_OK) {
+        res = add_uncovered_cus(dbg,&build,error);
+    } else {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+    }
+    free(build.ab_covered);
+    if (res == DW_DLV_OK) {
+        map = (struct Dwarf_Addr_CU_Map_s *)
+            calloc(1,sizeof(struct Dwarf_Addr_CU_Map_s));
+        if (!map) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            res = DW_DLV_ERROR;
+        }
+    }
+    if (res != DW_DLV_OK) {
+        free(build.ab_ranges);
+        return res;
+    }
+    make_entries(&build,map);
+    dbg->de_addr_cu_map = map;
+    return DW_DLV_OK;
+}
+
+/*  Builds the address-to-CU map of dbg if it
+    has not been built yet. */
+int
+dwarf_addr_cu_map_build(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    int res = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    DWARF_BUILD_LOCK(dbg);
+    res = map_build(dbg,error);
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
+
+/*  Frees the map, dwarf_finish() calls this. */
+void
+_dwarf_addr_cu_map_destroy(Dwarf_Debug dbg)
+{
+    struct Dwarf_Addr_CU_Map_s *map = dbg->de_addr_cu_map;
+
+    if (map) {
+        free(map->am_entries);
+        free(map);
+        dbg->de_addr_cu_map = 0;
+    }
+}
+
+void
+dwarf_addr_cu_map_free(Dwarf_Debug dbg)
+{
+    if (dbg) {
+        _dwarf_addr_cu_map_destroy(dbg);
+    }
+}
+
+/*  Returns the index of the last entry in
+    [start,count) whose low pc is <= pc,
+    given that entry start qualifies.
+    The step doubles until it overshoots and then halves,
+    so moving a short distance forward (the usual case
+    with a sorted batch) costs only a few compares
+    and a long way costs O(log n).  */
+static Dwarf_Unsigned
+advance_entry(struct Dwarf_Addr_CU_Entry_s *entries,
+    Dwarf_Unsigned start,
+    Dwarf_Unsigned count,
+    Dwarf_Addr pc)
+{
+    Dwarf_Unsigned pos = start;
+    Dwarf_Unsigned step = 1;
+
+    while (pos+step < count && entries[pos+step].ae_lowpc <= pc) {
+        pos += step;
+        step *= 2;
+    }
+    while (step > 1) {
+        step /= 2;
+        if (pos+step < count && entries[pos+step].ae_lowpc <= pc) {
+            pos += step;
+        }
+    }
+    return pos;
+}
+
+/*  Looks up pc_count pc values, filling in results[i]
+    for pcs[i]. When pcs is sorted in increasing order
+    the whole batch is one forward walk over the map;
+    an unsorted pcs works but restarts the walk at
+    each decrease.  */
+int
+dwarf_addr_cu_lookup(Dwarf_Debug dbg,
+    Dwarf_Unsigned pc_count,
+    Dwarf_Addr *pcs,
+    Dwarf_Addr_CU *results,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Addr_CU_Entry_s *entries = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned cur = 0;
+    Dwarf_Addr prev_pc = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    res = dwarf_addr_cu_map_build(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    entries = dbg->de_addr_cu_map->am_entries;
+    count = dbg->de_addr_cu_map->am_entry_count;
+    for (i = 0; i < pc_count; ++i) {
+        Dwarf_Addr pc = pcs[i];
+        Dwarf_Addr_CU *result = results+i;
+        struct Dwarf_Addr_CU_Entry_s *e = 0;
+
+        memset(result,0,sizeof(*result));
+        if (!count || pc < entries[0].ae_lowpc) {
+            prev_pc = pc;
+            continue;
+        }
+        if (i == 0 || pc < prev_pc) {
+            cur = 0;
+        }
+        cur = advance_entry(entries,cur,count,pc);
+        prev_pc = pc;
+        e = entries+cur;
+        if (pc >= e->ae_highpc) {
+            continue;
+        }
+        result->ac_found = TRUE;
+        result->ac_lowpc = e->ae_lowpc;
+        result->ac_highpc = e->ae_highpc;
+        result->ac_cu_die_offset = e->ae_cu_die_offset;
+        result->ac_cu_header_offset = e->ae_cu_header_offset;
+    }
+    return DW_DLV_OK;
+}
@@ -0,0 +1,52 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  The address-to-CU map of a Dwarf_Debug, built once
+    by dwarf_addr_cu_map_build() from .debug_aranges
+    and, for CUs .debug_aranges does not mention,
+    from the CU DIE DW_AT_low_pc/DW_AT_high_pc or
+    DW_AT_ranges.
+
+    The entries are sorted by address and do not
+    overlap (where the inputs overlap the one starting
+    lower, or if they start together the first read,
+    keeps the overlapped addresses). Adjacent entries
+    of the same CU are merged into one.
+*/
+struct Dwarf_Addr_CU_Entry_s {
+    Dwarf_Addr     ae_lowpc;
+    /*  One past the last address. */
+    Dwarf_Addr     ae_highpc;
+    /*  Global offsets of the CU DIE and CU header. */
+    Dwarf_Off      ae_cu_die_offset;
+    Dwarf_Off      ae_cu_header_offset;
+};
+
+struct Dwarf_Addr_CU_Map_s {
+    struct Dwarf_Addr_CU_Entry_s *am_entries;
+    Dwarf_Unsigned                am_entry_count;
+};
+
+void _dwarf_addr_cu_map_destroy(Dwarf_Debug dbg);
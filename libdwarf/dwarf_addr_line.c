@@ -0,0 +1,749 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    Address to source line lookup.
+    The line tables of all the CUs are read once into
+    a compact index of sequences sorted by address
+    (see dwarf_addr_line.h) and then any number of
+    pc values can be looked up with
+    dwarf_addr_line_lookup(). A batch of pc values
+    sorted in increasing order is resolved in a single
+    forward walk over the index, which is what a
+    symbolizer looking up every pc of a crash report
+    wants.  */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include "dwarf_line.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_addr_line.h"
+#include "dwarf_index_cache.h"
+#include "dwarf_concurrent.h"
+
+#define FALSE 0
+#define TRUE 1
+
+/*  A CU file number not yet looked up. */
+#define ADDR_LINE_FILE_UNSET 0xfffffffe
+
+/*  Starting sizes of the growable index arrays. */
+#define ADDR_LINE_ROWS_START  1024
+#define ADDR_LINE_SEQS_START  64
+#define ADDR_LINE_FILES_START 64
+
+/*  File names are made unique across CUs
+    (every CU including a given header names the same
+    header file) with a hash search keyed by the name. */
+struct addr_line_file_key_s {
+    char           *fk_name;
+    Dwarf_Unsigned  fk_index;
+};
+
+static DW_TSHASHTYPE
+file_key_hashfunc(const void *keyp)
+{
+    const struct addr_line_file_key_s *kp = keyp;
+    const unsigned char *cp = (const unsigned char *)kp->fk_name;
+    DW_TSHASHTYPE hashv = 0;
+
+    for (; *cp; ++cp) {
+        hashv = hashv*31 + *cp;
+    }
+    return hashv;
+}
+
+static int
+file_key_compare(const void *l, const void *r)
+{
+    const struct addr_line_file_key_s *lp = l;
+    const struct addr_line_file_key_s *rp = r;
+
+    return strcmp(lp->fk_name,rp->fk_name);
+}
+
+static void
+file_key_free_node(void *nodep)
+{
+    free(nodep);
+}
+
+/*  Doubles *size (starting at start_size)
+    and reallocs *array to match. */
+static int
+grow_array(void **array,Dwarf_Unsigned *size,
+    Dwarf_Unsigned start_size, size_t entry_size)
+{
+    Dwarf_Unsigned newsize = *size? *size*2: start_size;
+    void *newarray = realloc(*array,newsize*entry_size);
+
+    if (!newarray) {
+        return DW_DLV_ERROR;
+    }
+    *array = newarray;
+    *size = newsize;
+    return DW_DLV_OK;
+}
+
+/*  Returns (through file_index_out) the ai_files index
+    of name, adding a copy of name if it is new. */
+static int
+intern_file_name(struct Dwarf_Addr_Line_Index_s *index,
+    void **file_tree,
+    char *name,
+    unsigned *file_index_out)
+{
+    struct addr_line_file_key_s key;
+    struct addr_line_file_key_s *newkey = 0;
+    void *found = 0;
+    char *namecopy = 0;
+
+    key.fk_name = name;
+    key.fk_index = 0;
+    found = dwarf_tfind(&key,file_tree,file_key_compare);
+    if (found) {
+        struct addr_line_file_key_s *kp =
+            *(struct addr_line_file_key_s **)found;
+        *file_index_out = (unsigned)kp->fk_index;
+        return DW_DLV_OK;
+    }
+    if (index->ai_file_count >= index->ai_file_size) {
+        if (grow_array((void **)&index->ai_files,&index->ai_file_size,
+            ADDR_LINE_FILES_START,sizeof(char *)) != DW_DLV_OK) {
+            return DW_DLV_ERROR;
+        }
+    }
+    namecopy = malloc(strlen(name)+1);
+    newkey = malloc(sizeof(*newkey));
+    if (!namecopy || !newkey) {
+        free(namecopy);
+        free(newkey);
+        return DW_DLV_ERROR;
+    }
+    strcpy(namecopy,name);
+    newkey->fk_name = namecopy;
+    newkey->fk_index = index->ai_file_count;
+    found = dwarf_tsearch(newkey,file_tree,file_key_compare);
+    if (!found) {
+        free(namecopy);
+        free(newkey);
+        return DW_DLV_ERROR;
+    }
+    index->ai_files[index->ai_file_count] = namecopy;
+    *file_index_out = (unsigned)index->ai_file_count;
+    index->ai_file_count++;
+    return DW_DLV_OK;
+}
+
+/*  Maps the line table file number of line to an
+    ai_files index, calling dwarf_linesrc() only the
+    first time a file number is seen in this CU.
+    A file name that cannot be made is not an error,
+    the rows just have no file name.  */
+static int
+row_file_index(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index,
+    void **file_tree,
+    Dwarf_Line line,
+    unsigned *fileno_map,
+    Dwarf_Unsigned fileno_map_count,
+    unsigned *file_index_out)
+{
+    Dwarf_Unsigned fileno = line->li_addr_line.li_l_data.li_file;
+    char *name = 0;
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    if (fileno >= fileno_map_count) {
+        *file_index_out = ADDR_LINE_NO_FILE;
+        return DW_DLV_OK;
+    }
+    if (fileno_map[fileno] != ADDR_LINE_FILE_UNSET) {
+        *file_index_out = fileno_map[fileno];
+        return DW_DLV_OK;
+    }
+    res = dwarf_linesrc(line,&name,&lerr);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        }
+        fileno_map[fileno] = ADDR_LINE_NO_FILE;
+        *file_index_out = ADDR_LINE_NO_FILE;
+        return DW_DLV_OK;
+    }
+    res = intern_file_name(index,file_tree,name,&fileno_map[fileno]);
+    /*  dwarf_dealloc() does not free a name that
+        points into the section data. */
+    dwarf_dealloc(dbg,name,DW_DLA_STRING);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    *file_index_out = fileno_map[fileno];
+    return DW_DLV_OK;
+}
+
+static int
+row_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Addr_Line_Row_s *lp = l;
+    const struct Dwarf_Addr_Line_Row_s *rp = r;
+
+    if (lp->ar_addr < rp->ar_addr) {
+        return -1;
+    }
+    if (lp->ar_addr > rp->ar_addr) {
+        return 1;
+    }
+    return 0;
+}
+
+static int
+seq_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Addr_Line_Seq_s *lp = l;
+    const struct Dwarf_Addr_Line_Seq_s *rp = r;
+
+    if (lp->as_lowpc < rp->as_lowpc) {
+        return -1;
+    }
+    if (lp->as_lowpc > rp->as_lowpc) {
+        return 1;
+    }
+    /* Keep the line table order of equal sequences. */
+    if (lp->as_first_row < rp->as_first_row) {
+        return -1;
+    }
+    if (lp->as_first_row > rp->as_first_row) {
+        return 1;
+    }
+    return 0;
+}
+
+/*  Records the rows from first_row to the end of ai_rows
+    as a sequence ending (one past its last address)
+    at highpc.  */
+static int
+close_sequence(struct Dwarf_Addr_Line_Index_s *index,
+    Dwarf_Unsigned first_row,
+    Dwarf_Addr highpc,
+    Dwarf_Off cu_die_offset,
+    Dwarf_Bool sorted)
+{
+    struct Dwarf_Addr_Line_Seq_s *seq = 0;
+    Dwarf_Unsigned row_count = index->ai_row_count - first_row;
+
+    if (!row_count) {
+        return DW_DLV_OK;
+    }
+    if (!sorted) {
+        /*  Not valid DWARF, rows within a sequence
+            are required to be in increasing address order.
+            Sort them so the lookup can work anyway. */
+        qsort(index->ai_rows + first_row,row_count,
+            sizeof(struct Dwarf_Addr_Line_Row_s),row_compare);
+    }
+    if (highpc < index->ai_rows[first_row+row_count-1].ar_addr) {
+        highpc = index->ai_rows[first_row+row_count-1].ar_addr;
+    }
+    if (index->ai_seq_count >= index->ai_seq_size) {
+        if (grow_array((void **)&index->ai_seqs,&index->ai_seq_size,
+            ADDR_LINE_SEQS_START,
+            sizeof(struct Dwarf_Addr_Line_Seq_s)) != DW_DLV_OK) {
+            return DW_DLV_ERROR;
+        }
+    }
+    seq = index->ai_seqs + index->ai_seq_count;
+    seq->as_lowpc = index->ai_rows[first_row].ar_addr;
+    seq->as_highpc = highpc;
+    seq->as_max_highpc = 0;
+    seq->as_first_row = first_row;
+    seq->as_row_count = row_count;
+    seq->as_cu_die_offset = cu_die_offset;
+    index->ai_seq_count++;
+    return DW_DLV_OK;
+}
+
+/*  Adds the rows of one CU line table to the index.
+    For a two-level line table linebuf is the actuals
+    table and the line, file and column come from
+    the logicals table.  */
+static int
+add_line_table(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index,
+    void **file_tree,
+    Dwarf_Line_Context line_context,
+    Dwarf_Line *linebuf,
+    Dwarf_Signed linecount,
+    Dwarf_Line *logicals,
+    Dwarf_Signed logicals_count,
+    Dwarf_Off cu_die_offset)
+{
+    Dwarf_Signed i = 0;
+    Dwarf_Unsigned first_row = index->ai_row_count;
+    Dwarf_Bool sorted = TRUE;
+    Dwarf_Unsigned fileno_map_count =
+        line_context->lc_file_entry_count+1;
+    unsigned *fileno_map = 0;
+    Dwarf_Unsigned k = 0;
+    int res = DW_DLV_OK;
+
+    fileno_map = (unsigned *)malloc(fileno_map_count*sizeof(unsigned));
+    if (!fileno_map) {
+        return DW_DLV_ERROR;
+    }
+    for (k = 0; k < fileno_map_count; ++k) {
+        fileno_map[k] = ADDR_LINE_FILE_UNSET;
+    }
+    for (i = 0; i < linecount; ++i) {
+        Dwarf_Line line = linebuf[i];
+        Dwarf_Line source = line;
+        struct Dwarf_Addr_Line_Row_s *row = 0;
+
+        if (line->li_addr_line.li_l_data.li_end_sequence) {
+            res = close_sequence(index,first_row,line->li_address,
+                cu_die_offset,sorted);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            first_row = index->ai_row_count;
+            sorted = TRUE;
+            continue;
+        }
+        if (logicals) {
+            Dwarf_Unsigned lindex = line->li_addr_line.li_l_data.li_line;
+
+            if (lindex == 0 || lindex > (Dwarf_Unsigned)logicals_count) {
+                continue;
+            }
+            source = logicals[lindex-1];
+        }
+        if (index->ai_row_count >= index->ai_row_size) {
+            res = grow_array((void **)&index->ai_rows,&index->ai_row_size,
+                ADDR_LINE_ROWS_START,
+                sizeof(struct Dwarf_Addr_Line_Row_s));
+            if (res != DW_DLV_OK) {
+                break;
+            }
+        }
+        row = index->ai_rows + index->ai_row_count;
+        /*  Zero the padding too, the index cache
+            writes out whole rows. */
+        memset(row,0,sizeof(*row));
+        row->ar_addr = line->li_address;
+        row->ar_line = (unsigned)source->li_addr_line.li_l_data.li_line;
+        row->ar_column = source->li_addr_line.li_l_data.li_column;
+        res = row_file_index(dbg,index,file_tree,source,
+            fileno_map,fileno_map_count,&row->ar_file);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (index->ai_row_count > first_row &&
+            row->ar_addr < row[-1].ar_addr) {
+            sorted = FALSE;
+        }
+        index->ai_row_count++;
+    }
+    if (res == DW_DLV_OK && index->ai_row_count > first_row) {
+        /*  The table did not end with an end_sequence row.
+            Keep what there is, the last row covering
+            only its own address.  */
+        res = close_sequence(index,first_row,
+            index->ai_rows[index->ai_row_count-1].ar_addr+1,
+            cu_die_offset,sorted);
+    }
+    free(fileno_map);
+    return res;
+}
+
+/*  Reads the line table of the CU whose CU die is cu_die
+    into the index. A CU without a line table is skipped. */
+static int
+add_cu_lines(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index,
+    void **file_tree,
+    Dwarf_Die cu_die,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned version = 0;
+    Dwarf_Small table_count = 0;
+    Dwarf_Line_Context line_context = 0;
+    Dwarf_Line *linebuf = 0;
+    Dwarf_Signed linecount = 0;
+    Dwarf_Line *actuals = 0;
+    Dwarf_Signed actuals_count = 0;
+    Dwarf_Off cu_die_offset = 0;
+    int res = 0;
+
+    res = dwarf_dieoffset(cu_die,&cu_die_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_srclines_b(cu_die,&version,&table_count,
+        &line_context,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (table_count == 1) {
+        res = dwarf_srclines_from_linecontext(line_context,
+            &linebuf,&linecount,error);
+    } else if (table_count == 2) {
+        res = dwarf_srclines_two_level_from_linecontext(line_context,
+            &linebuf,&linecount,&actuals,&actuals_count,error);
+    } else {
+        /* A line table header with no lines. */
+        dwarf_srclines_dealloc_b(line_context);
+        return DW_DLV_NO_ENTRY;
+    }
+    if (res != DW_DLV_OK) {
+        dwarf_srclines_dealloc_b(line_context);
+        return res;
+    }
+    if (actuals) {
+        res = add_line_table(dbg,index,file_tree,line_context,
+            actuals,actuals_count,linebuf,linecount,cu_die_offset);
+    } else {
+        res = add_line_table(dbg,index,file_tree,line_context,
+            linebuf,linecount,0,0,cu_die_offset);
+    }
+    dwarf_srclines_dealloc_b(line_context);
+    if (res == DW_DLV_ERROR) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+    }
+    return res;
+}
+
+static void
+free_index(struct Dwarf_Addr_Line_Index_s *index)
+{
+    Dwarf_Unsigned i = 0;
+
+    if (index->ai_mmap_area) {
+        free(index->ai_files);
+        _dwarf_index_cache_unmap(index->ai_mmap_area,
+            index->ai_mmap_size);
+        free(index);
+        return;
+    }
+    for (i = 0; i < index->ai_file_count; ++i) {
+        free(index->ai_files[i]);
+    }
+    free(index->ai_files);
+    free(index->ai_seqs);
+    free(index->ai_rows);
+    free(index);
+}
+
+/*  Walks every CU of .debug_info. The position used by
+    dwarf_next_cu_header_d() is saved and restored
+    so building the index at any time does not disturb
+    a caller part way through its own walk of the CUs. */
+static int
+build_index(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug_InfoTypes dis = &dbg->de_info_reading;
+    Dwarf_CU_Context saved_context = dis->de_cu_context;
+    Dwarf_Byte_Ptr saved_last_di_ptr = dis->de_last_di_ptr;
+    Dwarf_Die saved_last_die = dis->de_last_die;
+    void *file_tree = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Addr max_highpc = 0;
+    int res = DW_DLV_OK;
+
+    dwarf_initialize_search_hash(&file_tree,file_key_hashfunc,0);
+    if (!file_tree) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    dis->de_cu_context = 0;
+    for (;;) {
+        Dwarf_Unsigned next_cu_offset = 0;
+        Dwarf_Die cu_die = 0;
+
+        res = dwarf_next_cu_header_d(dbg,TRUE,0,0,0,0,0,0,0,0,
+            &next_cu_offset,0,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        res = dwarf_siblingof_b(dbg,NULL,TRUE,&cu_die,error);
+        if (res == DW_DLV_ERROR) {
+            break;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            continue;
+        }
+        res = add_cu_lines(dbg,index,&file_tree,cu_die,error);
+        dwarf_dealloc(dbg,cu_die,DW_DLA_DIE);
+        if (res == DW_DLV_ERROR) {
+            break;
+        }
+    }
+    dis->de_cu_context = saved_context;
+    dis->de_last_di_ptr = saved_last_di_ptr;
+    dis->de_last_die = saved_last_die;
+    dwarf_tdestroy(file_tree,file_key_free_node);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+
+    qsort(index->ai_seqs,index->ai_seq_count,
+        sizeof(struct Dwarf_Addr_Line_Seq_s),seq_compare);
+    for (i = 0; i < index->ai_seq_count; ++i) {
+        struct Dwarf_Addr_Line_Seq_s *seq = index->ai_seqs+i;
+
+        if (seq->as_highpc > max_highpc) {
+            max_highpc = seq->as_highpc;
+        }
+        seq->as_max_highpc = max_highpc;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+index_build(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Addr_Line_Index_s *index = 0;
+    int res = 0;
+
+    if (dbg->de_addr_line_index) {
+        return DW_DLV_OK;
+    }
+    index = (struct Dwarf_Addr_Line_Index_s *)
+        calloc(1,sizeof(struct Dwarf_Addr_Line_Index_s));
+    if (!index) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    if (_dwarf_addr_line_cache_load(dbg,index) == DW_DLV_OK) {
+        dbg->de_addr_line_index = index;
+        return DW_DLV_OK;
+    }
+    res = build_index(dbg,index,error);
+    if (res != DW_DLV_OK) {
+        free_index(index);
+        return res;
+    }
+    _dwarf_addr_line_cache_store(dbg,index);
+    dbg->de_addr_line_index = index;
+    return DW_DLV_OK;
+}
+
+/*  Builds the address-to-line index of dbg if it
+    has not been built yet, or maps it from the index
+    cache if there is one and it has the index. */
+int
+dwarf_addr_line_index_build(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    int res = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    DWARF_BUILD_LOCK(dbg);
+    res = index_build(dbg,error);
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
+
+/*  Frees the index, dwarf_finish() calls this.
+    Any file names returned by lookups are freed too. */
+void
+_dwarf_addr_line_index_destroy(Dwarf_Debug dbg)
+{
+    if (dbg->de_addr_line_index) {
+        free_index(dbg->de_addr_line_index);
+        dbg->de_addr_line_index = 0;
+    }
+}
+
+void
+dwarf_addr_line_index_free(Dwarf_Debug dbg)
+{
+    if (dbg) {
+        _dwarf_addr_line_index_destroy(dbg);
+    }
+}
+
+/*  Returns the index of the last sequence in
+    [start,count) whose low pc is <= pc,
+    given that sequence start qualifies.
+    The step doubles until it overshoots and then halves,
+    so moving a short distance forward (the usual case
+    with a sorted batch) costs only a few compares.  */
+static Dwarf_Unsigned
+advance_seq(struct Dwarf_Addr_Line_Seq_s *seqs,
+    Dwarf_Unsigned start,
+    Dwarf_Unsigned count,
+    Dwarf_Addr pc)
+{
+    Dwarf_Unsigned pos = start;
+    Dwarf_Unsigned step = 1;
+
+    while (pos+step < count && seqs[pos+step].as_lowpc <= pc) {
+        pos += step;
+        step *= 2;
+    }
+    while (step > 1) {
+        step /= 2;
+        if (pos+step < count && seqs[pos+step].as_lowpc <= pc) {
+            pos += step;
+        }
+    }
+    return pos;
+}
+
+/*  As advance_seq() but for the rows of a sequence. */
+static Dwarf_Unsigned
+advance_row(struct Dwarf_Addr_Line_Row_s *rows,
+    Dwarf_Unsigned start,
+    Dwarf_Unsigned end,
+    Dwarf_Addr pc)
+{
+    Dwarf_Unsigned pos = start;
+    Dwarf_Unsigned step = 1;
+
+    while (pos+step < end && rows[pos+step].ar_addr <= pc) {
+        pos += step;
+        step *= 2;
+    }
+    while (step > 1) {
+        step /= 2;
+        if (pos+step < end && rows[pos+step].ar_addr <= pc) {
+            pos += step;
+        }
+    }
+    return pos;
+}
+
+/*  Looks up pc_count pc values, filling in results[i]
+    for pcs[i]. When pcs is sorted in increasing order
+    the whole batch is one forward walk over the index;
+    an unsorted pcs works but restarts the walk at
+    each decrease.  */
+int
+dwarf_addr_line_lookup(Dwarf_Debug dbg,
+    Dwarf_Unsigned pc_count,
+    Dwarf_Addr *pcs,
+    Dwarf_Addr_Line *results,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Addr_Line_Index_s *index = 0;
+    struct Dwarf_Addr_Line_Seq_s *seqs = 0;
+    struct Dwarf_Addr_Line_Row_s *rows = 0;
+    Dwarf_Unsigned seq_count = 0;
+    /*  The walk position: the last sequence whose
+        low pc is <= the previous pc, and the sequence
+        and row matched for the previous pc. */
+    Dwarf_Unsigned cur_seq = 0;
+    Dwarf_Unsigned match_seq = 0;
+    Dwarf_Unsigned match_row = 0;
+    Dwarf_Bool have_match = FALSE;
+    Dwarf_Addr prev_pc = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    res = dwarf_addr_line_index_build(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    index = dbg->de_addr_line_index;
+    seqs = index->ai_seqs;
+    rows = index->ai_rows;
+    seq_count = index->ai_seq_count;
+    for (i = 0; i < pc_count; ++i) {
+        Dwarf_Addr pc = pcs[i];
+        Dwarf_Addr_Line *result = results+i;
+        Dwarf_Unsigned s = 0;
+        Dwarf_Bool found_seq = FALSE;
+        struct Dwarf_Addr_Line_Seq_s *seq = 0;
+        struct Dwarf_Addr_Line_Row_s *row = 0;
+        Dwarf_Unsigned r = 0;
+
+        memset(result,0,sizeof(*result));
+        if (!seq_count || pc < seqs[0].as_lowpc) {
+            have_match = FALSE;
+            prev_pc = pc;
+            continue;
+        }
+        if (i == 0 || pc < prev_pc) {
+            cur_seq = 0;
+            have_match = FALSE;
+        }
+        cur_seq = advance_seq(seqs,cur_seq,seq_count,pc);
+        prev_pc = pc;
+
+        /*  Sequences can overlap. The one with the
+            greatest low pc that contains pc wins. */
+        for (s = cur_seq; ; --s) {
+            if (seqs[s].as_max_highpc <= pc) {
+                break;
+            }
+            if (seqs[s].as_highpc > pc) {
+                found_seq = TRUE;
+                break;
+            }
+            if (s == 0) {
+                break;
+            }
+        }
+        if (!found_seq) {
+            have_match = FALSE;
+            continue;
+        }
+        seq = seqs+s;
+        if (have_match && match_seq == s) {
+            r = match_row;
+        } else {
+            r = seq->as_first_row;
+        }
+        r = advance_row(rows,r,seq->as_first_row+seq->as_row_count,pc);
+        have_match = TRUE;
+        match_seq = s;
+        match_row = r;
+
+        row = rows+r;
+        result->al_found = TRUE;
+        result->al_addr = row->ar_addr;
+        result->al_line = row->ar_line;
+        result->al_column = row->ar_column;
+        result->al_filename = (row->ar_file == ADDR_LINE_NO_FILE)?
+            0: index->ai_files[row->ar_file];
+        result->al_cu_die_offset = seq->as_cu_die_offset;
+    }
+    return DW_DLV_OK;
+}
@@ -0,0 +1,90 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  The address-to-line index of a Dwarf_Debug, built once
+    from the line tables of every CU in .debug_info by
+    dwarf_addr_line_index_build().
+
+    Each line table sequence becomes one
+    Dwarf_Addr_Line_Seq_s. The rows of a sequence
+    (less its end_sequence row, which only supplies
+    the sequence high pc) are stored as compact
+    Dwarf_Addr_Line_Row_s records, contiguous and in
+    address order, in ai_rows.
+    The sequences are sorted by low pc.
+
+    An index read from the index cache has ai_rows,
+    ai_seqs and the file names in the cache file
+    mapping, ai_mmap_area, and only the ai_files
+    array itself is malloc-ed.
+*/
+
+/*  ar_file of a row whose file name is not known. */
+#define ADDR_LINE_NO_FILE  0xffffffff
+
+struct Dwarf_Addr_Line_Row_s {
+    Dwarf_Addr   ar_addr;
+    unsigned     ar_line;
+    /* Index into ai_files. */
+    unsigned     ar_file;
+    Dwarf_Half   ar_column;
+};
+
+struct Dwarf_Addr_Line_Seq_s {
+    Dwarf_Addr     as_lowpc;
+    /*  One past the last address of the sequence. */
+    Dwarf_Addr     as_highpc;
+    /*  The largest as_highpc of this and every
+        earlier sequence in sorted order, so a lookup
+        knows how far back an overlapping sequence
+        (as in a relocatable object, where every
+        function starts at zero) could be. */
+    Dwarf_Addr     as_max_highpc;
+    Dwarf_Unsigned as_first_row;
+    Dwarf_Unsigned as_row_count;
+    /*  Global offset of the CU DIE. */
+    Dwarf_Off      as_cu_die_offset;
+};
+
+struct Dwarf_Addr_Line_Index_s {
+    struct Dwarf_Addr_Line_Row_s *ai_rows;
+    Dwarf_Unsigned                ai_row_count;
+    Dwarf_Unsigned                ai_row_size;
+
+    struct Dwarf_Addr_Line_Seq_s *ai_seqs;
+    Dwarf_Unsigned                ai_seq_count;
+    Dwarf_Unsigned                ai_seq_size;
+
+    /*  Full path file names, each malloc-ed
+        once however many CUs refer to it. */
+    char                        **ai_files;
+    Dwarf_Unsigned                ai_file_count;
+    Dwarf_Unsigned                ai_file_size;
+
+    void                         *ai_mmap_area;
+    Dwarf_Unsigned                ai_mmap_size;
+};
+
+void _dwarf_addr_line_index_destroy(Dwarf_Debug dbg);
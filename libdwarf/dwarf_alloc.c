@@ -53,6 +53,12 @@
 #include "dwarf_xu_index.h"
 #include "dwarf_macro5.h"
 #include "dwarf_dsc.h"
+#include "dwarf_die_cursor.h"
+#include "dwarf_addr_line.h"
+#include "dwarf_addr_cu.h"
+#include "dwarf_name_index.h"
+#include "dwarf_sig_index.h"
+#include "dwarf_concurrent.h"
 
 #define TRUE 1
 #define FALSE 0
@@ -103,10 +109,32 @@ struct reserve_size_s {
 struct reserve_data_s {
    void *rd_dbg;
    unsigned short rd_length;
-   unsigned short rd_type;
+   unsigned char rd_type;
+   /*  Non-zero if the record was carved from an arena slab
+       and so is not in de_alloc_tree. */
+   unsigned char rd_arena;
 };
 #define DW_RESERVE sizeof(struct reserve_size_s)
 
+/*  A slab is one malloc holding many arena records of a
+    single DW_DLA type.  Each record is DW_RESERVE bytes
+    of prefix (exactly as for a malloc-ed record) followed
+    by the record itself, rounded up to ARENA_ALIGN.
+    The record space follows the slab header. */
+struct Dwarf_Alloc_Slab_s {
+    struct Dwarf_Alloc_Slab_s *as_next;
+    Dwarf_Unsigned as_size;
+    Dwarf_Unsigned as_used;
+};
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(x) \
+    (((x) + (ARENA_ALIGN-1)) & ~(Dwarf_Unsigned)(ARENA_ALIGN-1))
+#define ARENA_SLAB_HDR ARENA_ROUND(sizeof(struct Dwarf_Alloc_Slab_s))
+/*  Record space in a normal slab. A record (a long DW_DLA_LIST
+    for example) larger than a quarter of this is not put
+    in the arena at all. */
+#define ARENA_SLAB_SIZE (64*1024)
+
 
 static const
 struct ial_s alloc_instance_basics[ALLOC_AREA_INDEX_TABLE_MAX] = {
@@ -175,7 +203,8 @@ struct ial_s alloc_instance_basics[ALLOC_AREA_INDEX_TABLE_MAX] = {
         are known only inside libdwarf.  */
 
     /* 30 DW_DLA_ABBREV_LIST */
-    { sizeof(struct Dwarf_Abbrev_List_s),MULTIPLY_NO, 0, 0},
+    { sizeof(struct Dwarf_Abbrev_List_s),MULTIPLY_NO, 0,
+        _dwarf_abbrev_list_destructor},
 
     /* 31 DW_DLA_CHAIN */
     {sizeof(struct Dwarf_Chain_s),MULTIPLY_NO, 0, 0},
@@ -249,7 +278,8 @@ struct ial_s alloc_instance_basics[ALLOC_AREA_INDEX_TABLE_MAX] = {
 
     /* 0x38 56.  New in July 2014. DWARF5 DebugFission dwp file sections
         .debug_cu_index and .debug_tu_index . */
-    {sizeof(struct Dwarf_Xu_Index_Header_s),MULTIPLY_NO,  0, 0},
+    {sizeof(struct Dwarf_Xu_Index_Header_s),MULTIPLY_NO,  0,
+        _dwarf_xu_index_destructor},
 
     /*  These required by new features in DWARF5. Also usable
         for DWARF2,3,4. */
@@ -269,6 +299,8 @@ struct ial_s alloc_instance_basics[ALLOC_AREA_INDEX_TABLE_MAX] = {
     /* 62 DW_DLA_DSC_HEAD 0x3e */
     {sizeof(struct Dwarf_Dsc_Head_s),MULTIPLY_NO, 0,
         _dwarf_dsc_destructor},
+    /* 63 DW_DLA_DIE_CURSOR 0x3f */
+    {sizeof(struct Dwarf_Die_Cursor_s),MULTIPLY_NO, 0, 0},
 };
 
 /*  We are simply using the incoming pointer as the key-pointer.
@@ -327,6 +359,93 @@ simple_compare_function(const void *l, const void *r)
     return 0;
 }
 
+/*  Only types with no constructor or destructor
+    and which are allocated in very large numbers are worth
+    putting in the arena. */
+static int
+arena_eligible_type(unsigned type)
+{
+    switch (type) {
+    case DW_DLA_DIE:
+    case DW_DLA_ATTR:
+    case DW_DLA_LINE:
+    case DW_DLA_LIST:
+    case DW_DLA_CHAIN:
+    case DW_DLA_CHAIN_2:
+        return TRUE;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+/*  Returns zeroed space for a record of 'size' bytes
+    (size includes DW_RESERVE) from the arena, or NULL
+    if the caller should fall back to the normal malloc path. */
+static char *
+arena_get_space(struct Dwarf_Alloc_Arena_s *arena,
+    unsigned type, Dwarf_Unsigned size)
+{
+    struct Dwarf_Alloc_Slab_s *slab = 0;
+    Dwarf_Unsigned rsize = ARENA_ROUND(size);
+    char *space = 0;
+
+    if (rsize > (ARENA_SLAB_SIZE/4)) {
+        return NULL;
+    }
+    if (alloc_instance_basics[type].ia_multiply_count == MULTIPLY_NO &&
+        arena->aa_free_list[type]) {
+        /*  The free list is threaded through the record area
+            (after the prefix). */
+        char *ret_mem = arena->aa_free_list[type];
+
+        arena->aa_free_list[type] = *(void **)ret_mem;
+        space = ret_mem - DW_RESERVE;
+        memset(space, 0, size);
+        return space;
+    }
+    slab = arena->aa_slabs[type];
+    if (!slab || (slab->as_used + rsize) > slab->as_size) {
+        Dwarf_Unsigned slabbytes = ARENA_SLAB_HDR + ARENA_SLAB_SIZE;
+
+        slab = (struct Dwarf_Alloc_Slab_s *)malloc(slabbytes);
+        if (!slab) {
+            return NULL;
+        }
+        slab->as_next = arena->aa_slabs[type];
+        slab->as_size = ARENA_SLAB_SIZE;
+        slab->as_used = 0;
+        arena->aa_slabs[type] = slab;
+        arena->aa_slab_bytes += slabbytes;
+    }
+    space = (char *)slab + ARENA_SLAB_HDR + slab->as_used;
+    slab->as_used += rsize;
+    /*  Slab space is never reused except via the free list,
+        but zero it anyway as the malloc path does. */
+    memset(space, 0, size);
+    return space;
+}
+
+static void
+arena_free_all(struct Dwarf_Alloc_Arena_s *arena)
+{
+    unsigned i = 0;
+
+    for (i = 0; i < ALLOC_AREA_INDEX_TABLE_MAX; ++i) {
+        struct Dwarf_Alloc_Slab_s *slab = arena->aa_slabs[i];
+
+        while (slab) {
+            struct Dwarf_Alloc_Slab_s *next = slab->as_next;
+
+            free(slab);
+            slab = next;
+        }
+        arena->aa_slabs[i] = 0;
+        arena->aa_free_list[i] = 0;
+    }
+    free(arena);
+}
+
 /*  This function returns a pointer to a region
     of memory.  For alloc_types that are not
     strings or lists of pointers, only 1 struct
@@ -375,6 +494,25 @@ _dwarf_get_alloc(Dwarf_Debug dbg,
             sizeof(Dwarf_Addr) : sizeof(Dwarf_Off));
     }
     size += DW_RESERVE;
+    DWARF_STATE_LOCK(dbg);
+    if (dbg->de_alloc_arena && arena_eligible_type(type)) {
+        alloc_mem = arena_get_space(dbg->de_alloc_arena,type,size);
+        if (alloc_mem) {
+            struct reserve_data_s *r = (struct reserve_data_s*)alloc_mem;
+
+            /*  Not recorded in de_alloc_tree: the slabs
+                are freed in bulk by dwarf_finish(). */
+            r->rd_dbg = dbg;
+            r->rd_type = alloc_type;
+            r->rd_length = size;
+            r->rd_arena = TRUE;
+            dbg->de_alloc_count[type]++;
+            DWARF_STATE_UNLOCK(dbg);
+            return alloc_mem + DW_RESERVE;
+        }
+        /* Too big for a slab (or out of memory), use malloc. */
+    }
+    DWARF_STATE_UNLOCK(dbg);
     alloc_mem = malloc(size);
     if (!alloc_mem) {
         return NULL;
@@ -399,8 +537,11 @@ _dwarf_get_alloc(Dwarf_Debug dbg,
                 return NULL;
             }
         }
+        DWARF_STATE_LOCK(dbg);
+        dbg->de_alloc_count[type]++;
         result = dwarf_tsearch((void *)key,
             &dbg->de_alloc_tree,simple_compare_function);
+        DWARF_STATE_UNLOCK(dbg);
         if(!result) {
             /*  Something badly wrong. Out of memory.
                 pretend all is well. */
@@ -432,8 +573,11 @@ string_is_in_debug_section(Dwarf_Debug dbg,void * space)
         It is too late to change the documentation. */
 
     void *result = 0;
+
+    DWARF_STATE_LOCK(dbg);
     result = dwarf_tfind((void *)space,
         &dbg->de_alloc_tree,simple_compare_function);
+    DWARF_STATE_UNLOCK(dbg);
     if(!result) {
         /*  Not in the tree, so not malloc-ed
             Nothing to delete. */
@@ -526,7 +670,27 @@ dwarf_dealloc(Dwarf_Debug dbg,
         /* internal or user app error */
         return;
     }
-
+    if (r->rd_arena) {
+        /*  Arena records have no destructor and are not
+            in de_alloc_tree.  Use the recorded type, not
+            the caller's, to pick the free list. */
+        unsigned rtype = r->rd_type;
+
+        DWARF_STATE_LOCK(dbg);
+        dbg->de_dealloc_count[rtype]++;
+        if (dbg->de_alloc_arena &&
+            alloc_instance_basics[rtype].ia_multiply_count ==
+                MULTIPLY_NO) {
+            struct Dwarf_Alloc_Arena_s *arena = dbg->de_alloc_arena;
+
+            *(void **)space = arena->aa_free_list[rtype];
+            arena->aa_free_list[rtype] = space;
+        }
+        DWARF_STATE_UNLOCK(dbg);
+        /*  Otherwise the space is simply reclaimed at
+            dwarf_finish() time. */
+        return;
+    }
 
     if (alloc_instance_basics[type].specialdestructor) {
         alloc_instance_basics[type].specialdestructor(space);
@@ -536,7 +700,11 @@ dwarf_dealloc(Dwarf_Debug dbg,
             The key and address to free are just a few bytes before
             'space'. */
         void *key = space;
+
+        DWARF_STATE_LOCK(dbg);
+        dbg->de_dealloc_count[type]++;
         dwarf_tdelete(key,&dbg->de_alloc_tree,simple_compare_function);
+        DWARF_STATE_UNLOCK(dbg);
         /*  If dwarf_tdelete returns NULL it might mean
             a) tree is empty.
             b) If hashsearch, then a single chain might now be empty,
@@ -577,13 +745,127 @@ _dwarf_get_debug(void)
 /*
     This function prints out the statistics
     collected on allocation of memory chunks.
-    No longer used.
+    No longer used.  See dwarf_get_alloc_stats().
 */
 void
 dwarf_print_memory_stats(UNUSEDARG Dwarf_Debug dbg)
 {
 }
 
+/*  Turns arena allocation on (non-zero arena_on)
+    or off for this dbg.  Returns the previous setting.
+    Records already allocated stay where they are:
+    turning the arena off only means new
+    records are malloc-ed individually again.
+    If the arena cannot be created nothing changes.
+    New October 2026. */
+int
+dwarf_set_alloc_arena(Dwarf_Debug dbg, int arena_on)
+{
+    int oldval = 0;
+
+    if (!dbg) {
+        return 0;
+    }
+    oldval = dbg->de_alloc_arena?TRUE:FALSE;
+    if (arena_on) {
+        if (!dbg->de_alloc_arena) {
+            struct Dwarf_Alloc_Arena_s *arena = 0;
+
+            arena = (struct Dwarf_Alloc_Arena_s *)
+                malloc(sizeof(struct Dwarf_Alloc_Arena_s));
+            if (!arena) {
+                return oldval;
+            }
+            memset(arena, 0, sizeof(*arena));
+            dbg->de_alloc_arena = arena;
+        }
+        return oldval;
+    }
+    if (dbg->de_alloc_arena) {
+        /*  Arena records may still be in use, so
+            the slabs live till dwarf_finish().
+            Move them to a holding arena.  */
+        if (!dbg->de_alloc_arena_retired) {
+            dbg->de_alloc_arena_retired = dbg->de_alloc_arena;
+        } else {
+            /*  Retired twice: splice the slab chains so
+                a single arena_free_all() covers both. */
+            struct Dwarf_Alloc_Arena_s *cur = dbg->de_alloc_arena;
+            struct Dwarf_Alloc_Arena_s *old = dbg->de_alloc_arena_retired;
+            unsigned i = 0;
+
+            for (i = 0; i < ALLOC_AREA_INDEX_TABLE_MAX; ++i) {
+                struct Dwarf_Alloc_Slab_s *slab = cur->aa_slabs[i];
+
+                if (!slab) {
+                    continue;
+                }
+                while (slab->as_next) {
+                    slab = slab->as_next;
+                }
+                slab->as_next = old->aa_slabs[i];
+                old->aa_slabs[i] = cur->aa_slabs[i];
+                cur->aa_slabs[i] = 0;
+            }
+            old->aa_slab_bytes += cur->aa_slab_bytes;
+            free(cur);
+        }
+        dbg->de_alloc_arena = 0;
+    }
+    return oldval;
+}
+
+/*  Reports, for one DW_DLA type, how many records
+    have been allocated and how many have been passed
+    to dwarf_dealloc().  For alloc_type zero
+    the totals over all types are returned and
+    arena_bytes_out is the space held in arena slabs.
+    New October 2026. */
+int
+dwarf_get_alloc_stats(Dwarf_Debug dbg,
+    Dwarf_Unsigned alloc_type,
+    Dwarf_Unsigned *alloc_count_out,
+    Dwarf_Unsigned *dealloc_count_out,
+    Dwarf_Unsigned *arena_bytes_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned allocs = 0;
+    Dwarf_Unsigned deallocs = 0;
+    Dwarf_Unsigned arenabytes = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    if (alloc_type >= ALLOC_AREA_INDEX_TABLE_MAX) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (alloc_type == 0) {
+        unsigned i = 0;
+
+        for (i = 1; i < ALLOC_AREA_INDEX_TABLE_MAX; ++i) {
+            allocs += dbg->de_alloc_count[i];
+            deallocs += dbg->de_dealloc_count[i];
+        }
+    } else {
+        allocs = dbg->de_alloc_count[alloc_type];
+        deallocs = dbg->de_dealloc_count[alloc_type];
+    }
+    if (dbg->de_alloc_arena) {
+        arenabytes += dbg->de_alloc_arena->aa_slab_bytes;
+    }
+    if (dbg->de_alloc_arena_retired) {
+        arenabytes += dbg->de_alloc_arena_retired->aa_slab_bytes;
+    }
+    *alloc_count_out = allocs;
+    *dealloc_count_out = deallocs;
+    if (arena_bytes_out) {
+        *arena_bytes_out = arenabytes;
+    }
+    return DW_DLV_OK;
+}
+
 
 
 /* In the 'rela' relocation case we might have malloc'd
@@ -594,6 +876,7 @@ rela_free(struct Dwarf_Section_s * sec)
     if (sec->dss_data_was_malloc) {
         free(sec->dss_data);
     }
+    _dwarf_unmap_cached_section(sec);
     sec->dss_data = 0;
     sec->dss_data_was_malloc = 0;
 }
@@ -605,14 +888,19 @@ freecontextlist(Dwarf_Debug dbg, Dwarf_Debug_InfoTypes dis)
     Dwarf_CU_Context nextcontext = 0;
     for (context = dis->de_cu_context_list;
         context; context = nextcontext) {
-        Dwarf_Hash_Table hash_table = context->cc_abbrev_hash_table;
-        _dwarf_free_abbrev_hash_table_contents(dbg,hash_table);
+        /*  The abbreviation tables belong to the dbg,
+            see _dwarf_abbrev_tables_destroy(). */
         nextcontext = context->cc_next;
-        dwarf_dealloc(dbg, hash_table, DW_DLA_HASH_TABLE);
-        context->cc_abbrev_hash_table = 0;
+        context->cc_abbrev_table = 0;
+        free(context->cc_sibling_slots);
+        context->cc_sibling_slots = 0;
         dwarf_dealloc(dbg, context, DW_DLA_CU_CONTEXT);
     }
     dis->de_cu_context_list = 0;
+    free(dis->de_cu_context_index);
+    dis->de_cu_context_index = 0;
+    dis->de_cu_context_index_count = 0;
+    dis->de_cu_context_index_size = 0;
 }
 
 /*
@@ -628,6 +916,8 @@ _dwarf_free_all_of_one_debug(Dwarf_Debug dbg)
     if (dbg == NULL) {
         return (DW_DLV_ERROR);
     }
+    /*  No other thread may be using dbg now. */
+    _dwarf_concurrent_destroy(dbg);
 
     /*  To do complete validation that we have no surprising missing or
         erroneous deallocs it is advisable to do the dwarf_deallocs here
@@ -672,6 +962,21 @@ _dwarf_free_all_of_one_debug(Dwarf_Debug dbg)
     rela_free(&dbg->de_debug_gdbindex);
     rela_free(&dbg->de_debug_cu_index);
     rela_free(&dbg->de_debug_tu_index);
+    {
+        /*  Any other section (rela_free() does nothing
+            to a section already freed). */
+        unsigned i = 0;
+
+        for ( ; i < dbg->de_debug_sections_total_entries; ++i) {
+            rela_free(dbg->de_debug_sections[i].ds_secdata);
+        }
+    }
+    free(dbg->de_zcache_dir);
+    dbg->de_zcache_dir = 0;
+    free(dbg->de_cache_objkey);
+    dbg->de_cache_objkey = 0;
+    free(dbg->de_index_cache_dir);
+    dbg->de_index_cache_dir = 0;
     dwarf_harmless_cleanout(&dbg->de_harmless_errors);
 
     if (dbg->de_printf_callback.dp_buffer &&
@@ -679,12 +984,26 @@ _dwarf_free_all_of_one_debug(Dwarf_Debug dbg)
         free(dbg->de_printf_callback.dp_buffer);
     }
 
+    /*  The fde destructor unlinks row tables from a list
+        through other fdes, so empty that list while
+        all the fdes still exist. */
+    _dwarf_frame_row_cache_flush(dbg);
+    _dwarf_addr_line_index_destroy(dbg);
+    _dwarf_addr_cu_map_destroy(dbg);
+    _dwarf_name_index_destroy(dbg);
+    _dwarf_sig_index_destroy(dbg);
+    _dwarf_abbrev_tables_destroy(dbg);
     dwarf_tdestroy(dbg->de_alloc_tree,tdestroy_free_node);
     dbg->de_alloc_tree = 0;
-    if (dbg->de_tied_data.td_tied_search) {
-        dwarf_tdestroy(dbg->de_tied_data.td_tied_search,
-            _dwarf_tied_destroy_free_node);
-        dbg->de_tied_data.td_tied_search = 0;
+    /*  Destructors run by dwarf_tdestroy() may dwarf_dealloc()
+        arena records, so the slabs go last. */
+    if (dbg->de_alloc_arena) {
+        arena_free_all(dbg->de_alloc_arena);
+        dbg->de_alloc_arena = 0;
+    }
+    if (dbg->de_alloc_arena_retired) {
+        arena_free_all(dbg->de_alloc_arena_retired);
+        dbg->de_alloc_arena_retired = 0;
     }
     memset(dbg, 0, sizeof(*dbg)); /* Prevent accidental use later. */
     free(dbg);
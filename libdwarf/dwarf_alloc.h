@@ -35,4 +35,24 @@ struct Dwarf_Error_s * _dwarf_special_no_dbg_error_malloc(void);
 /*  ALLOC_AREA_INDEX_TABLE_MAX is the size of the
     struct ial_s index_into_allocated array in dwarf_alloc.c
 */
-#define ALLOC_AREA_INDEX_TABLE_MAX 63
+#define ALLOC_AREA_INDEX_TABLE_MAX 64
+
+/*  When arena allocation is turned on by dwarf_set_alloc_arena()
+    the most common small records (DIEs, attributes, lines,
+    chains and lists) are carved out of large slabs, one
+    chain of slabs per DW_DLA type, instead of being malloc-ed
+    one at a time and recorded in de_alloc_tree.
+    All the slabs are freed at once by dwarf_finish(). */
+struct Dwarf_Alloc_Slab_s;
+struct Dwarf_Alloc_Arena_s {
+    /* Most recent slab first, indexed by DW_DLA type. */
+    struct Dwarf_Alloc_Slab_s *aa_slabs[ALLOC_AREA_INDEX_TABLE_MAX];
+
+    /*  Fixed-size records dwarf_dealloc()-ed by the caller
+        are pushed here and handed out again
+        by _dwarf_get_alloc(). Indexed by DW_DLA type. */
+    void *aa_free_list[ALLOC_AREA_INDEX_TABLE_MAX];
+
+    /* Total bytes malloc-ed for slabs. */
+    Dwarf_Unsigned aa_slab_bytes;
+};
@@ -451,6 +451,9 @@ _dwarf_get_aranges_addr_offsets(Dwarf_Debug dbg,
     address range in the block.  If yes, it
     returns the appropriate Dwarf_Arange.
     Otherwise, it returns DW_DLV_ERROR.
+    This is a linear search of the block,
+    for many lookups use dwarf_addr_cu_lookup()
+    (dwarf_addr_cu.c) instead.
 */
 int
 dwarf_get_arange(Dwarf_Arange * aranges,
@@ -0,0 +1,257 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    Concurrent-read mode: several threads reading one
+    Dwarf_Debug at once.
+
+    Reading normally changes the Dwarf_Debug: sections are
+    loaded, CU contexts made and abbreviations parsed on
+    first use, and every Dwarf_Die, Dwarf_Attribute and
+    Dwarf_Error is recorded for dwarf_finish().
+    dwarf_set_concurrent_reads() does all the first-use work
+    that can be done up front, and from then on the
+    records and the remaining first-use work (the lookup
+    indexes, for example) are done under the locks in
+    struct Dwarf_Concurrent_s (dwarf_concurrent.h).
+    The positions kept per handle only as hints (such as
+    where the last dwarf_child() stopped, for
+    dwarf_validate_die_sibling(), and the sibling cache)
+    are no longer recorded. */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include "dwarf_die_deliv.h"
+#include "dwarf_concurrent.h"
+
+#define FALSE 0
+#define TRUE 1
+
+#ifdef HAVE_PTHREAD
+void
+_dwarf_state_lock(Dwarf_Debug dbg)
+{
+    pthread_mutex_lock(&dbg->de_concurrent->dc_state_lock);
+}
+
+void
+_dwarf_state_unlock(Dwarf_Debug dbg)
+{
+    pthread_mutex_unlock(&dbg->de_concurrent->dc_state_lock);
+}
+
+void
+_dwarf_build_lock(Dwarf_Debug dbg)
+{
+    pthread_mutex_lock(&dbg->de_concurrent->dc_build_lock);
+}
+
+void
+_dwarf_build_unlock(Dwarf_Debug dbg)
+{
+    pthread_mutex_unlock(&dbg->de_concurrent->dc_build_lock);
+}
+
+/*  Frees the locks, dwarf_finish() calls this. */
+void
+_dwarf_concurrent_destroy(Dwarf_Debug dbg)
+{
+    struct Dwarf_Concurrent_s *conc = dbg->de_concurrent;
+
+    if (conc) {
+        dbg->de_concurrent = 0;
+        pthread_mutex_destroy(&conc->dc_state_lock);
+        pthread_mutex_destroy(&conc->dc_build_lock);
+        free(conc);
+    }
+}
+
+/*  Loads every section not loaded yet.  A section that
+    will not load is left for its first use to
+    load (under the build lock) and report. */
+static void
+load_all_sections(Dwarf_Debug dbg)
+{
+    Dwarf_Error lerr = 0;
+    unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_decompress_sections(dbg,0,&lerr);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        lerr = 0;
+    }
+    for (i = 0; i < dbg->de_debug_sections_total_entries; ++i) {
+        struct Dwarf_Section_s *section =
+            dbg->de_debug_sections[i].ds_secdata;
+
+        if (section->dss_data || !section->dss_size) {
+            continue;
+        }
+        res = _dwarf_load_section(dbg,section,&lerr);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+            lerr = 0;
+        }
+    }
+}
+
+/*  Makes the CU context of every CU of .debug_info
+    (is_info TRUE) or .debug_types, with the base fields
+    from its CU die, and reads all of the abbreviations
+    each uses, so no thread need make or extend
+    any of them later.  */
+static int
+prepare_cu_contexts(Dwarf_Debug dbg,
+    Dwarf_Bool is_info,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug_InfoTypes dis = is_info? &dbg->de_info_reading:
+        &dbg->de_types_reading;
+    Dwarf_CU_Context context = 0;
+    Dwarf_Unsigned cu_count = 0;
+    int res = 0;
+
+    res = dwarf_preload_cu_headers(dbg,is_info,&cu_count,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (context = dis->de_cu_context_list; context;
+        context = context->cc_next) {
+        Dwarf_Abbrev_List abbrev = 0;
+        Dwarf_CU_Context same = 0;
+        Dwarf_Sig8 dwo_id;
+        Dwarf_Bool dwo_id_present = FALSE;
+
+        res = _dwarf_get_cu_context_at_offset(dbg,
+            context->cc_debug_offset,is_info,&same,
+            &dwo_id,&dwo_id_present,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (!context->cc_abbrev_table ||
+            context->cc_abbrev_table->ab_done) {
+            continue;
+        }
+        /*  No abbreviation has code 0, so this reads
+            the whole table. */
+        res = _dwarf_get_abbrev_for_code(context,0,&abbrev,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+    }
+    /*  Nothing still refers to the last DIE
+        dwarf_child() saw; it is not tracked from now on. */
+    dis->de_last_die = 0;
+    dis->de_last_di_ptr = 0;
+    return DW_DLV_OK;
+}
+#else /* !HAVE_PTHREAD */
+/*  de_concurrent is never set, these are never called. */
+void
+_dwarf_state_lock(UNUSEDARG Dwarf_Debug dbg)
+{
+}
+void
+_dwarf_state_unlock(UNUSEDARG Dwarf_Debug dbg)
+{
+}
+void
+_dwarf_build_lock(UNUSEDARG Dwarf_Debug dbg)
+{
+}
+void
+_dwarf_build_unlock(UNUSEDARG Dwarf_Debug dbg)
+{
+}
+void
+_dwarf_concurrent_destroy(UNUSEDARG Dwarf_Debug dbg)
+{
+}
+#endif /* HAVE_PTHREAD */
+
+/*  Turns concurrent-read mode on (on non-zero) or off.
+    Call it while no other thread is using dbg.
+    Returns DW_DLV_NO_ENTRY if libdwarf was built without
+    thread support, DW_DLV_ERROR if the CU headers or
+    abbreviations could not be read (the mode is then
+    left off).  */
+int
+dwarf_set_concurrent_reads(Dwarf_Debug dbg,
+    int on,
+    Dwarf_Error *error)
+{
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+#ifdef HAVE_PTHREAD
+    if (!on) {
+        _dwarf_concurrent_destroy(dbg);
+        return DW_DLV_OK;
+    }
+    if (dbg->de_concurrent) {
+        return DW_DLV_OK;
+    }
+    {
+        struct Dwarf_Concurrent_s *conc = 0;
+        pthread_mutexattr_t attr;
+        int res = 0;
+
+        load_all_sections(dbg);
+        res = prepare_cu_contexts(dbg,TRUE,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        res = prepare_cu_contexts(dbg,FALSE,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        conc = (struct Dwarf_Concurrent_s *)
+            calloc(1,sizeof(struct Dwarf_Concurrent_s));
+        if (!conc) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        pthread_mutex_init(&conc->dc_state_lock,0);
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr,PTHREAD_MUTEX_RECURSIVE);
+        pthread_mutex_init(&conc->dc_build_lock,&attr);
+        pthread_mutexattr_destroy(&attr);
+        dbg->de_concurrent = conc;
+    }
+    return DW_DLV_OK;
+#else /* !HAVE_PTHREAD */
+    if (on) {
+        return DW_DLV_NO_ENTRY;
+    }
+    return DW_DLV_OK;
+#endif /* HAVE_PTHREAD */
+}
@@ -0,0 +1,79 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    Concurrent-read mode, see dwarf_set_concurrent_reads().
+    de_concurrent is non-null while the mode is on.
+
+    dc_state_lock guards the allocation records (de_alloc_tree,
+    the arena and the allocation counts) and the harmless
+    error list.  It is held only briefly and nothing
+    taking a lock is called while it is held.
+
+    dc_build_lock serializes the one-time work done on
+    first use: loading a section, building an index,
+    reading a CU's str_offsets base.  It is recursive
+    as one such build can lead to another. */
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+
+struct Dwarf_Concurrent_s {
+    pthread_mutex_t dc_state_lock;
+    pthread_mutex_t dc_build_lock;
+};
+#endif /* HAVE_PTHREAD */
+
+void _dwarf_state_lock(Dwarf_Debug dbg);
+void _dwarf_state_unlock(Dwarf_Debug dbg);
+void _dwarf_build_lock(Dwarf_Debug dbg);
+void _dwarf_build_unlock(Dwarf_Debug dbg);
+void _dwarf_concurrent_destroy(Dwarf_Debug dbg);
+
+/*  The locks cost only a test when the mode is off. */
+#define DWARF_STATE_LOCK(dbg)                 \
+    do {                                      \
+        if ((dbg)->de_concurrent) {           \
+            _dwarf_state_lock(dbg);           \
+        }                                     \
+    } while (0)
+#define DWARF_STATE_UNLOCK(dbg)               \
+    do {                                      \
+        if ((dbg)->de_concurrent) {           \
+            _dwarf_state_unlock(dbg);         \
+        }                                     \
+    } while (0)
+#define DWARF_BUILD_LOCK(dbg)                 \
+    do {                                      \
+        if ((dbg)->de_concurrent) {           \
+            _dwarf_build_lock(dbg);           \
+        }                                     \
+    } while (0)
+#define DWARF_BUILD_UNLOCK(dbg)               \
+    do {                                      \
+        if ((dbg)->de_concurrent) {           \
+            _dwarf_build_unlock(dbg);         \
+        }                                     \
+    } while (0)
@@ -0,0 +1,449 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    A cursor for walking DIEs in section order
+    without allocating a Dwarf_Die per DIE or
+    a Dwarf_Attribute per attribute.
+    The attribute values are reported in caller-provided
+    Dwarf_Attr_View records, decoded directly from the DIE
+    bytes as described by the abbreviation's
+    attribute/form list. */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#ifdef HAVE_ELF_H
+#include <elf.h>
+#endif
+#include <stdio.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include "dwarf_util.h"
+#include "dwarf_die_deliv.h"
+#include "dwarf_die_cursor.h"
+
+#define FALSE 0
+#define TRUE 1
+
+static void
+set_cursor_start(Dwarf_Die_Cursor cursor, Dwarf_Die die)
+{
+    Dwarf_CU_Context context = die->di_cu_context;
+    Dwarf_Debug dbg = context->cc_dbg;
+
+    cursor->dc_dbg = dbg;
+    cursor->dc_cu_context = context;
+    cursor->dc_is_info = die->di_is_info;
+    cursor->dc_section_data = die->di_is_info?
+        dbg->de_debug_info.dss_data:
+        dbg->de_debug_types.dss_data;
+    cursor->dc_info_end = _dwarf_calculate_info_section_end_ptr(context);
+    cursor->dc_die_ptr = 0;
+    cursor->dc_attr_ptr = 0;
+    cursor->dc_abbrev_list = 0;
+    cursor->dc_abbrev_code = 0;
+    cursor->dc_depth = 0;
+    cursor->dc_next_ptr = die->di_debug_ptr;
+    cursor->dc_next_known = TRUE;
+    cursor->dc_done = FALSE;
+}
+
+/*  Start a cursor on die. The first dwarf_next_die()
+    returns die itself (at depth 0), later ones
+    its descendants. Passing a CU die walks the whole CU.  */
+int
+dwarf_die_cursor_open(Dwarf_Die die,
+    Dwarf_Die_Cursor *cursor_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Die_Cursor cursor = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    dbg = die->di_cu_context->cc_dbg;
+    cursor = (Dwarf_Die_Cursor)_dwarf_get_alloc(dbg,
+        DW_DLA_DIE_CURSOR,1);
+    if (!cursor) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    set_cursor_start(cursor,die);
+    *cursor_out = cursor;
+    return DW_DLV_OK;
+}
+
+/*  Restart an existing cursor on a different die (for
+    example the next CU die) so one cursor can serve
+    a whole section. */
+int
+dwarf_die_cursor_reset(Dwarf_Die_Cursor cursor,
+    Dwarf_Die die,
+    Dwarf_Error *error)
+{
+    if (!cursor) {
+        _dwarf_error(NULL, error, DW_DLE_DIE_NULL);
+        return DW_DLV_ERROR;
+    }
+    CHECK_DIE(die, DW_DLV_ERROR);
+    set_cursor_start(cursor,die);
+    return DW_DLV_OK;
+}
+
+/*  Decode the value of one attribute of form 'form'
+    whose bytes start at valptr and occupy size bytes.
+    endptr is the end of the CU.
+    Also used by dwarf_get_attrs().  */
+int
+_dwarf_fill_attr_view(Dwarf_Debug dbg,
+    Dwarf_Small *endptr,
+    Dwarf_Half attr,
+    Dwarf_Half form,
+    Dwarf_Small *valptr,
+    Dwarf_Unsigned size,
+    Dwarf_Attr_View *view,
+    Dwarf_Error *error)
+{
+    Dwarf_Small *p = valptr;
+    Dwarf_Unsigned uval = 0;
+
+    view->av_attr = attr;
+    view->av_form = form;
+    view->av_value = 0;
+    view->av_data = valptr;
+    view->av_length = size;
+    switch (form) {
+    case DW_FORM_addr:
+    case DW_FORM_data1:
+    case DW_FORM_data2:
+    case DW_FORM_data4:
+    case DW_FORM_data8:
+    case DW_FORM_flag:
+    case DW_FORM_ref1:
+    case DW_FORM_ref2:
+    case DW_FORM_ref4:
+    case DW_FORM_ref8:
+    case DW_FORM_ref_addr:
+    case DW_FORM_ref_sig8:
+    case DW_FORM_ref_sup:
+    case DW_FORM_sec_offset:
+    case DW_FORM_strp:
+    case DW_FORM_strp_sup:
+    case DW_FORM_line_strp:
+    case DW_FORM_GNU_ref_alt:
+    case DW_FORM_GNU_strp_alt:
+        /*  Fixed size unsigned values. The size came
+            from _dwarf_get_size_of_val() so it already
+            accounts for address and offset size. */
+        if (size > sizeof(Dwarf_Unsigned)) {
+            _dwarf_error(dbg, error, DW_DLE_ATTR_FORM_SIZE_BAD);
+            return DW_DLV_ERROR;
+        }
+        READ_UNALIGNED_CK(dbg, uval, Dwarf_Unsigned,
+            p, size,error,endptr);
+        view->av_value = uval;
+        break;
+    case DW_FORM_udata:
+    case DW_FORM_ref_udata:
+    case DW_FORM_strx:
+    case DW_FORM_addrx:
+    case DW_FORM_loclistx:
+    case DW_FORM_rnglistx:
+    case DW_FORM_GNU_str_index:
+    case DW_FORM_GNU_addr_index:
+        DECODE_LEB128_UWORD_CK(p, uval,dbg,error,endptr);
+        view->av_value = uval;
+        break;
+    case DW_FORM_sdata: {
+        Dwarf_Signed sval = 0;
+
+        DECODE_LEB128_SWORD_CK(p, sval,dbg,error,endptr);
+        view->av_value = (Dwarf_Unsigned)sval;
+        }
+        break;
+    case DW_FORM_flag_present:
+        view->av_value = 1;
+        break;
+    case DW_FORM_block1:
+    case DW_FORM_block2:
+    case DW_FORM_block4: {
+        Dwarf_Unsigned lensize = (form == DW_FORM_block1)? 1:
+            ((form == DW_FORM_block2)? 2: 4);
+
+        READ_UNALIGNED_CK(dbg, uval, Dwarf_Unsigned,
+            p, lensize,error,endptr);
+        view->av_value = uval;
+        view->av_data = p + lensize;
+        }
+        break;
+    case DW_FORM_block:
+    case DW_FORM_exprloc:
+        DECODE_LEB128_UWORD_CK(p, uval,dbg,error,endptr);
+        view->av_value = uval;
+        view->av_data = p;
+        break;
+    default:
+        /*  DW_FORM_string (av_data is the string) and
+            forms with no scalar value (DW_FORM_data16):
+            the caller uses av_data and av_length. */
+        break;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Step over (and, if views is non-null, record)
+    the attribute values of the current DIE.
+    Sets dc_next_ptr.
+    *attr_count_out is the number of attributes of
+    the DIE, which may be more than view_count.  */
+static int
+read_die_attrs(Dwarf_Die_Cursor cursor,
+    Dwarf_Attr_View *views,
+    Dwarf_Unsigned view_count,
+    Dwarf_Unsigned *attr_count_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = cursor->dc_dbg;
+    Dwarf_CU_Context context = cursor->dc_cu_context;
+    Dwarf_Small *info_ptr = cursor->dc_attr_ptr;
+    Dwarf_Small *info_end = cursor->dc_info_end;
+    Dwarf_Abbrev_List abbrev_list = cursor->dc_abbrev_list;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned fixed_size = 0;
+
+    if (!views &&
+        _dwarf_abbrev_fixed_size(context,abbrev_list,&fixed_size)) {
+        /*  Only stepping over the DIE, and the abbreviation
+            gives its size. */
+        if (fixed_size > (Dwarf_Unsigned)(info_end - info_ptr)) {
+            _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_PAST_END);
+            return DW_DLV_ERROR;
+        }
+        cursor->dc_next_ptr = info_ptr + fixed_size;
+        cursor->dc_next_known = TRUE;
+        if (attr_count_out) {
+            *attr_count_out = abbrev_list->abl_count;
+        }
+        return DW_DLV_OK;
+    }
+    for (count = 0; count < abbrev_list->abl_count; ++count) {
+        struct Dwarf_Abbrev_Attr_s *aa = abbrev_list->abl_attrs + count;
+        Dwarf_Half form = aa->aa_form;
+        Dwarf_Unsigned size = 0;
+        int res = 0;
+
+        if (form == DW_FORM_indirect) {
+            Dwarf_Unsigned utmp = 0;
+
+            DECODE_LEB128_UWORD_CK(info_ptr, utmp,dbg,error,info_end);
+            form = (Dwarf_Half)utmp;
+        }
+        res = ABBREV_ATTR_VALUE_SIZE(context,aa,form,
+            info_ptr,info_end,&size,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (size > (Dwarf_Unsigned)(info_end - info_ptr)) {
+            _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_PAST_END);
+            return DW_DLV_ERROR;
+        }
+        if (views && count < view_count) {
+            res = _dwarf_fill_attr_view(dbg,info_end,
+                aa->aa_attr,form,info_ptr,size,
+                views+count,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        }
+        info_ptr += size;
+    }
+    cursor->dc_next_ptr = info_ptr;
+    cursor->dc_next_known = TRUE;
+    if (attr_count_out) {
+        *attr_count_out = count;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Move to the next DIE in section order, staying
+    within the DIE the cursor was started on.
+    Returns DW_DLV_NO_ENTRY when that DIE and all its
+    descendants have been returned.
+    The depth is relative to the starting DIE.  */
+int
+dwarf_next_die(Dwarf_Die_Cursor cursor,
+    Dwarf_Half *tag_out,
+    Dwarf_Signed *depth_out,
+    Dwarf_Unsigned *abbrev_code_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Small *info_ptr = 0;
+    Dwarf_Small *info_end = 0;
+    Dwarf_Signed depth = 0;
+    Dwarf_Unsigned code = 0;
+    Dwarf_Abbrev_List abbrev_list = 0;
+    int res = 0;
+
+    if (!cursor) {
+        _dwarf_error(NULL, error, DW_DLE_DIE_NULL);
+        return DW_DLV_ERROR;
+    }
+    if (cursor->dc_done) {
+        return DW_DLV_NO_ENTRY;
+    }
+    dbg = cursor->dc_dbg;
+    info_end = cursor->dc_info_end;
+    if (cursor->dc_die_ptr) {
+        if (!cursor->dc_next_known) {
+            res = read_die_attrs(cursor,0,0,0,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        }
+        depth = cursor->dc_depth;
+        if (cursor->dc_abbrev_list->abl_has_child) {
+            ++depth;
+        } else if (depth == 0) {
+            /* The starting DIE has no children. */
+            cursor->dc_done = TRUE;
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    info_ptr = cursor->dc_next_ptr;
+    for (;;) {
+        Dwarf_Small *die_ptr = info_ptr;
+
+        if (info_ptr >= info_end) {
+            /*  Ran into the end of the CU: there is
+                nothing more to walk. */
+            cursor->dc_done = TRUE;
+            return DW_DLV_NO_ENTRY;
+        }
+        DECODE_LEB128_UWORD_CK(info_ptr, code,dbg,error,info_end);
+        if (!code) {
+            /*  A null entry ends a sibling list. Back at
+                depth 0 means the start DIE is finished. */
+            --depth;
+            if (depth <= 0) {
+                cursor->dc_done = TRUE;
+                return DW_DLV_NO_ENTRY;
+            }
+            continue;
+        }
+        res = _dwarf_get_abbrev_for_code(cursor->dc_cu_context,
+            code, &abbrev_list,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            _dwarf_error(dbg, error, DW_DLE_DIE_ABBREV_LIST_NULL);
+            return DW_DLV_ERROR;
+        }
+        cursor->dc_die_ptr = die_ptr;
+        break;
+    }
+    cursor->dc_attr_ptr = info_ptr;
+    cursor->dc_abbrev_list = abbrev_list;
+    cursor->dc_abbrev_code = code;
+    cursor->dc_depth = depth;
+    cursor->dc_next_known = FALSE;
+    *tag_out = abbrev_list->abl_tag;
+    *depth_out = depth;
+    *abbrev_code_out = code;
+    return DW_DLV_OK;
+}
+
+/*  Return the attributes of the current DIE in the
+    caller's views[0..view_count-1]. *attr_count_out
+    is the number of attributes the DIE has: if more
+    than view_count only the first view_count are filled in.
+    The views point into the section data and stay valid
+    as long as the Dwarf_Debug is open.  */
+int
+dwarf_die_cursor_attrs(Dwarf_Die_Cursor cursor,
+    Dwarf_Attr_View *views,
+    Dwarf_Unsigned view_count,
+    Dwarf_Unsigned *attr_count_out,
+    Dwarf_Error *error)
+{
+    if (!cursor) {
+        _dwarf_error(NULL, error, DW_DLE_DIE_NULL);
+        return DW_DLV_ERROR;
+    }
+    if (!cursor->dc_die_ptr || cursor->dc_done) {
+        return DW_DLV_NO_ENTRY;
+    }
+    return read_die_attrs(cursor,views,view_count,
+        attr_count_out,error);
+}
+
+/*  The section-global offset of the current DIE. */
+int
+dwarf_die_cursor_offset(Dwarf_Die_Cursor cursor,
+    Dwarf_Off *offset_out,
+    Dwarf_Error *error)
+{
+    if (!cursor) {
+        _dwarf_error(NULL, error, DW_DLE_DIE_NULL);
+        return DW_DLV_ERROR;
+    }
+    if (!cursor->dc_die_ptr || cursor->dc_done) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *offset_out = cursor->dc_die_ptr - cursor->dc_section_data;
+    return DW_DLV_OK;
+}
+
+/*  Make an ordinary Dwarf_Die for the current DIE,
+    for use with the rest of the libdwarf interfaces.
+    The caller dwarf_dealloc()s it with DW_DLA_DIE.  */
+int
+dwarf_die_cursor_die(Dwarf_Die_Cursor cursor,
+    Dwarf_Die *die_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Die die = 0;
+
+    if (!cursor) {
+        _dwarf_error(NULL, error, DW_DLE_DIE_NULL);
+        return DW_DLV_ERROR;
+    }
+    if (!cursor->dc_die_ptr || cursor->dc_done) {
+        return DW_DLV_NO_ENTRY;
+    }
+    die = (Dwarf_Die)_dwarf_get_alloc(cursor->dc_dbg, DW_DLA_DIE, 1);
+    if (!die) {
+        _dwarf_error(cursor->dc_dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    die->di_debug_ptr = cursor->dc_die_ptr;
+    die->di_cu_context = cursor->dc_cu_context;
+    die->di_is_info = cursor->dc_is_info;
+    die->di_abbrev_code = (int)cursor->dc_abbrev_code;
+    die->di_abbrev_list = cursor->dc_abbrev_list;
+    *die_out = die;
+    return DW_DLV_OK;
+}
@@ -0,0 +1,70 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  A Dwarf_Die_Cursor walks a DIE and all its descendants
+    in section order, reading the DIE bytes directly,
+    so no Dwarf_Die or Dwarf_Attribute is allocated per DIE.
+
+    dc_depth is the depth of the current DIE relative to the
+    DIE the cursor was started on (which is depth 0).
+*/
+struct Dwarf_Die_Cursor_s {
+    Dwarf_Debug      dc_dbg;
+    Dwarf_CU_Context dc_cu_context;
+    Dwarf_Bool       dc_is_info;
+
+    /*  Start of .debug_info (or .debug_types) data and
+        one-past-end of the CU being walked. */
+    Dwarf_Small     *dc_section_data;
+    Dwarf_Small     *dc_info_end;
+
+    /*  The current DIE: its abbrev code byte, its
+        first attribute value byte and its abbrev.
+        dc_die_ptr is 0 before the first dwarf_next_die(). */
+    Dwarf_Small     *dc_die_ptr;
+    Dwarf_Small     *dc_attr_ptr;
+    Dwarf_Abbrev_List dc_abbrev_list;
+    Dwarf_Unsigned   dc_abbrev_code;
+    Dwarf_Signed     dc_depth;
+
+    /*  One past the attribute values of the current DIE.
+        Only meaningful if dc_next_known is TRUE,
+        it is found by skipping (or reading) the
+        attribute values. */
+    Dwarf_Small     *dc_next_ptr;
+    Dwarf_Bool       dc_next_known;
+
+    /*  TRUE once the walk has left the starting DIE. */
+    Dwarf_Bool       dc_done;
+};
+
+int _dwarf_fill_attr_view(Dwarf_Debug dbg,
+    Dwarf_Small *endptr,
+    Dwarf_Half attr,
+    Dwarf_Half form,
+    Dwarf_Small *valptr,
+    Dwarf_Unsigned size,
+    Dwarf_Attr_View *view,
+    Dwarf_Error *error);
@@ -31,7 +31,10 @@
 #include <elf.h>
 #endif
 #include <stdio.h>
+#include <stdlib.h>
 #include "dwarf_die_deliv.h"
+#include "dwarf_sig_index.h"
+#include "dwarf_concurrent.h"
 
 #define FALSE 0
 #define TRUE 1
@@ -44,6 +47,81 @@ dwarf_get_die_infotypes_flag(Dwarf_Die die)
     return die->di_is_info;
 }
 
+/*  Returns the index in de_cu_context_index of the
+    CU context with the greatest cc_debug_offset
+    not greater than offset, or -1 if there is none.
+    Contexts never overlap, so the context returned
+    is the only one that might contain offset. */
+static Dwarf_Signed
+cu_context_index_search(Dwarf_Debug_InfoTypes dis, Dwarf_Off offset)
+{
+    Dwarf_Signed low = 0;
+    Dwarf_Signed high = (Dwarf_Signed)dis->de_cu_context_index_count - 1;
+    Dwarf_Signed found = -1;
+
+    while (low <= high) {
+        Dwarf_Signed mid = low + (high - low)/2;
+        Dwarf_CU_Context c = dis->de_cu_context_index[mid];
+
+        if (c->cc_debug_offset <= offset) {
+            found = mid;
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return found;
+}
+
+static Dwarf_Bool
+cu_context_contains(Dwarf_CU_Context cu_context, Dwarf_Off offset)
+{
+    if (offset >= cu_context->cc_debug_offset &&
+        offset < cu_context->cc_debug_offset +
+        cu_context->cc_length + cu_context->cc_length_size
+        + cu_context->cc_extension_size) {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*  Adds a new CU context to the sorted offset index.
+    Contexts are nearly always created in section
+    order so this is nearly always an append. */
+static int
+cu_context_index_insert(Dwarf_Debug dbg,
+    Dwarf_Debug_InfoTypes dis,
+    Dwarf_CU_Context cu_context,
+    Dwarf_Error *error)
+{
+    Dwarf_Signed pos = 0;
+    Dwarf_Unsigned count = dis->de_cu_context_index_count;
+
+    if (count >= dis->de_cu_context_index_size) {
+        Dwarf_Unsigned newsize = dis->de_cu_context_index_size?
+            dis->de_cu_context_index_size*2 : 64;
+        Dwarf_CU_Context *newindex = (Dwarf_CU_Context *)
+            realloc(dis->de_cu_context_index,
+                newsize*sizeof(Dwarf_CU_Context));
+
+        if (!newindex) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        dis->de_cu_context_index = newindex;
+        dis->de_cu_context_index_size = newsize;
+    }
+    pos = cu_context_index_search(dis,cu_context->cc_debug_offset) + 1;
+    if ((Dwarf_Unsigned)pos < count) {
+        memmove(dis->de_cu_context_index+pos+1,
+            dis->de_cu_context_index+pos,
+            (count-pos)*sizeof(Dwarf_CU_Context));
+    }
+    dis->de_cu_context_index[pos] = cu_context;
+    dis->de_cu_context_index_count = count+1;
+    return DW_DLV_OK;
+}
+
 /*
     For a given Dwarf_Debug dbg, this function checks
     if a CU that includes the given offset has been read
@@ -52,7 +130,9 @@ dwarf_get_die_infotypes_flag(Dwarf_Die die)
     internal routine, it is assumed that a valid dbg
     is passed.
 
-    **This is a sequential search.  May be too slow.
+    Every CU context made, whether by dwarf_next_cu_header*()
+    or by dwarf_offdie_b(), is in the sorted
+    de_cu_context_index, so this is a binary search.
 
     If debug_info and debug_abbrev not loaded, this will
     wind up returning NULL. So no need to load before calling
@@ -61,73 +141,34 @@ dwarf_get_die_infotypes_flag(Dwarf_Die die)
 static Dwarf_CU_Context
 _dwarf_find_CU_Context(Dwarf_Debug dbg, Dwarf_Off offset,Dwarf_Bool is_info)
 {
-    Dwarf_CU_Context cu_context = 0;
+    Dwarf_Signed i = 0;
     Dwarf_Debug_InfoTypes dis = is_info? &dbg->de_info_reading:
         &dbg->de_types_reading;
 
-    if (offset >= dis->de_last_offset)
-        return (NULL);
-
-    if (dis->de_cu_context != NULL &&
-        dis->de_cu_context->cc_next != NULL &&
-        dis->de_cu_context->cc_next->cc_debug_offset == offset) {
-
-        return (dis->de_cu_context->cc_next);
+    if (offset >= dis->de_last_offset) {
+        return NULL;
     }
-
-    if (dis->de_cu_context != NULL &&
-        dis->de_cu_context->cc_debug_offset <= offset) {
-
-        for (cu_context = dis->de_cu_context;
-            cu_context != NULL; cu_context = cu_context->cc_next) {
-
-            if (offset >= cu_context->cc_debug_offset &&
-                offset < cu_context->cc_debug_offset +
-                cu_context->cc_length + cu_context->cc_length_size
-                + cu_context->cc_extension_size) {
-
-                return (cu_context);
-            }
+    if (!dbg->de_concurrent && dis->de_cu_context != NULL) {
+        /*  The commonest cases: the current CU
+            and the one just after it.
+            Not in concurrent-read mode, where the current
+            CU may be changing under us. */
+        if (cu_context_contains(dis->de_cu_context,offset)) {
+            return dis->de_cu_context;
         }
-    }
-
-    for (cu_context = dis->de_cu_context_list;
-        cu_context != NULL; cu_context = cu_context->cc_next) {
-
-        if (offset >= cu_context->cc_debug_offset &&
-            offset < cu_context->cc_debug_offset +
-            cu_context->cc_length + cu_context->cc_length_size
-            + cu_context->cc_extension_size) {
-
-            return (cu_context);
+        if (dis->de_cu_context->cc_next != NULL &&
+            dis->de_cu_context->cc_next->cc_debug_offset == offset) {
+            return dis->de_cu_context->cc_next;
         }
     }
-
-    return (NULL);
-}
-
-
-/*  This routine checks the dwarf_offdie() list of
-    CU contexts for the right CU context.  */
-static Dwarf_CU_Context
-_dwarf_find_offdie_CU_Context(Dwarf_Debug dbg, Dwarf_Off offset,
-    Dwarf_Bool is_info)
-{
-    Dwarf_CU_Context cu_context = 0;
-    Dwarf_Debug_InfoTypes dis = is_info? &dbg->de_info_reading:
-        &dbg->de_types_reading;
-
-    for (cu_context = dis->de_offdie_cu_context;
-        cu_context != NULL; cu_context = cu_context->cc_next)
-
-        if (offset >= cu_context->cc_debug_offset &&
-            offset < cu_context->cc_debug_offset +
-            cu_context->cc_length + cu_context->cc_length_size
-            + cu_context->cc_extension_size)
-
-            return (cu_context);
-
-    return (NULL);
+    i = cu_context_index_search(dis,offset);
+    if (i < 0) {
+        return NULL;
+    }
+    if (cu_context_contains(dis->de_cu_context_index[i],offset)) {
+        return dis->de_cu_context_index[i];
+    }
+    return NULL;
 }
 
 int
@@ -475,16 +516,29 @@ _dwarf_make_CU_Context(Dwarf_Debug dbg,
         return DW_DLV_ERROR;
     }
 
-    cu_context->cc_abbrev_hash_table =
-        (Dwarf_Hash_Table) _dwarf_get_alloc(dbg, DW_DLA_HASH_TABLE, 1);
-    if (cu_context->cc_abbrev_hash_table == NULL) {
-        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
-        return DW_DLV_ERROR;
+    {
+        int tres = _dwarf_get_abbrev_table(cu_context,
+            &cu_context->cc_abbrev_table,error);
+        if (tres != DW_DLV_OK) {
+            dwarf_dealloc(dbg, cu_context, DW_DLA_CU_CONTEXT);
+            return tres;
+        }
     }
 
     cu_context->cc_debug_offset = offset;
 
-    dis->de_last_offset = max_cu_global_offset;
+    {
+        int ires = cu_context_index_insert(dbg,dis,cu_context,error);
+        if (ires != DW_DLV_OK) {
+            dwarf_dealloc(dbg, cu_context, DW_DLA_CU_CONTEXT);
+            return ires;
+        }
+    }
+    /*  Contexts may be made out of section order
+        (see dwarf_offdie_b()) so keep the maximum. */
+    if (max_cu_global_offset > dis->de_last_offset) {
+        dis->de_last_offset = max_cu_global_offset;
+    }
 
     if (dis->de_cu_context_list == NULL) {
         dis->de_cu_context_list = cu_context;
@@ -769,6 +823,97 @@ find_context_base_fields(Dwarf_Debug dbg,
 }
 
 
+/*  Look for DW_AT_dwo_id in the CU die of cu_context and
+    if there is one pick up the hash and the base array.
+    Also pick up cc_str_offset_base.
+    The CU die is read as dwarf_siblingof_b(dbg,NULL,...)
+    reads it, with cu_context briefly made the current
+    context, so the dwarf_next_cu_header_d() position
+    is unchanged.
+    If dwo_id_out is non-null the DW_AT_dwo_id
+    (or DW_AT_GNU_dwo_id), if any, is returned through it
+    and the cu_context is left as it was. */
+static int
+fill_in_cu_context_base_fields(Dwarf_Debug dbg,
+    Dwarf_CU_Context cu_context,
+    Dwarf_Bool is_info,
+    Dwarf_Sig8 *dwo_id_out,
+    Dwarf_Bool *dwo_id_present_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Die cudie = 0;
+    Dwarf_Debug_InfoTypes dis = is_info? &dbg->de_info_reading:
+        &dbg->de_types_reading;
+    Dwarf_CU_Context saved_context = dis->de_cu_context;
+    int resdwo = 0;
+
+    dis->de_cu_context = cu_context;
+    resdwo = dwarf_siblingof_b(dbg,NULL,is_info,
+        &cudie, error);
+    dis->de_cu_context = saved_context;
+    if (resdwo == DW_DLV_OK) {
+        int dwo_idres = 0;
+        Dwarf_Sig8 dwosignature;
+        Dwarf_Bool sig_present = FALSE;
+        Dwarf_Unsigned str_offsets_base = 0;
+        Dwarf_Unsigned addr_base = 0;
+        Dwarf_Unsigned ranges_base = 0;
+        Dwarf_Bool str_offsets_base_present = FALSE;
+        Dwarf_Bool addr_base_present = FALSE;
+        Dwarf_Bool ranges_base_present = FALSE;
+
+        memset(&dwosignature,0,sizeof(dwosignature));
+        dwo_idres = find_context_base_fields(dbg,
+            cudie,&dwosignature,&sig_present,
+            &str_offsets_base,&str_offsets_base_present,
+            &addr_base,&addr_base_present,
+            &ranges_base,&ranges_base_present,
+            error);
+        dwarf_dealloc(dbg,cudie,DW_DLA_DIE);
+        if (dwo_idres != DW_DLV_OK) {
+            /*  As always, a CU die we cannot read
+                base fields from leaves them absent. */
+            return DW_DLV_OK;
+        }
+        if (dwo_id_out) {
+            *dwo_id_out = dwosignature;
+            *dwo_id_present_out = sig_present;
+            return DW_DLV_OK;
+        }
+        if(sig_present) {
+            /*  This can be in executable or ordinary .o
+                or .dwo or .dwp */
+            cu_context->cc_type_signature = dwosignature;
+            cu_context->cc_signature_present = TRUE;
+        }
+        if (addr_base_present) {
+            /* This can be in executable or ordinary .o */
+            cu_context->cc_addr_base = addr_base;
+            cu_context->cc_addr_base_present = TRUE;
+        }
+
+        if(str_offsets_base_present) {
+            /*  This can be in executable or ordinary .o
+                or .dwo or .dwp */
+            cu_context->cc_str_offsets_base = str_offsets_base;
+            cu_context->cc_str_offsets_base_present = TRUE;
+        }
+        if(ranges_base_present) {
+            /*  This can be in executable or ordinary .o */
+            cu_context->cc_ranges_base = ranges_base;
+            cu_context->cc_ranges_base_present = TRUE;
+        }
+    } else if (resdwo == DW_DLV_NO_ENTRY) {
+        /* Impossible */
+        _dwarf_error(NULL, error, DW_DLE_DWP_SIBLING_ERROR);
+        return DW_DLV_ERROR;
+    } else {
+        /* Something is badly wrong. */
+        return resdwo;
+    }
+    return DW_DLV_OK;
+}
+
 int
 _dwarf_next_cu_header_internal(Dwarf_Debug dbg,
     Dwarf_Bool is_info,
@@ -905,69 +1050,18 @@ _dwarf_next_cu_header_internal(Dwarf_Debug dbg,
         *header_type = cu_context->cc_unit_type;
     }
 
+    /*  A dbg with a tied object needs the DW_AT_dwo_id
+        of its CUs to find the matching tied CU. */
     if ( (dbg->de_tied_data.td_is_tied_object ||
+        dbg->de_tied_data.td_tied_object ||
         _dwarf_file_has_debug_fission_cu_index(dbg)) &&
         (cu_context->cc_unit_type == DW_UT_compile ||
             cu_context->cc_unit_type == DW_UT_partial)) {
         /*  ASSERT: !cu_context->cc_type_signature_present */
-        /*  Look for DW_AT_dwo_id and
-            if there is one pick up the hash
-            and the base array.
-            Also pick up cc_str_offset_base. */
-        Dwarf_Die cudie = 0;
-
-        int resdwo = dwarf_siblingof_b(dbg,NULL,is_info,
-            &cudie, error);
-        if (resdwo == DW_DLV_OK) {
-            int dwo_idres = 0;
-            Dwarf_Sig8 dwosignature;
-            Dwarf_Bool sig_present = FALSE;
-            Dwarf_Unsigned str_offsets_base = 0;
-            Dwarf_Unsigned addr_base = 0;
-            Dwarf_Unsigned ranges_base = 0;
-            Dwarf_Bool str_offsets_base_present = FALSE;
-            Dwarf_Bool addr_base_present = FALSE;
-            Dwarf_Bool ranges_base_present = FALSE;
-            dwo_idres = find_context_base_fields(dbg,
-                cudie,&dwosignature,&sig_present,
-                &str_offsets_base,&str_offsets_base_present,
-                &addr_base,&addr_base_present,
-                &ranges_base,&ranges_base_present,
-                error);
-
-            if (dwo_idres == DW_DLV_OK) {
-                if(sig_present) {
-                    /*  This can be in executable or ordinary .o
-                        or .dwo or .dwp */
-                    cu_context->cc_type_signature = dwosignature;
-                    cu_context->cc_signature_present = TRUE;
-                }
-                if (addr_base_present) {
-                    /* This can be in executable or ordinary .o */
-                    cu_context->cc_addr_base = addr_base;
-                    cu_context->cc_addr_base_present = TRUE;
-                }
-
-                if(str_offsets_base_present) {
-                    /*  This can be in executable or ordinary .o
-                        or .dwo or .dwp */
-                    cu_context->cc_str_offsets_base = str_offsets_base;
-                    cu_context->cc_str_offsets_base_present = TRUE;
-                }
-                if(ranges_base_present) {
-                    /*  This can be in executable or ordinary .o */
-                    cu_context->cc_ranges_base = ranges_base;
-                    cu_context->cc_ranges_base_present = TRUE;
-                }
-            }
-            dwarf_dealloc(dbg,cudie,DW_DLA_DIE);
-        } else if (resdwo == DW_DLV_NO_ENTRY) {
-            /* Impossible */
-            _dwarf_error(NULL, error, DW_DLE_DWP_SIBLING_ERROR);
-            return DW_DLV_ERROR;
-        } else {
-            /* Something is badly wrong. */
-            return resdwo;
+        res = fill_in_cu_context_base_fields(dbg,cu_context,
+            is_info,0,0,error);
+        if (res != DW_DLV_OK) {
+            return res;
         }
     }
     if (typeoffset) {
@@ -1005,8 +1099,10 @@ _dwarf_next_cu_header_internal(Dwarf_Debug dbg,
     is present in the applicable index but no matching
     compilation unit can be found, it returns DW_DLV_ERROR.
 
-    If a .dwo object there is no index and we look at the
-    compilation units (possibly all of them). If not present
+    If a .dwo object (or any object with type units) there
+    is no package index and we use the signature index of
+    the dbg (see dwarf_sig_index.c), built from the unit
+    headers on the first call. If not present
     then we return DW_DLV_NO_ENTRY.
 
     The returned_die is a CU DIE if the sig_type is "cu".
@@ -1104,13 +1200,51 @@ dwarf_die_from_hash_signature(Dwarf_Debug dbg,
         dwarf_dealloc(dbg,cudie,DW_DLA_DIE);
         return DW_DLV_OK;
     }
-    /*  Look thru all the CUs, there is no DWP tu/cu index.
+    /*  There is no DWP tu/cu index.
         There will be COMDAT sections for  the type TUs
             (DW_UT_type).
-        A single non-comdat for the DW_UT_compile. */
-    /*  FIXME: DW_DLE_DEBUG_FISSION_INCOMPLETE  */
-    _dwarf_error(dbg,error,DW_DLE_DEBUG_FISSION_INCOMPLETE);
-    return DW_DLV_ERROR;
+        A single non-comdat for the DW_UT_compile.
+        The signature index finds either in one pass
+        over the unit headers, done on the first call. */
+    {
+        int sres2 = 0;
+        Dwarf_Off cu_die_off = 0;
+        Dwarf_CU_Context context = 0;
+        struct Dwarf_Sig_Index_Entry_s *sent = 0;
+
+        if (is_type_unit) {
+            sres2 = _dwarf_sig_index_find_tu(dbg,hash_sig,
+                &sent,error);
+        } else {
+            sres2 = _dwarf_sig_index_find_cu(dbg,hash_sig,
+                &sent,error);
+        }
+        if (sres2 != DW_DLV_OK) {
+            return sres2;
+        }
+        if (!is_type_unit) {
+            sres2 = dwarf_get_cu_die_offset_given_cu_header_offset_b(
+                dbg,sent->se_offset,TRUE,
+                &cu_die_off,error);
+            if (sres2 != DW_DLV_OK) {
+                return sres2;
+            }
+            return dwarf_offdie_b(dbg,cu_die_off,TRUE,
+                returned_die,error);
+        }
+        /*  Make just this one context so dwarf_offdie_b()
+            need not read the headers of the units
+            before it. */
+        sres2 = _dwarf_get_cu_context_at_offset(dbg,
+            sent->se_offset,sent->se_is_info,
+            &context,0,0,error);
+        if (sres2 != DW_DLV_OK) {
+            return sres2;
+        }
+        return dwarf_offdie_b(dbg,
+            sent->se_offset + sent->se_type_offset,
+            sent->se_is_info,returned_die,error);
+    }
 }
 
 static int
@@ -1232,15 +1366,15 @@ _dwarf_next_die_info_ptr(Dwarf_Byte_Ptr die_info_ptr,
     Dwarf_Error *error)
 {
     Dwarf_Byte_Ptr info_ptr = 0;
-    Dwarf_Byte_Ptr abbrev_ptr = 0;
     Dwarf_Word abbrev_code = 0;
     Dwarf_Abbrev_List abbrev_list = 0;
     Dwarf_Half attr = 0;
     Dwarf_Half attr_form = 0;
     Dwarf_Unsigned offset = 0;
     Dwarf_Unsigned utmp = 0;
+    Dwarf_Unsigned fixed_size = 0;
+    Dwarf_Unsigned i = 0;
     Dwarf_Debug dbg = 0;
-    Dwarf_Byte_Ptr abbrev_end = 0;
     int lres = 0;
 
     info_ptr = die_info_ptr;
@@ -1266,16 +1400,23 @@ _dwarf_next_die_info_ptr(Dwarf_Byte_Ptr die_info_ptr,
 
     *has_die_child = abbrev_list->abl_has_child;
 
-    abbrev_ptr = abbrev_list->abl_abbrev_ptr;
-    abbrev_end = _dwarf_calculate_abbrev_section_end_ptr(cu_context);
+    if (!(want_AT_sibling && abbrev_list->abl_has_sibling) &&
+        _dwarf_abbrev_fixed_size(cu_context,abbrev_list,&fixed_size)) {
+        /*  New October 2026. Every value has a size known
+            from the abbreviation: step over them all at once. */
+        if (fixed_size > (Dwarf_Unsigned)(die_info_end - info_ptr)) {
+            _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_PAST_END);
+            return DW_DLV_ERROR;
+        }
+        *next_die_ptr_out = info_ptr + fixed_size;
+        return DW_DLV_OK;
+    }
 
-    do {
-        Dwarf_Unsigned utmp2;
+    for (i = 0; i < abbrev_list->abl_count; ++i) {
+        struct Dwarf_Abbrev_Attr_s *aa = abbrev_list->abl_attrs + i;
 
-        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp2,dbg,error,abbrev_end);
-        attr = (Dwarf_Half) utmp2;
-        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp2,dbg,error,abbrev_end);
-        attr_form = (Dwarf_Half) utmp2;
+        attr = aa->aa_attr;
+        attr_form = aa->aa_form;
         if (attr_form == DW_FORM_indirect) {
             Dwarf_Unsigned utmp6;
 
@@ -1346,18 +1487,15 @@ _dwarf_next_die_info_ptr(Dwarf_Byte_Ptr die_info_ptr,
         }
 
         no_sibling_attr:
-        if (attr_form != 0) {
+        {
             int res = 0;
             Dwarf_Unsigned sizeofval = 0;
             ptrdiff_t  sizeb = 0;
-            res = _dwarf_get_size_of_val(cu_context->cc_dbg,
-                attr_form,
-                cu_context->cc_version_stamp,
-                cu_context->cc_address_size,
+            res = ABBREV_ATTR_VALUE_SIZE(cu_context,
+                aa,attr_form,
                 info_ptr,
-                cu_context->cc_length_size,
-                &sizeofval,
                 die_info_end,
+                &sizeofval,
                 error);
             if(res != DW_DLV_OK) {
                 return res;
@@ -1378,11 +1516,95 @@ _dwarf_next_die_info_ptr(Dwarf_Byte_Ptr die_info_ptr,
                 return DW_DLV_ERROR;
             }
         }
-    } while (attr != 0 || attr_form != 0);
+    }
     *next_die_ptr_out = info_ptr;
     return DW_DLV_OK;
 }
 
+/*  The deepest subtree nesting whose ends
+    dwarf_siblingof_b() records. */
+#define SIBLING_STACK_MAX 64
+
+/*  Returns TRUE and the CU-relative offset just past the
+    subtree of the DIE at CU-relative offset die_off if
+    it was recorded. */
+static Dwarf_Bool
+sibling_cache_find(Dwarf_CU_Context context,
+    Dwarf_Unsigned die_off,
+    Dwarf_Unsigned *sibling_off_out)
+{
+    Dwarf_Unsigned mask = 0;
+    Dwarf_Unsigned s = 0;
+
+    if (!context->cc_sibling_count) {
+        return FALSE;
+    }
+    mask = context->cc_sibling_slot_count - 1;
+    s = (die_off * 0x9e3779b1) & mask;
+    for (;; s = (s+1) & mask) {
+        struct Dwarf_Sibling_Slot_s *slot = context->cc_sibling_slots + s;
+
+        if (!slot->ss_die) {
+            return FALSE;
+        }
+        if (slot->ss_die == die_off+1) {
+            *sibling_off_out = slot->ss_sibling;
+            return TRUE;
+        }
+    }
+}
+
+/*  Records the end of a subtree.  The table is only
+    a cache: if it cannot grow the entry is dropped.  */
+static void
+sibling_cache_add(Dwarf_CU_Context context,
+    Dwarf_Unsigned die_off,
+    Dwarf_Unsigned sibling_off)
+{
+    Dwarf_Unsigned mask = 0;
+    Dwarf_Unsigned s = 0;
+
+    /*  Keep the load factor at most 3/4. */
+    if ((context->cc_sibling_count+1)*4 >
+        context->cc_sibling_slot_count*3) {
+        struct Dwarf_Sibling_Slot_s *old = context->cc_sibling_slots;
+        Dwarf_Unsigned oldcount = context->cc_sibling_slot_count;
+        Dwarf_Unsigned newcount = oldcount? oldcount*2: 64;
+        Dwarf_Unsigned i = 0;
+
+        context->cc_sibling_slots = (struct Dwarf_Sibling_Slot_s *)
+            calloc(newcount,sizeof(struct Dwarf_Sibling_Slot_s));
+        if (!context->cc_sibling_slots) {
+            context->cc_sibling_slots = old;
+            return;
+        }
+        context->cc_sibling_slot_count = newcount;
+        context->cc_sibling_count = 0;
+        for (i = 0; i < oldcount; ++i) {
+            if (old[i].ss_die) {
+                sibling_cache_add(context,old[i].ss_die-1,
+                    old[i].ss_sibling);
+            }
+        }
+        free(old);
+    }
+    mask = context->cc_sibling_slot_count - 1;
+    s = (die_off * 0x9e3779b1) & mask;
+    for (;; s = (s+1) & mask) {
+        struct Dwarf_Sibling_Slot_s *slot = context->cc_sibling_slots + s;
+
+        if (slot->ss_die == die_off+1) {
+            return;
+        }
+        if (!slot->ss_die) {
+            slot->ss_die = die_off+1;
+            slot->ss_sibling = sibling_off;
+            context->cc_sibling_count++;
+            return;
+        }
+    }
+}
+
 /*  Multiple TAGs are in fact compile units.
     Allow them all.
     Return non-zero if a CU tag.
@@ -1496,6 +1718,10 @@ dwarf_siblingof_b(Dwarf_Debug dbg,
         Dwarf_Bool has_child = false;
         Dwarf_Sword child_depth = 0;
         Dwarf_CU_Context context=0;
+        Dwarf_Unsigned sibling_off = 0;
+        /*  The DIEs whose children are being walked,
+            by depth, to record where their subtrees end. */
+        Dwarf_Byte_Ptr parent_ptrs[SIBLING_STACK_MAX];
 
         /*  We cannot have a legal die unless debug_info was loaded, so
             no need to load debug_info here. */
@@ -1512,80 +1738,102 @@ dwarf_siblingof_b(Dwarf_Debug dbg,
         if ((*die_info_ptr) == 0) {
             return (DW_DLV_NO_ENTRY);
         }
-        child_depth = 0;
-        do {
-            int res2 = 0;
-            Dwarf_Byte_Ptr die_info_ptr2 = 0;
-            res2 = _dwarf_next_die_info_ptr(die_info_ptr,
-                die->di_cu_context, die_info_end,
-                cu_info_start, true, &has_child,
-                &die_info_ptr2,
-                error);
-            if(res2 != DW_DLV_OK) {
-                return res2;
-            }
-            if (die_info_ptr2 < die_info_ptr) {
-                /*  There is something very wrong, our die value
-                    decreased.  Bad DWARF. */
-                _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_LOW_ERROR);
-                return (DW_DLV_ERROR);
-            }
-            if (die_info_ptr2 > die_info_end) {
-                _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_PAST_END);
-                return (DW_DLV_ERROR);
-            }
-            die_info_ptr = die_info_ptr2;
-
-            /*  die_info_end is one past end. Do not read it!
-                A test for ``!= die_info_end''  would work as well,
-                but perhaps < reads more like the meaning. */
-            if (die_info_ptr < die_info_end) {
-                if ((*die_info_ptr) == 0 && has_child) {
-                    die_info_ptr++;
-                    has_child = false;
+        if (die->di_abbrev_list && die->di_abbrev_list->abl_has_child &&
+            sibling_cache_find(context,die_info_ptr - cu_info_start,
+                &sibling_off)) {
+            /*  This subtree was walked before. */
+            die_info_ptr = cu_info_start + sibling_off;
+        } else {
+            child_depth = 0;
+            do {
+                int res2 = 0;
+                Dwarf_Byte_Ptr die_info_ptr2 = 0;
+                Dwarf_Byte_Ptr this_die_ptr = die_info_ptr;
+
+                res2 = _dwarf_next_die_info_ptr(die_info_ptr,
+                    die->di_cu_context, die_info_end,
+                    cu_info_start, true, &has_child,
+                    &die_info_ptr2,
+                    error);
+                if(res2 != DW_DLV_OK) {
+                    return res2;
                 }
-            }
-
-            /*  die_info_ptr can be one-past-end.  */
-            if ((die_info_ptr == die_info_end) ||
-                ((*die_info_ptr) == 0)) {
-                /* We are at the end of a sibling list.
-                    get back to the next containing
-                    sibling list (looking for a libling
-                    list with more on it).
-                    */
-                for (;;) {
-                    if (child_depth == 0) {
-                        /*  Meaning there is no outer list,
-                            so stop. */
-                        break;
+                if (die_info_ptr2 < die_info_ptr) {
+                    /*  There is something very wrong, our die value
+                        decreased.  Bad DWARF. */
+                    _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_LOW_ERROR);
+                    return (DW_DLV_ERROR);
+                }
+                if (die_info_ptr2 > die_info_end) {
+                    _dwarf_error(dbg, error, DW_DLE_NEXT_DIE_PAST_END);
+                    return (DW_DLV_ERROR);
+                }
+                die_info_ptr = die_info_ptr2;
+
+                /*  die_info_end is one past end. Do not read it!
+                    A test for ``!= die_info_end''  would work as well,
+                    but perhaps < reads more like the meaning. */
+                if (die_info_ptr < die_info_end) {
+                    if ((*die_info_ptr) == 0 && has_child) {
+                        die_info_ptr++;
+                        has_child = false;
                     }
-                    if (die_info_ptr == die_info_end) {
-                        /*  September 2016: do not deref
-                            if we are past end.
-                            If we are at end at this point
-                            it means the sibling list
-                            inside this CU is not properly
-                            terminated. We run off the end.
-                            An error.*/
-                        _dwarf_error(dbg, error,DW_DLE_SIBLING_LIST_IMPROPER);
-                        return (DW_DLV_ERROR);
+                }
+
+                /*  die_info_ptr can be one-past-end.  */
+                if ((die_info_ptr == die_info_end) ||
+                    ((*die_info_ptr) == 0)) {
+                    /* We are at the end of a sibling list.
+                        get back to the next containing
+                        sibling list (looking for a libling
+                        list with more on it).
+                        */
+                    for (;;) {
+                        if (child_depth == 0) {
+                            /*  Meaning there is no outer list,
+                                so stop. */
+                            break;
+                        }
+                        if (die_info_ptr == die_info_end) {
+                            /*  September 2016: do not deref
+                                if we are past end.
+                                If we are at end at this point
+                                it means the sibling list
+                                inside this CU is not properly
+                                terminated. We run off the end.
+                                An error.*/
+                            _dwarf_error(dbg, error,
+                                DW_DLE_SIBLING_LIST_IMPROPER);
+                            return (DW_DLV_ERROR);
+                        }
+                        if (*die_info_ptr) {
+                            /* We have a real sibling. */
+                            break;
+                        }
+                        /*  Move out one DIE level.
+                            Move past NUL byte marking end of
+                            this sibling list. */
+                        child_depth--;
+                        die_info_ptr++;
+                        /*  That ended the subtree of the DIE
+                            whose children we were in.
+                            The cache is not grown in
+                            concurrent-read mode. */
+                        if (child_depth < SIBLING_STACK_MAX &&
+                            !dbg->de_concurrent) {
+                            sibling_cache_add(context,
+                                parent_ptrs[child_depth] - cu_info_start,
+                                die_info_ptr - cu_info_start);
+                        }
                     }
-                    if (*die_info_ptr) {
-                        /* We have a real sibling. */
-                        break;
+                } else if (has_child) {
+                    if (child_depth < SIBLING_STACK_MAX) {
+                        parent_ptrs[child_depth] = this_die_ptr;
                     }
-                    /*  Move out one DIE level.
-                        Move past NUL byte marking end of
-                        this sibling list. */
-                    child_depth--;
-                    die_info_ptr++;
+                    child_depth++;
                 }
-            } else {
-                child_depth = has_child ? child_depth + 1 : child_depth;
-            }
-
-        } while (child_depth != 0);
+            } while (child_depth != 0);
+        }
     }
 
     /*  die_info_ptr > die_info_end is really a bug (possibly in dwarf
@@ -1646,6 +1894,29 @@ dwarf_siblingof_b(Dwarf_Debug dbg,
     return (DW_DLV_OK);
 }
 
+/*  Records where dwarf_child() stopped, for
+    dwarf_validate_die_sibling().  If end is non-null
+    the NUL bytes ending sibling lists are skipped.
+    Not in concurrent-read mode, as the position is
+    per dbg, not per thread. */
+static void
+record_last_di_ptr(Dwarf_Debug dbg,
+    Dwarf_Debug_InfoTypes dis,
+    Dwarf_Die die,
+    Dwarf_Byte_Ptr ptr,
+    Dwarf_Byte_Ptr end)
+{
+    if (dbg->de_concurrent) {
+        return;
+    }
+    if (end) {
+        while (ptr < end && !*ptr) {
+            ++ptr;
+        }
+    }
+    dis->de_last_die = die;
+    dis->de_last_di_ptr = ptr;
+}
 
 int
 dwarf_child(Dwarf_Die die,
@@ -1675,8 +1946,7 @@ dwarf_child(Dwarf_Die die,
 
     /*  We are saving a DIE pointer here, but the pointer
         will not be presumed live later, when it is tested. */
-    dis->de_last_die = die;
-    dis->de_last_di_ptr = die_info_ptr;
+    record_last_di_ptr(dbg,dis,die,die_info_ptr,0);
 
     /* NULL die has no child. */
     if ((*die_info_ptr) == 0) {
@@ -1699,18 +1969,12 @@ dwarf_child(Dwarf_Die die,
     }
     die_info_ptr = die_info_ptr2;
 
-    dis->de_last_di_ptr = die_info_ptr;
-
     if (!has_die_child) {
         /* Look for end of sibling chain. */
-        while (dis->de_last_di_ptr < die_info_end) {
-            if (*dis->de_last_di_ptr) {
-                break;
-            }
-            ++dis->de_last_di_ptr;
-        }
+        record_last_di_ptr(dbg,dis,die,die_info_ptr,die_info_end);
         return DW_DLV_NO_ENTRY;
     }
+    record_last_di_ptr(dbg,dis,die,die_info_ptr,0);
 
     ret_die = (Dwarf_Die) _dwarf_get_alloc(dbg, DW_DLA_DIE, 1);
     if (ret_die == NULL) {
@@ -1725,17 +1989,10 @@ dwarf_child(Dwarf_Die die,
         dbg,error,die_info_end);
     abbrev_code = (Dwarf_Word) utmp;
 
-    dis->de_last_di_ptr = die_info_ptr;
-
+    /* For a 0 code look for end of sibling chain. */
+    record_last_di_ptr(dbg,dis,die,die_info_ptr,
+        abbrev_code? 0: die_info_end);
     if (abbrev_code == 0) {
-        /* Look for end of sibling chain */
-        while (dis->de_last_di_ptr < die_info_end) {
-            if (*dis->de_last_di_ptr) {
-                break;
-            }
-            ++dis->de_last_di_ptr;
-        }
-
         /*  We have arrived at a null DIE, at the end of a CU or the end
             of a list of siblings. */
         *caller_ret_die = 0;
@@ -1759,6 +2016,175 @@ dwarf_child(Dwarf_Die die,
     return (DW_DLV_OK);
 }
 
+/*  Makes CU contexts, in section order, from the end
+    of the last known CU before offset up to and
+    including the CU containing offset.
+    Returns the CU context containing offset.  */
+static int
+make_cu_contexts_through_offset(Dwarf_Debug dbg,
+    Dwarf_Off offset, Dwarf_Bool is_info,
+    Dwarf_CU_Context *context_out,
+    Dwarf_Error *error)
+{
+    Dwarf_CU_Context cu_context = 0;
+    Dwarf_Off new_cu_offset = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Debug_InfoTypes dis = is_info? &dbg->de_info_reading:
+        &dbg->de_types_reading;
+    Dwarf_Unsigned section_size = is_info? dbg->de_debug_info.dss_size:
+        dbg->de_debug_types.dss_size;
+
+    i = cu_context_index_search(dis,offset);
+    if (i >= 0) {
+        /*  Not containing offset (or we would not be here),
+            so the next unknown CU starts right after it. */
+        Dwarf_CU_Context lcu_context = dis->de_cu_context_index[i];
+
+        new_cu_offset =
+            lcu_context->cc_debug_offset +
+            lcu_context->cc_length +
+            lcu_context->cc_length_size +
+            lcu_context->cc_extension_size;
+    }
+    do {
+        int res = 0;
+
+        if ((new_cu_offset +
+            _dwarf_length_of_cu_header_simple(dbg,is_info)) >=
+            section_size) {
+            _dwarf_error(dbg, error, DW_DLE_OFFSET_BAD);
+            return DW_DLV_ERROR;
+        }
+        res = _dwarf_make_CU_Context(dbg, new_cu_offset,is_info,
+            &cu_context,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        new_cu_offset = new_cu_offset + cu_context->cc_length +
+            cu_context->cc_length_size +
+            cu_context->cc_extension_size;
+    } while (offset >= new_cu_offset);
+    *context_out = cu_context;
+    return DW_DLV_OK;
+}
+
+/*  Reads every CU header of .debug_info (is_info TRUE)
+    or .debug_types (is_info FALSE) in one pass, creating
+    any CU context not already known, so that later
+    dwarf_offdie_b() calls (and other offset to CU lookups)
+    never need to read CU headers and cost O(log n).
+    Does not change the dwarf_next_cu_header_d() position.
+    Returns the number of CUs through *cu_count_out.
+    New October 2026. */
+int
+dwarf_preload_cu_headers(Dwarf_Debug dbg,
+    Dwarf_Bool is_info,
+    Dwarf_Unsigned *cu_count_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Off new_cu_offset = 0;
+    Dwarf_Unsigned section_size = 0;
+    Dwarf_Unsigned header_size = 0;
+    Dwarf_Debug_InfoTypes dis = 0;
+    int res = 0;
+
+    if (dbg == NULL) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    dis = is_info? &dbg->de_info_reading: &dbg->de_types_reading;
+    res = is_info?_dwarf_load_debug_info(dbg, error):
+        _dwarf_load_debug_types(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    section_size = is_info? dbg->de_debug_info.dss_size:
+        dbg->de_debug_types.dss_size;
+    header_size = _dwarf_length_of_cu_header_simple(dbg,is_info);
+    while ((new_cu_offset + header_size) < section_size) {
+        Dwarf_CU_Context cu_context =
+            _dwarf_find_CU_Context(dbg,new_cu_offset,is_info);
+
+        if (!cu_context) {
+            res = _dwarf_make_CU_Context(dbg, new_cu_offset,is_info,
+                &cu_context,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        }
+        new_cu_offset = cu_context->cc_debug_offset +
+            cu_context->cc_length +
+            cu_context->cc_length_size +
+            cu_context->cc_extension_size;
+    }
+    if (cu_count_out) {
+        *cu_count_out = dis->de_cu_context_index_count;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Returns the CU context of the unit whose header
+    begins at offset, making that one context (and no other)
+    if it is not yet known.  For the signature index,
+    which records unit header offsets as it scans.
+    For a compile or partial unit the CU die base fields
+    are filled in just as dwarf_next_cu_header_d() would
+    fill them, and if dwo_id_out is non-null the
+    DW_AT_dwo_id of the CU die (if any) is returned
+    through it.
+    New October 2026. */
+int
+_dwarf_get_cu_context_at_offset(Dwarf_Debug dbg,
+    Dwarf_Off offset, Dwarf_Bool is_info,
+    Dwarf_CU_Context *context_out,
+    Dwarf_Sig8 *dwo_id_out,
+    Dwarf_Bool *dwo_id_present_out,
+    Dwarf_Error *error)
+{
+    Dwarf_CU_Context cu_context = 0;
+    int res = 0;
+
+    cu_context = _dwarf_find_CU_Context(dbg,offset,is_info);
+    if (!cu_context) {
+        res = _dwarf_make_CU_Context(dbg,offset,is_info,
+            &cu_context,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (cu_context->cc_debug_offset != offset) {
+        _dwarf_error(dbg, error, DW_DLE_OFFSET_BAD);
+        return DW_DLV_ERROR;
+    }
+    if (cu_context->cc_unit_type == DW_UT_compile ||
+        cu_context->cc_unit_type == DW_UT_partial) {
+        if ((dbg->de_tied_data.td_is_tied_object ||
+            dbg->de_tied_data.td_tied_object ||
+            _dwarf_file_has_debug_fission_cu_index(dbg)) &&
+            !cu_context->cc_signature_present) {
+            res = fill_in_cu_context_base_fields(dbg,cu_context,
+                is_info,0,0,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        }
+        if (dwo_id_out) {
+            if (cu_context->cc_signature_present) {
+                *dwo_id_out = cu_context->cc_type_signature;
+                *dwo_id_present_out = TRUE;
+            } else {
+                res = fill_in_cu_context_base_fields(dbg,cu_context,
+                    is_info,dwo_id_out,dwo_id_present_out,error);
+                if (res != DW_DLV_OK) {
+                    return res;
+                }
+            }
+        }
+    }
+    *context_out = cu_context;
+    return DW_DLV_OK;
+}
+
 /*  Given a (global, not cu_relative) die offset, this returns
     a pointer to a DIE thru *new_die.
     It is up to the caller to do a
@@ -1780,73 +2206,35 @@ dwarf_offdie_b(Dwarf_Debug dbg,
     Dwarf_Die * new_die, Dwarf_Error * error)
 {
     Dwarf_CU_Context cu_context = 0;
-    Dwarf_Off new_cu_offset = 0;
     Dwarf_Die die = 0;
     Dwarf_Byte_Ptr info_ptr = 0;
     Dwarf_Unsigned abbrev_code = 0;
     Dwarf_Unsigned utmp = 0;
     int lres = 0;
-    Dwarf_Debug_InfoTypes dis = 0;
     Dwarf_Byte_Ptr die_info_end = 0;
 
     if (dbg == NULL) {
         _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
         return (DW_DLV_ERROR);
     }
-    dis = is_info? &dbg->de_info_reading:
-        &dbg->de_types_reading;
 
     cu_context = _dwarf_find_CU_Context(dbg, offset,is_info);
     if (cu_context == NULL) {
-        cu_context = _dwarf_find_offdie_CU_Context(dbg, offset,is_info);
-    }
+        int res = 0;
 
-    if (cu_context == NULL) {
-        Dwarf_Unsigned section_size = is_info? dbg->de_debug_info.dss_size:
-            dbg->de_debug_types.dss_size;
-        int res = is_info?_dwarf_load_debug_info(dbg, error):
+        /*  In concurrent-read mode every CU context
+            was made already, this just reports the bad offset. */
+        DWARF_BUILD_LOCK(dbg);
+        res = is_info?_dwarf_load_debug_info(dbg, error):
             _dwarf_load_debug_types(dbg,error);
-
+        if (res == DW_DLV_OK) {
+            res = make_cu_contexts_through_offset(dbg,offset,is_info,
+                &cu_context,error);
+        }
+        DWARF_BUILD_UNLOCK(dbg);
         if (res != DW_DLV_OK) {
             return res;
         }
-
-        if (dis->de_offdie_cu_context_end != NULL) {
-            Dwarf_CU_Context lcu_context =
-                dis->de_offdie_cu_context_end;
-            new_cu_offset =
-                lcu_context->cc_debug_offset +
-                lcu_context->cc_length +
-                lcu_context->cc_length_size +
-                lcu_context->cc_extension_size;
-        }
-
-
-        do {
-            if ((new_cu_offset +
-                _dwarf_length_of_cu_header_simple(dbg,is_info)) >=
-                section_size) {
-                _dwarf_error(dbg, error, DW_DLE_OFFSET_BAD);
-                return (DW_DLV_ERROR);
-            }
-            res = _dwarf_make_CU_Context(dbg, new_cu_offset,is_info,
-                &cu_context,error);
-            if (res != DW_DLV_OK) {
-                return res;
-            }
-            if (dis->de_offdie_cu_context == NULL) {
-                dis->de_offdie_cu_context = cu_context;
-                dis->de_offdie_cu_context_end = cu_context;
-            } else {
-                dis->de_offdie_cu_context_end->cc_next = cu_context;
-                dis->de_offdie_cu_context_end = cu_context;
-            }
-
-            new_cu_offset = new_cu_offset + cu_context->cc_length +
-                cu_context->cc_length_size +
-                cu_context->cc_extension_size;
-
-        } while (offset >= new_cu_offset);
     }
 
     die_info_end = _dwarf_calculate_info_section_end_ptr(cu_context);
@@ -28,6 +28,29 @@
 
 
 
+/*  How the size of an attribute value is found,
+    see struct Dwarf_Abbrev_Attr_s.  */
+#define DW_ABB_SIZE_FIXED    0 /* aa_fixed_size bytes */
+#define DW_ABB_SIZE_ADDRESS  1 /* The CU address size. */
+#define DW_ABB_SIZE_OFFSET   2 /* The CU offset size. */
+#define DW_ABB_SIZE_REF_ADDR 3 /* Address size in DWARF2, else offset. */
+#define DW_ABB_SIZE_VARIABLE 4 /* Read from the value itself. */
+
+/*  New October 2026.
+    One attribute/form pair of an abbreviation, decoded
+    once when the abbreviation is read so the DIE readers
+    need not decode the LEB128 pairs again for every DIE
+    and every attribute lookup.
+    Whether the size of the value is known from the form
+    alone (and the CU address and offset sizes) is in
+    aa_size_kind.  */
+struct Dwarf_Abbrev_Attr_s {
+    Dwarf_Half  aa_attr;
+    Dwarf_Half  aa_form;
+    Dwarf_Small aa_size_kind;
+    Dwarf_Small aa_fixed_size;
+};
+
 /*
     This struct holds information about an abbreviation.
     It is put in the hash table for abbreviations for
@@ -46,4 +69,70 @@ struct Dwarf_Abbrev_List_s {
     /* Section global offset of this abbrev entry. */
     Dwarf_Off      abl_goffset;
     Dwarf_Unsigned abl_count;
+
+    /*  The abl_count attribute/form pairs, decoded.
+        malloc()ed, freed by _dwarf_abbrev_list_destructor().
+        abl_has_indirect is TRUE if any form is
+        DW_FORM_indirect (so the actual forms, and the
+        value sizes, are only known from each DIE). */
+    struct Dwarf_Abbrev_Attr_s *abl_attrs;
+    Dwarf_Bool     abl_has_indirect;
+
+    /*  New October 2026.  Set with abl_attrs.
+        abl_all_fixed is TRUE if every value has a size known
+        from its form and the CU address and offset sizes,
+        so a DIE can be stepped over without looking at it.
+        The values then occupy abl_fixed_bytes plus
+        abl_address_count address-sized, abl_offset_count
+        offset-sized and abl_ref_addr_count DW_FORM_ref_addr
+        values.  See _dwarf_abbrev_fixed_size().
+        abl_has_sibling is TRUE if there is a DW_AT_sibling.  */
+    Dwarf_Bool     abl_all_fixed;
+    Dwarf_Bool     abl_has_sibling;
+    Dwarf_Unsigned abl_fixed_bytes;
+    Dwarf_Half     abl_address_count;
+    Dwarf_Half     abl_offset_count;
+    Dwarf_Half     abl_ref_addr_count;
 };
+
+/*  New October 2026.
+    One entry of the per-CU table of subtree ends,
+    cc_sibling_slots.  ss_die is one more than the
+    CU-relative offset of a DIE with children (zero
+    means the slot is empty) and ss_sibling the
+    CU-relative offset just past its subtree, where
+    its sibling (or the end of its sibling list) is.  */
+struct Dwarf_Sibling_Slot_s {
+    Dwarf_Unsigned ss_die;
+    Dwarf_Unsigned ss_sibling;
+};
+
+void _dwarf_abbrev_list_destructor(void *m);
+
+/*  Returns TRUE and the size of the attribute values
+    of any DIE with abbreviation abbrev in cu_context
+    if that is known without reading the DIE. */
+Dwarf_Bool _dwarf_abbrev_fixed_size(Dwarf_CU_Context cu_context,
+    Dwarf_Abbrev_List abbrev,
+    Dwarf_Unsigned *size_out);
+
+/*  The size of the value, starting at val_ptr, of abbreviation
+    attribute aa in a DIE of cu_context.  form is the actual
+    form, which is aa_form unless that is DW_FORM_indirect. */
+int _dwarf_abbrev_attr_value_size(Dwarf_CU_Context cu_context,
+    struct Dwarf_Abbrev_Attr_s *aa,
+    Dwarf_Half form,
+    Dwarf_Small *val_ptr,
+    Dwarf_Small *section_end_ptr,
+    Dwarf_Unsigned *size_out,
+    Dwarf_Error *error);
+
+/*  New October 2026.
+    _dwarf_abbrev_attr_value_size() with the commonest case,
+    a form of fixed size, done in line. */
+#define ABBREV_ATTR_VALUE_SIZE(ctx,aa,form,val_ptr,end_ptr,size_out,err) \
+    (((form) == (aa)->aa_form &&                                    \
+        (aa)->aa_size_kind == DW_ABB_SIZE_FIXED)?                   \
+        (*(size_out) = (aa)->aa_fixed_size, DW_DLV_OK):             \
+        _dwarf_abbrev_attr_value_size(ctx,aa,form,val_ptr,end_ptr,  \
+            size_out,err))
@@ -32,15 +32,6 @@
 #include "dwarf_incl.h"
 #include "dwarf_elf_access.h"
 
-/* Include Relocation definitions in the case of Windows */
-#ifdef _WIN32
-#include "dwarf_reloc_arm.h"
-#include "dwarf_reloc_mips.h"
-#include "dwarf_reloc_ppc.h"
-#include "dwarf_reloc_ppc64.h"
-#include "dwarf_reloc_x86_64.h"
-#endif /* _WIN32 */
-
 #ifdef HAVE_ELF_H
 #include <elf.h>
 #endif
@@ -63,102 +54,7 @@
 #define FALSE 0
 #define TRUE  1
 
-#ifndef EM_MIPS
-/* This is the standard elf value EM_MIPS. */
-#define EM_MIPS 8
-#endif
-
-#ifndef EM_K10M
-#define EM_K10M 181  /* Intel K10M */
-#endif
-#ifndef EM_L10M
-#define EM_L10M 180  /* Intel L10M */
-#endif
-#ifndef EM_AARCH64
-#define EM_AARCH64 183  /* Arm 64 */
-#endif
-#ifndef R_AARCH64_ABS64
-#define R_AARCH64_ABS64 0x101
-#endif
-#ifndef R_AARCH64_ABS32
-#define R_AARCH64_ABS32 0x102
-#endif
-#ifndef R_MIPS_64
-#define R_MIPS_64   18
-#endif
-#ifndef R_MIPS_TLS_TPREL64
-#define R_MIPS_TLS_TPREL64	48
-#endif
-
-#ifndef EM_IA_64
-#define EM_IA_64            50
-#endif
-#ifndef R_IA64_SECREL32LSB
-#define R_IA64_SECREL32LSB 0x65
-#endif
-#ifndef R_IA64_DIR32MSB
-#define R_IA64_DIR32MSB    0x24
-#endif
-#ifndef R_IA64_DIR32LSB
-#define R_IA64_DIR32LSB    0x25
-#endif
-#ifndef R_IA64_DIR64MSB
-#define R_IA64_DIR64MSB    0x26
-#endif
-#ifndef R_IA64_DIR64LSB
-#define R_IA64_DIR64LSB    0x27
-#endif
-#ifndef R_IA64_SECREL64LSB
-#define R_IA64_SECREL64LSB 0x67
-#endif
-#ifndef R_IA64_SECREL64MSB
-#define R_IA64_SECREL64MSB 0x66
-#endif
-#ifndef R_IA64_DTPREL32LSB
-#define  R_IA64_DTPREL32LSB 0xb5
-#endif
-#ifndef R_IA64_DTPREL32MSB
-#define  R_IA64_DTPREL32MSB 0xb4
-#endif
-#ifndef R_IA64_DTPREL64LSB
-#define  R_IA64_DTPREL64LSB  0xb7
-#endif
-#ifndef R_IA64_DTPREL64MSB
-#define  R_IA64_DTPREL64MSB  0xb6
-#endif
-
-#ifndef EM_S390
-#define EM_S390             22
-#endif
-#ifndef R_390_TLS_LDO32
-#define R_390_TLS_LDO32         52
-#endif
-#ifndef R_390_TLS_LDO64
-#define R_390_TLS_LDO64         53
-#endif
-
-#ifndef R_390_32
-#define R_390_32                4
-#endif
-#ifndef  R_390_64
-#define  R_390_64                22
-#endif
-
-#ifndef EM_SH
-#define EM_SH                42
-#endif
-#ifndef R_SH_DIR32
-#define R_SH_DIR32           1
-#endif
-#ifndef R_SH_TLS_DTPOFF32
-#define R_SH_TLS_DTPOFF32    150
-#endif
-
-
-
-
-
-
+#include "dwarf_elf_reloc_common.c"
 
 #ifdef HAVE_ELF64_GETEHDR
 extern Elf64_Ehdr *elf64_getehdr(Elf *);
@@ -166,26 +62,6 @@ extern Elf64_Ehdr *elf64_getehdr(Elf *);
 #ifdef HAVE_ELF64_GETSHDR
 extern Elf64_Shdr *elf64_getshdr(Elf_Scn *);
 #endif
-#ifdef WORDS_BIGENDIAN
-#define WRITE_UNALIGNED(dbg,dest,source, srclength,len_out) \
-    {                                             \
-        dbg->de_copy_word(dest,                   \
-            ((char *)source) +srclength-len_out,  \
-            len_out) ;                            \
-    }
-
-
-#else /* LITTLE ENDIAN */
-
-#define WRITE_UNALIGNED(dbg,dest,source, srclength,len_out) \
-    {                               \
-        dbg->de_copy_word( (dest) , \
-            ((char *)source) ,      \
-            len_out) ;              \
-    }
-#endif
-
-
 
 typedef struct {
     dwarf_elf_handle elf;
@@ -485,44 +361,6 @@ dwarf_elf_object_access_get_pointer_size(void* obj_in)
     return obj->pointer_size;
 }
 
-#define MATCH_REL_SEC(i_,s_,r_)  \
-if (i_ == s_.dss_index) { \
-    *r_ = &s_;            \
-    return DW_DLV_OK;    \
-}
-
-static int
-find_section_to_relocate(Dwarf_Debug dbg,Dwarf_Half section_index,
-   struct Dwarf_Section_s **relocatablesec, int *error)
-{
-    MATCH_REL_SEC(section_index,dbg->de_debug_info,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_abbrev,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_line,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_loc,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_aranges,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_macinfo,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_pubnames,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_ranges,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_frame,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_frame_eh_gnu,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_pubtypes,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_funcnames,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_typenames,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_varnames,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_weaknames,relocatablesec);
-    MATCH_REL_SEC(section_index,dbg->de_debug_types,relocatablesec);
-    /* dbg-> de_debug_tu_index,reloctablesec); */
-    /* dbg-> de_debug_cu_index,reloctablesec); */
-    /* dbg-> de_debug_gdbindex,reloctablesec); */
-    /* dbg-> de_debug_str,syms); */
-    /* de_elf_symtab,syms); */
-    /* de_elf_strtab,syms); */
-    *error = DW_DLE_RELOC_SECTION_MISMATCH;
-    return DW_DLV_ERROR;
-
-}
-#undef MATCH_REL_SEC
-
 static void
 get_rela_elf32(Dwarf_Small *data, unsigned int i,
   UNUSEDARG int endianness,
@@ -665,326 +503,6 @@ get_relocation_entries(Dwarf_Bool is_64bit,
     return(DW_DLV_OK);
 }
 
-/*  We have a EM_QUALCOMM_DSP6 relocatable object
-    test case in dwarf regression tests, atefail/ig_server.
-    Values for QUALCOMM were derived from this executable.
-
-    The r = 0 in the function will get optimized away
-    when not needed.
-
-*/
-
-#define EM_QUALCOMM_DSP6 0xa4
-#define QUALCOMM_REL32   6
-
-static Dwarf_Bool
-is_32bit_abs_reloc(unsigned int type, Dwarf_Half machine)
-{
-    Dwarf_Bool r = 0;
-    switch (machine) {
-#if defined(EM_MIPS) && defined (R_MIPS_32)
-    case EM_MIPS:
-        r =  (0
-#if defined (R_MIPS_32)
-            | (type == R_MIPS_32)
-#endif
-#if defined (R_MIPS_TLS_DTPREL32)
-            | (type == R_MIPS_TLS_DTPREL32)
-#endif /* DTPREL32 */
-            );
-        break;
-#endif /* MIPS case */
-#if defined(EM_SPARC32PLUS)  && defined (R_SPARC_UA32)
-    case EM_SPARC32PLUS:
-        r =  (type == R_SPARC_UA32);
-        break;
-#endif
-#if defined(EM_SPARCV9)  && defined (R_SPARC_UA32)
-    case EM_SPARCV9:
-        r =  (type == R_SPARC_UA32);
-        break;
-#endif
-#if defined(EM_SPARC) && defined (R_SPARC_UA32)
-    case EM_SPARC:
-        r =  (0
-#if defined(R_SPARC_UA32)
-            | (type == R_SPARC_UA32)
-#endif
-#if (R_SPARC_TLS_DTPOFF32)
-            | (type == R_SPARC_TLS_DTPOFF32)
-#endif
-            );
-        break;
-#endif /* EM_SPARC */
-#if defined(EM_386) && defined (R_386_32)
-    case EM_386:
-        r = (0
-#if defined (R_386_32)
-            |  (type == R_386_32)
-#endif
-#if defined (R_386_TLS_LDO_32)
-            | (type == R_386_TLS_LDO_32)
-#endif
-#if defined (R_386_TLS_DTPOFF32)
-            | (type == R_386_TLS_DTPOFF32)
-#endif
-            );
-        break;
-#endif /* EM_386 */
-
-#if defined (EM_SH) && defined (R_SH_DIR32)
-    case EM_SH:
-        r = (0
-#if defined (R_SH_DIR32)
-            | (type == R_SH_DIR32)
-#endif
-#if defined (R_SH_DTPOFF32)
-            | (type == R_SH_TLS_DTPOFF32)
-#endif
-            );
-        break;
-#endif /* SH */
-
-#if defined(EM_IA_64) && defined (R_IA64_SECREL32LSB)
-    case EM_IA_64:  /* 32bit? ! */
-        r = (0
-#if defined (R_IA64_SECREL32LSB)
-            | (type == R_IA64_SECREL32LSB)
-#endif
-#if defined (R_IA64_DIR32LSB)
-            | (type == R_IA64_DIR32LSB)
-#endif
-#if defined (R_IA64_DTPREL32LSB)
-            | (type == R_IA64_DTPREL32LSB)
-#endif
-            );
-        break;
-#endif /* EM_IA_64 */
-
-#if defined(EM_ARM) && defined (R_ARM_ABS32)
-    case EM_ARM:
-    case EM_AARCH64:
-        r = (0
-#if defined (R_ARM_ABS32)
-            | ( type == R_ARM_ABS32)
-#endif
-#if defined (R_AARCH64_ABS32)
-            | ( type == R_AARCH64_ABS32)
-#endif
-#if defined (R_ARM_TLS_LDO32)
-            | ( type == R_ARM_TLS_LDO32)
-#endif
-            );
-        break;
-#endif /* EM_ARM */
-
-/*  On FreeBSD R_PPC64_ADDR32 not defined
-    so we use the R_PPC_ names which
-    have the proper value.
-    Our headers have:
-    R_PPC64_ADDR64   38
-    R_PPC_ADDR32     1 so we use this one
-    R_PPC64_ADDR32   R_PPC_ADDR32
-
-    R_PPC64_DTPREL32 110  which may be wrong/unavailable
-    R_PPC64_DTPREL64 78
-    R_PPC_DTPREL32   78
-    */
-#if defined(EM_PPC64) && defined (R_PPC_ADDR32)
-    case EM_PPC64:
-        r = (0
-#if defined(R_PPC_ADDR32)
-            | (type == R_PPC_ADDR32)
-#endif
-#if defined(R_PPC64_DTPREL32)
-            | (type == R_PPC64_DTPREL32)
-#endif
-            );
-        break;
-#endif /* EM_PPC64 */
-
-
-#if defined(EM_PPC) && defined (R_PPC_ADDR32)
-    case EM_PPC:
-        r = (0
-#if defined (R_PPC_ADDR32)
-            | (type == R_PPC_ADDR32)
-#endif
-#if defined (R_PPC_DTPREL32)
-            | (type == R_PPC_DTPREL32)
-#endif
-            );
-        break;
-#endif /* EM_PPC */
-
-#if defined(EM_S390) && defined (R_390_32)
-    case EM_S390:
-        r = (0
-#if defined (R_390_32)
-            | (type == R_390_32)
-#endif
-#if defined (R_390_TLS_LDO32)
-            | (type == R_390_TLS_LDO32)
-#endif
-            );
-        break;
-#endif /* EM_S390 */
-
-#if defined(EM_X86_64) && defined (R_X86_64_32)
-#if defined(EM_K10M)
-    case EM_K10M:
-#endif
-#if defined(EM_L10M)
-    case EM_L10M:
-#endif
-    case EM_X86_64:
-        r = (0
-#if defined (R_X86_64_32)
-            | (type == R_X86_64_32)
-#endif
-#if defined (R_X86_64_DTPOFF32)
-            | (type ==  R_X86_64_DTPOFF32)
-#endif
-            );
-        break;
-#endif /* EM_X86_64 */
-
-    case  EM_QUALCOMM_DSP6:
-        r = (type == QUALCOMM_REL32);
-        break;
-    }
-    return r;
-}
-
-static Dwarf_Bool
-is_64bit_abs_reloc(unsigned int type, Dwarf_Half machine)
-{
-    Dwarf_Bool r = 0;
-    switch (machine) {
-#if defined(EM_MIPS) && defined (R_MIPS_64)
-    case EM_MIPS:
-        r = (0
-#if defined (R_MIPS_64)
-            | (type == R_MIPS_64)
-#endif
-#if defined (R_MIPS_32)
-            | (type == R_MIPS_32)
-#endif
-#if defined(R_MIPS_TLS_DTPREL64)
-            | (type == R_MIPS_TLS_DTPREL64)
-#endif
-            );
-        break;
-#endif /* EM_MIPS */
-#if defined(EM_SPARC32PLUS) && defined (R_SPARC_UA64)
-    case EM_SPARC32PLUS:
-        r =  (type == R_SPARC_UA64);
-        break;
-#endif
-#if defined(EM_SPARCV9) && defined (R_SPARC_UA64)
-    case EM_SPARCV9:
-        r = (0
-#if defined (R_SPARC_UA64)
-            | (type == R_SPARC_UA64)
-#endif
-#if defined (R_SPARC_TLS_DTPOFF64)
-            | (type == R_SPARC_TLS_DTPOFF64)
-#endif
-            );
-        break;
-#endif
-#if defined(EM_SPARC) && defined (R_SPARC_UA64)
-    case EM_SPARC:
-        r = (0
-#if defined(R_SPARC_UA64)
-            | (type == R_SPARC_UA64)
-#endif
-#if defined (R_SPARC_TLS_DTPOFF64)
-            | (type == R_SPARC_TLS_DTPOFF64)
-#endif
-            );
-        break;
-#endif /* EM_SPARC */
-
-#if defined(EM_IA_64) && defined (R_IA64_SECREL64LSB)
-    case EM_IA_64: /* 64bit */
-        r = (0
-#if defined (R_IA64_SECREL64LSB)
-            | (type == R_IA64_SECREL64LSB)
-#endif
-#if defined (R_IA64_SECREL32LSB)
-            | (type == R_IA64_SECREL32LSB)
-#endif
-#if defined (R_IA64_DIR64LSB)
-            | (type == R_IA64_DIR64LSB)
-#endif
-#if defined (R_IA64_DTPREL64LSB)
-            | (type == R_IA64_DTPREL64LSB)
-#endif
-#if defined (R_IA64_REL32LSB)
-            | (type == R_IA64_REL32LSB)
-#endif
-            );
-        break;
-#endif /* EM_IA_64 */
-
-#if defined(EM_PPC64) && defined (R_PPC64_ADDR64)
-    case EM_PPC64:
-        r = (0
-#if defined(R_PPC64_ADDR64)
-            | (type == R_PPC64_ADDR64)
-#endif
-#if defined(R_PPC64_DTPREL64)
-            | (type == R_PPC64_DTPREL64)
-#endif
-            );
-        break;
-#endif /* EM_PPC64 */
-
-#if defined(EM_S390) && defined (R_390_64)
-    case EM_S390:
-        r = (0
-#if defined(R_390_64)
-            | (type == R_390_64)
-#endif
-#if defined(R_390_TLS_LDO64)
-            | (type == R_390_TLS_LDO64)
-#endif
-            );
-        break;
-#endif /* EM_390 */
-
-#if defined(EM_X86_64) && defined (R_X86_64_64)
-#if defined(EM_K10M)
-    case EM_K10M:
-#endif
-#if defined(EM_L10M)
-    case EM_L10M:
-#endif
-    case EM_X86_64:
-        r = (0
-#if defined (R_X86_64_64)
-            | (type == R_X86_64_64)
-#endif
-#if defined (R_X86_64_DTPOFF32)
-            | (type == R_X86_64_DTPOFF64)
-#endif
-            );
-        break;
-#endif /* EM_X86_64 */
-#if defined(EM_AARCH64) && defined (R_AARCH64_ABS64)
-    case EM_AARCH64:
-        r = (0
-#if defined (R_AARCH64_ABS64)
-            | ( type == R_AARCH64_ABS64)
-#endif
-            );
-        break;
-#endif /* EM_AARCH64 */
-
-    }
-    return r;
-}
 
 
 /*  Returns DW_DLV_OK if it works, else DW_DLV_ERROR.
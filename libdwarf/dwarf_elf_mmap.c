@@ -0,0 +1,763 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    An object access method for ELF that does not use libelf.
+    The whole file is mmap-ed read-only and the ELF and
+    section headers are read directly, so section data
+    is handed to libdwarf with no copying at all.
+    A section that needs relocating (only in relocatable
+    objects) has just its pages made writable:
+    the mapping is MAP_PRIVATE, so the kernel copies
+    only the pages the relocations touch.
+
+    Use dwarf_init_mmap() and dwarf_finish_mmap()
+    in place of dwarf_init() and dwarf_finish(). */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#ifdef HAVE_ELF_H
+#include <elf.h>
+#endif
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <string.h>
+#include <stdlib.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#define FALSE 0
+#define TRUE  1
+
+#include "dwarf_elf_reloc_common.c"
+
+#ifndef SHT_NOBITS
+#define SHT_NOBITS 8
+#endif
+#ifndef SHN_XINDEX
+#define SHN_XINDEX 0xffff
+#endif
+
+#define DWARF_DBG_ERROR(dbg,errval,retval) \
+    _dwarf_error(dbg, error, errval); return(retval);
+
+/*  Sizes of the ELF records we read, so we do not depend
+    on elf.h having 64bit types. */
+#define ELF32_EHDR_SIZE  52
+#define ELF64_EHDR_SIZE  64
+#define ELF32_SHDR_SIZE  40
+#define ELF64_SHDR_SIZE  64
+#define ELF32_RELA_SIZE  12
+#define ELF64_RELA_SIZE  24
+#define ELF32_SYM_SIZE   16
+#define ELF64_SYM_SIZE   24
+
+/*  One ELF section header, in host form. */
+struct Dwarf_Elf_Mmap_Section_s {
+    const char     *name;
+    Dwarf_Unsigned  type;
+    Dwarf_Unsigned  flags;
+    Dwarf_Unsigned  addr;
+    Dwarf_Unsigned  offset;
+    Dwarf_Unsigned  size;
+    Dwarf_Unsigned  link;
+    Dwarf_Unsigned  info;
+    Dwarf_Unsigned  addralign;
+    Dwarf_Unsigned  entsize;
+};
+
+typedef struct {
+    Dwarf_Small     *base;
+    Dwarf_Unsigned   filesize;
+    int              is_64bit;
+    Dwarf_Small      length_size;
+    Dwarf_Small      pointer_size;
+    Dwarf_Endianness endianness;
+    Dwarf_Half       machine;
+    Dwarf_Unsigned   section_count;
+    struct Dwarf_Elf_Mmap_Section_s *sections;
+
+    /*  Elf symtab and its strtab.  Initialized at first
+        call to do relocations, the actual data is in the Dwarf_Debug
+        struct, not allocated locally here. */
+    struct Dwarf_Section_s *symtab;
+    struct Dwarf_Section_s *strtab;
+} dwarf_elf_mmap_internals_t;
+
+/*  Read an unsigned value of len bytes in the byte order
+    of the object.  The caller has checked the bounds. */
+static Dwarf_Unsigned
+read_elf_value(dwarf_elf_mmap_internals_t *obj,
+    const Dwarf_Small *p, unsigned len)
+{
+    Dwarf_Unsigned v = 0;
+    unsigned i = 0;
+
+    if (obj->endianness == DW_OBJECT_MSB) {
+        for (i = 0; i < len; ++i) {
+            v = (v << 8) | p[i];
+        }
+    } else {
+        for (i = len; i > 0; --i) {
+            v = (v << 8) | p[i-1];
+        }
+    }
+    return v;
+}
+
+/*  Fills obj->sections from the section header table.
+    Everything is range checked against the file size
+    as the file may be corrupt. */
+static int
+read_section_headers(dwarf_elf_mmap_internals_t *obj,
+    int *error)
+{
+    Dwarf_Small *ehdr = obj->base;
+    Dwarf_Unsigned shoff = 0;
+    Dwarf_Unsigned shentsize = 0;
+    Dwarf_Unsigned shnum = 0;
+    Dwarf_Unsigned shstrndx = 0;
+    Dwarf_Unsigned minentsize = 0;
+    Dwarf_Unsigned i = 0;
+    struct Dwarf_Elf_Mmap_Section_s *shstr = 0;
+
+    if (obj->is_64bit) {
+        if (obj->filesize < ELF64_EHDR_SIZE) {
+            *error = DW_DLE_ELF_HEADER_BAD;
+            return DW_DLV_ERROR;
+        }
+        obj->machine = (Dwarf_Half)read_elf_value(obj,ehdr+18,2);
+        shoff = read_elf_value(obj,ehdr+40,8);
+        shentsize = read_elf_value(obj,ehdr+58,2);
+        shnum = read_elf_value(obj,ehdr+60,2);
+        shstrndx = read_elf_value(obj,ehdr+62,2);
+        minentsize = ELF64_SHDR_SIZE;
+    } else {
+        if (obj->filesize < ELF32_EHDR_SIZE) {
+            *error = DW_DLE_ELF_HEADER_BAD;
+            return DW_DLV_ERROR;
+        }
+        obj->machine = (Dwarf_Half)read_elf_value(obj,ehdr+18,2);
+        shoff = read_elf_value(obj,ehdr+32,4);
+        shentsize = read_elf_value(obj,ehdr+46,2);
+        shnum = read_elf_value(obj,ehdr+48,2);
+        shstrndx = read_elf_value(obj,ehdr+50,2);
+        minentsize = ELF32_SHDR_SIZE;
+    }
+    if (!shoff) {
+        /* No sections, so no DWARF. */
+        return DW_DLV_NO_ENTRY;
+    }
+    if (shentsize < minentsize || shoff >= obj->filesize ||
+        shentsize > obj->filesize - shoff) {
+        *error = DW_DLE_ELF_HEADER_BAD;
+        return DW_DLV_ERROR;
+    }
+    if (!shnum || shstrndx == SHN_XINDEX) {
+        /*  Too many sections for the ELF header fields:
+            the real values are in section header 0. */
+        Dwarf_Small *sh0 = obj->base + shoff;
+
+        if (!shnum) {
+            shnum = obj->is_64bit? read_elf_value(obj,sh0+32,8):
+                read_elf_value(obj,sh0+20,4);
+        }
+        if (shstrndx == SHN_XINDEX) {
+            shstrndx = obj->is_64bit? read_elf_value(obj,sh0+40,4):
+                read_elf_value(obj,sh0+24,4);
+        }
+    }
+    if (!shnum || shnum > (obj->filesize - shoff)/shentsize ||
+        shnum > 0xffff || shstrndx >= shnum) {
+        /*  Dwarf_Half section indexes limit us to
+            0xffff sections. */
+        *error = DW_DLE_ELF_HEADER_BAD;
+        return DW_DLV_ERROR;
+    }
+    obj->sections = (struct Dwarf_Elf_Mmap_Section_s *)
+        calloc(shnum,sizeof(struct Dwarf_Elf_Mmap_Section_s));
+    if (!obj->sections) {
+        *error = DW_DLE_ALLOC_FAIL;
+        return DW_DLV_ERROR;
+    }
+    obj->section_count = shnum;
+    for (i = 0; i < shnum; ++i) {
+        Dwarf_Small *sh = obj->base + shoff + i*shentsize;
+        struct Dwarf_Elf_Mmap_Section_s *s = obj->sections+i;
+
+        /*  The name offset is resolved below, once
+            the section name string table is known. */
+        s->name = 0;
+        s->type = read_elf_value(obj,sh+4,4);
+        if (obj->is_64bit) {
+            s->flags = read_elf_value(obj,sh+8,8);
+            s->addr = read_elf_value(obj,sh+16,8);
+            s->offset = read_elf_value(obj,sh+24,8);
+            s->size = read_elf_value(obj,sh+32,8);
+            s->link = read_elf_value(obj,sh+40,4);
+            s->info = read_elf_value(obj,sh+44,4);
+            s->addralign = read_elf_value(obj,sh+48,8);
+            s->entsize = read_elf_value(obj,sh+56,8);
+        } else {
+            s->flags = read_elf_value(obj,sh+8,4);
+            s->addr = read_elf_value(obj,sh+12,4);
+            s->offset = read_elf_value(obj,sh+16,4);
+            s->size = read_elf_value(obj,sh+20,4);
+            s->link = read_elf_value(obj,sh+24,4);
+            s->info = read_elf_value(obj,sh+28,4);
+            s->addralign = read_elf_value(obj,sh+32,4);
+            s->entsize = read_elf_value(obj,sh+36,4);
+        }
+    }
+    shstr = obj->sections + shstrndx;
+    if (shstr->type == SHT_NOBITS || shstr->offset > obj->filesize ||
+        shstr->size > obj->filesize - shstr->offset) {
+        *error = DW_DLE_ELF_HEADER_BAD;
+        return DW_DLV_ERROR;
+    }
+    for (i = 0; i < shnum; ++i) {
+        Dwarf_Small *sh = obj->base + shoff + i*shentsize;
+        Dwarf_Unsigned nameoff = read_elf_value(obj,sh,4);
+        const char *strs = (const char *)obj->base + shstr->offset;
+
+        if (i == 0) {
+            /* Section 0 is always the empty section. */
+            obj->sections[i].name = "";
+            continue;
+        }
+        if (nameoff >= shstr->size ||
+            !memchr(strs + nameoff,0,shstr->size - nameoff)) {
+            *error = DW_DLE_ELF_STRPTR_ERROR;
+            return DW_DLV_ERROR;
+        }
+        obj->sections[i].name = strs + nameoff;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+dwarf_elf_mmap_internals_init(dwarf_elf_mmap_internals_t *obj,
+    int *error)
+{
+    Dwarf_Small *ident = obj->base;
+    int res = 0;
+
+    if (obj->filesize < EI_NIDENT ||
+        ident[EI_MAG0] != ELFMAG0 || ident[EI_MAG1] != ELFMAG1 ||
+        ident[EI_MAG2] != ELFMAG2 || ident[EI_MAG3] != ELFMAG3) {
+        /* Not ELF. */
+        return DW_DLV_NO_ENTRY;
+    }
+    if (ident[EI_CLASS] == ELFCLASS64) {
+        obj->is_64bit = TRUE;
+    } else if (ident[EI_CLASS] == ELFCLASS32) {
+        obj->is_64bit = FALSE;
+    } else {
+        *error = DW_DLE_ELF_HEADER_BAD;
+        return DW_DLV_ERROR;
+    }
+    if (ident[EI_DATA] == ELFDATA2LSB) {
+        obj->endianness = DW_OBJECT_LSB;
+    } else if (ident[EI_DATA] == ELFDATA2MSB) {
+        obj->endianness = DW_OBJECT_MSB;
+    } else {
+        *error = DW_DLE_ELF_HEADER_BAD;
+        return DW_DLV_ERROR;
+    }
+
+    res = read_section_headers(obj,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+
+    /*  As in dwarf_elf_access.c: the length_size is only used
+        in an approximate calculation. */
+    obj->length_size = obj->is_64bit ? 8 : 4;
+    obj->pointer_size = obj->is_64bit ? 8 : 4;
+    if (obj->is_64bit && obj->machine != EM_MIPS) {
+        obj->length_size = 4;
+    }
+    return DW_DLV_OK;
+}
+
+static Dwarf_Endianness
+dwarf_elf_mmap_get_byte_order(void* obj_in)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    return obj->endianness;
+}
+
+static Dwarf_Unsigned
+dwarf_elf_mmap_get_section_count(void * obj_in)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    return obj->section_count;
+}
+
+static Dwarf_Small
+dwarf_elf_mmap_get_length_size(void* obj_in)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    return obj->length_size;
+}
+
+static Dwarf_Small
+dwarf_elf_mmap_get_pointer_size(void* obj_in)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    return obj->pointer_size;
+}
+
+static int
+dwarf_elf_mmap_get_flags(void* obj_in,
+    Dwarf_Half section_index,
+    Dwarf_Unsigned *flags_out,
+    Dwarf_Unsigned *addralign_out,
+    int *error)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+
+    if (section_index >= obj->section_count) {
+        *error = DW_DLE_MDE;
+        return DW_DLV_ERROR;
+    }
+    *flags_out = obj->sections[section_index].flags;
+    *addralign_out = obj->sections[section_index].addralign;
+    return DW_DLV_OK;
+}
+
+static int
+dwarf_elf_mmap_get_section_info(void* obj_in,
+    Dwarf_Half section_index,
+    Dwarf_Obj_Access_Section* ret_scn,
+    int* error)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    struct Dwarf_Elf_Mmap_Section_s *s = 0;
+
+    if (section_index >= obj->section_count) {
+        *error = DW_DLE_MDE;
+        return DW_DLV_ERROR;
+    }
+    s = obj->sections + section_index;
+    ret_scn->type = s->type;
+    ret_scn->size = s->size;
+    ret_scn->addr = s->addr;
+    ret_scn->link = s->link;
+    ret_scn->info = s->info;
+    ret_scn->entrysize = s->entsize;
+    ret_scn->name = s->name;
+    return DW_DLV_OK;
+}
+
+/*  No copying: the section data is the mapped file. */
+static int
+dwarf_elf_mmap_load_section(void* obj_in,
+    Dwarf_Half section_index,
+    Dwarf_Small** section_data,
+    int* error)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    struct Dwarf_Elf_Mmap_Section_s *s = 0;
+
+    if (section_index == 0) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (section_index >= obj->section_count) {
+        *error = DW_DLE_MDE;
+        return DW_DLV_ERROR;
+    }
+    s = obj->sections + section_index;
+    if (s->type == SHT_NOBITS || s->offset > obj->filesize ||
+        s->size > obj->filesize - s->offset) {
+        /*  No data in the file, or the section header
+            is corrupt. */
+        *error = DW_DLE_MDE;
+        return DW_DLV_ERROR;
+    }
+    *section_data = obj->base + s->offset;
+    return DW_DLV_OK;
+}
+
+/*  Make the section data writable. Data still in the
+    mapping gets its pages made writable (copy-on-write),
+    which costs nothing until a page is written. */
+static int
+make_section_writable(dwarf_elf_mmap_internals_t *obj,
+    struct Dwarf_Section_s *relocatablesec,
+    int *error)
+{
+#ifdef HAVE_SYS_MMAN_H
+    Dwarf_Small *start = relocatablesec->dss_data;
+    Dwarf_Unsigned pagesize = (Dwarf_Unsigned)sysconf(_SC_PAGESIZE);
+    Dwarf_Unsigned first = 0;
+    Dwarf_Unsigned last = 0;
+
+    if (relocatablesec->dss_data_was_malloc ||
+        relocatablesec->dss_mmap_realarea) {
+        /*  Already a private copy (decompressed, for example,
+            or a private writable map of a decompressed
+            section cache file). */
+        return DW_DLV_OK;
+    }
+    if (start < obj->base ||
+        start + relocatablesec->dss_size > obj->base + obj->filesize) {
+        *error = DW_DLE_RELOC_INVALID;
+        return DW_DLV_ERROR;
+    }
+    first = (Dwarf_Unsigned)(start - obj->base) & ~(pagesize - 1);
+    last = (Dwarf_Unsigned)(start - obj->base) + relocatablesec->dss_size;
+    if (mprotect(obj->base + first,last - first,
+        PROT_READ|PROT_WRITE) != 0) {
+        *error = DW_DLE_RELOC_SECTION_MALLOC_FAIL;
+        return DW_DLV_ERROR;
+    }
+    return DW_DLV_OK;
+#else
+    *error = DW_DLE_RELOC_SECTION_MALLOC_FAIL;
+    return DW_DLV_ERROR;
+#endif
+}
+
+/*  Apply one Elf32_Rela or Elf64_Rela entry.
+    Read here byte by byte as the object byte order
+    need not be that of the host. */
+static int
+apply_one_rela(Dwarf_Debug dbg,
+    dwarf_elf_mmap_internals_t *obj,
+    Dwarf_Small *relap,
+    struct Dwarf_Section_s *target,
+    int *error)
+{
+    Dwarf_Unsigned offset = 0;
+    Dwarf_Unsigned info = 0;
+    Dwarf_Unsigned addend = 0;
+    Dwarf_Unsigned type = 0;
+    Dwarf_Unsigned symidx = 0;
+    Dwarf_Unsigned symvalue = 0;
+    Dwarf_Unsigned symsize = obj->is_64bit? ELF64_SYM_SIZE:ELF32_SYM_SIZE;
+    Dwarf_Unsigned reloc_size = 0;
+    struct Dwarf_Section_s *symtab = obj->symtab;
+
+    if (obj->is_64bit) {
+        offset = read_elf_value(obj,relap,8);
+        info = read_elf_value(obj,relap+8,8);
+        addend = read_elf_value(obj,relap+16,8);
+        if (obj->machine == EM_MIPS &&
+            obj->endianness == DW_OBJECT_LSB) {
+            /*  See get_rela_elf64() in dwarf_elf_access.c */
+            type = (info >> 56) & 0xff;
+            symidx = info & 0xffffffff;
+        } else {
+            type = info & 0xffffffff;
+            symidx = info >> 32;
+        }
+    } else {
+        offset = read_elf_value(obj,relap,4);
+        info = read_elf_value(obj,relap+4,4);
+        addend = read_elf_value(obj,relap+8,4);
+        /* Sign extend the 32bit addend. */
+        if (addend & 0x80000000) {
+            addend |= ~(Dwarf_Unsigned)0xffffffff;
+        }
+        type = info & 0xff;
+        symidx = info >> 8;
+    }
+    if (symidx >= symtab->dss_size/symsize) {
+        *error = DW_DLE_RELOC_SECTION_SYMBOL_INDEX_BAD;
+        return DW_DLV_ERROR;
+    }
+    if (offset >= target->dss_size) {
+        *error = DW_DLE_RELOC_INVALID;
+        return DW_DLV_ERROR;
+    }
+    if (obj->is_64bit) {
+        symvalue = read_elf_value(obj,
+            symtab->dss_data + symidx*symsize + 8,8);
+    } else {
+        symvalue = read_elf_value(obj,
+            symtab->dss_data + symidx*symsize + 4,4);
+    }
+    if (is_32bit_abs_reloc((unsigned)type, obj->machine)) {
+        reloc_size = 4;
+    } else if (is_64bit_abs_reloc((unsigned)type, obj->machine)) {
+        reloc_size = 8;
+    } else {
+        *error = DW_DLE_RELOC_SECTION_RELOC_TARGET_SIZE_UNKNOWN;
+        return DW_DLV_ERROR;
+    }
+    if (reloc_size > target->dss_size - offset) {
+        *error = DW_DLE_RELOC_INVALID;
+        return DW_DLV_ERROR;
+    }
+    {
+        Dwarf_Unsigned outval = symvalue + addend;
+
+        WRITE_UNALIGNED(dbg,target->dss_data + offset,
+            &outval,sizeof(outval),reloc_size);
+    }
+    return DW_DLV_OK;
+}
+
+/*  As dwarf_elf_object_relocate_a_section() in
+    dwarf_elf_access.c: all the relocations we can are
+    applied and any error is reported at the end. */
+static int
+dwarf_elf_mmap_relocate_a_section(void* obj_in,
+    Dwarf_Half section_index,
+    Dwarf_Debug dbg,
+    int* error)
+{
+    dwarf_elf_mmap_internals_t *obj = (dwarf_elf_mmap_internals_t*)obj_in;
+    struct Dwarf_Section_s *relocatablesec = 0;
+    Dwarf_Unsigned relasize = obj->is_64bit?
+        ELF64_RELA_SIZE:ELF32_RELA_SIZE;
+    Dwarf_Unsigned symsize = obj->is_64bit?
+        ELF64_SYM_SIZE:ELF32_SYM_SIZE;
+    Dwarf_Unsigned nrelas = 0;
+    Dwarf_Unsigned i = 0;
+    int res = DW_DLV_ERROR;
+    int return_res = DW_DLV_OK;
+
+    if (section_index == 0) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = find_section_to_relocate(dbg, section_index,
+        &relocatablesec,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (relocatablesec->dss_reloc_index == 0 ) {
+        *error = DW_DLE_RELOC_SECTION_MISSING_INDEX;
+        return DW_DLV_ERROR;
+    }
+    res = dwarf_elf_mmap_load_section(obj_in,
+        relocatablesec->dss_reloc_index,
+        &relocatablesec->dss_reloc_data, error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!obj->symtab) {
+        obj->symtab = &dbg->de_elf_symtab;
+        obj->strtab = &dbg->de_elf_strtab;
+    }
+    if (obj->symtab->dss_index != relocatablesec->dss_reloc_link) {
+        *error = DW_DLE_RELOC_MISMATCH_RELOC_INDEX;
+        return DW_DLV_ERROR;
+    }
+    if (obj->strtab->dss_index != obj->symtab->dss_link) {
+        *error = DW_DLE_RELOC_MISMATCH_STRTAB_INDEX;
+        return DW_DLV_ERROR;
+    }
+    if (!obj->symtab->dss_data) {
+        res = dwarf_elf_mmap_load_section(obj_in,
+            obj->symtab->dss_index,
+            &obj->symtab->dss_data, error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (obj->symtab->dss_entrysize != symsize) {
+        *error = DW_DLE_SYMTAB_SECTION_LENGTH_ODD;
+        return DW_DLV_ERROR;
+    }
+    if (relocatablesec->dss_reloc_entrysize != relasize ||
+        relocatablesec->dss_reloc_size % relasize) {
+        *error = DW_DLE_RELOC_SECTION_LENGTH_ODD;
+        return DW_DLV_ERROR;
+    }
+    nrelas = relocatablesec->dss_reloc_size / relasize;
+    if (!nrelas) {
+        return DW_DLV_OK;
+    }
+    res = make_section_writable(obj,relocatablesec,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = 0; i < nrelas; ++i) {
+        res = apply_one_rela(dbg,obj,
+            relocatablesec->dss_reloc_data + i*relasize,
+            relocatablesec,error);
+        if (res != DW_DLV_OK) {
+            return_res = res;
+        }
+    }
+    return return_res;
+}
+
+static const struct Dwarf_Obj_Access_Methods_s dwarf_elf_mmap_methods =
+{
+    dwarf_elf_mmap_get_section_info,
+    dwarf_elf_mmap_get_byte_order,
+    dwarf_elf_mmap_get_length_size,
+    dwarf_elf_mmap_get_pointer_size,
+    dwarf_elf_mmap_get_section_count,
+    dwarf_elf_mmap_load_section,
+    dwarf_elf_mmap_relocate_a_section
+};
+
+static void
+dwarf_elf_mmap_access_finish(Dwarf_Obj_Access_Interface* intfc)
+{
+    dwarf_elf_mmap_internals_t *obj = 0;
+
+    if (!intfc) {
+        return;
+    }
+    obj = (dwarf_elf_mmap_internals_t *)intfc->object;
+    if (obj) {
+#ifdef HAVE_SYS_MMAN_H
+        if (obj->base) {
+            munmap(obj->base,obj->filesize);
+        }
+#endif
+        free(obj->sections);
+        free(obj);
+    }
+    free(intfc);
+}
+
+/*  On error sets *err to a libdwarf error code. */
+static int
+dwarf_elf_mmap_access_init(int fd,
+    Dwarf_Obj_Access_Interface** ret_obj,
+    int *err)
+{
+#ifdef HAVE_SYS_MMAN_H
+    struct stat fstat_buf;
+    dwarf_elf_mmap_internals_t *obj = 0;
+    Dwarf_Obj_Access_Interface *intfc = 0;
+    void *base = 0;
+    int res = 0;
+
+#if !defined(S_ISREG)
+#define S_ISREG(mode) (((mode) & S_IFMT) == S_IFREG)
+#endif
+    if (fstat(fd, &fstat_buf) != 0) {
+        *err = DW_DLE_FSTAT_ERROR;
+        return DW_DLV_ERROR;
+    }
+    if (!S_ISREG(fstat_buf.st_mode)) {
+        *err = DW_DLE_FSTAT_MODE_ERROR;
+        return DW_DLV_ERROR;
+    }
+    if (fstat_buf.st_size <= 0) {
+        return DW_DLV_NO_ENTRY;
+    }
+    obj = (dwarf_elf_mmap_internals_t *)calloc(1,sizeof(*obj));
+    if (!obj) {
+        *err = DW_DLE_ALLOC_FAIL;
+        return DW_DLV_ERROR;
+    }
+    obj->filesize = (Dwarf_Unsigned)fstat_buf.st_size;
+    base = mmap(0,(size_t)obj->filesize,PROT_READ,MAP_PRIVATE,fd,0);
+    if (base == MAP_FAILED) {
+        free(obj);
+        *err = DW_DLE_ELF_MMAP_ERROR;
+        return DW_DLV_ERROR;
+    }
+    obj->base = (Dwarf_Small *)base;
+    intfc = (Dwarf_Obj_Access_Interface *)
+        calloc(1,sizeof(Dwarf_Obj_Access_Interface));
+    if (!intfc) {
+        munmap(base,obj->filesize);
+        free(obj);
+        *err = DW_DLE_ALLOC_FAIL;
+        return DW_DLV_ERROR;
+    }
+    intfc->object = obj;
+    intfc->methods = &dwarf_elf_mmap_methods;
+    res = dwarf_elf_mmap_internals_init(obj,err);
+    if (res != DW_DLV_OK) {
+        dwarf_elf_mmap_access_finish(intfc);
+        return res;
+    }
+    *ret_obj = intfc;
+    return DW_DLV_OK;
+#else
+    *err = DW_DLE_ELF_MMAP_ERROR;
+    return DW_DLV_ERROR;
+#endif
+}
+
+/*  Like dwarf_init(), but reads the ELF file through mmap
+    with no use of libelf.
+    Returns DW_DLV_NO_ENTRY if the file is not ELF or
+    has no sections. The caller may close fd as
+    soon as this returns. */
+int
+dwarf_init_mmap(int fd,
+    Dwarf_Unsigned access,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    Dwarf_Debug * ret_dbg,
+    Dwarf_Error * error)
+{
+    Dwarf_Obj_Access_Interface *binary_interface = 0;
+    int res = DW_DLV_OK;
+    int localerrnum = 0;
+
+    if (access != DW_DLC_READ) {
+        DWARF_DBG_ERROR(NULL, DW_DLE_INIT_ACCESS_WRONG, DW_DLV_ERROR);
+    }
+    res = dwarf_elf_mmap_access_init(fd,&binary_interface,
+        &localerrnum);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_NO_ENTRY) {
+            return res;
+        }
+        DWARF_DBG_ERROR(NULL, localerrnum, DW_DLV_ERROR);
+    }
+    res = _dwarf_object_init_b(binary_interface, errhand, errarg,
+        dwarf_elf_mmap_get_flags, ret_dbg, error);
+    if (res != DW_DLV_OK){
+        dwarf_elf_mmap_access_finish(binary_interface);
+    }
+    return res;
+}
+
+/*  Frees everything dwarf_init_mmap() created,
+    including the mapping. */
+int
+dwarf_finish_mmap(Dwarf_Debug dbg, Dwarf_Error * error)
+{
+    Dwarf_Obj_Access_Interface *intfc = 0;
+    int res = 0;
+
+    if (!dbg) {
+        DWARF_DBG_ERROR(NULL, DW_DLE_DBG_NULL, DW_DLV_ERROR);
+    }
+    /*  The section data points into the mapping, so
+        unmap only after dbg is gone. */
+    intfc = dbg->de_obj_file;
+    res = dwarf_object_finish(dbg, error);
+    dwarf_elf_mmap_access_finish(intfc);
+    return res;
+}
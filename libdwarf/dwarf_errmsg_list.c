@@ -447,6 +447,8 @@ const char *_dwarf_errmsgs[] = {
     "DW_DLE_MACRO_STRING_BAD(366) DWARF5 macro def/undef string runs off section data",
     "DW_DLE_MACINFO_STRING_BAD(367) DWARF2..4 macro def/undef string runs off section data",
     "DW_DLE_ZLIB_UNCOMPRESS_ERROR(368) Surely an invalid uncompress length",
+    "DW_DLE_ELF_MMAP_ERROR(369) Unable to mmap the object file",
+    "DW_DLE_ELF_HEADER_BAD(370) ELF header or section header table is corrupt",
 };
 
 #ifdef TESTING
@@ -1535,41 +1535,15 @@ dwarf_get_cie_info_b(Dwarf_Cie cie,
     return (DW_DLV_OK);
 }
 
-/* Return the register rules for all registers at a given pc.
-*/
+/*  Creates the CIE initial instructions row, once per CIE. */
 static int
-_dwarf_get_fde_info_for_a_pc_row(Dwarf_Fde fde,
-    Dwarf_Addr pc_requested,
-    Dwarf_Frame table,
+ensure_cie_initial_table(Dwarf_Debug dbg, Dwarf_Cie cie,
     Dwarf_Half cfa_reg_col_num,
-    Dwarf_Bool * has_more_rows,
-    Dwarf_Addr * subsequent_pc,
     Dwarf_Error * error)
 {
-    Dwarf_Debug dbg = 0;
-    Dwarf_Cie cie = 0;
     Dwarf_Sword icount = 0;
     int res = 0;
 
-    if (fde == NULL) {
-        _dwarf_error(NULL, error, DW_DLE_FDE_NULL);
-        return DW_DLV_ERROR;
-    }
-
-    dbg = fde->fd_dbg;
-    if (dbg == NULL) {
-        _dwarf_error(NULL, error, DW_DLE_FDE_DBG_NULL);
-        return DW_DLV_ERROR;
-    }
-
-    if (pc_requested < fde->fd_initial_location ||
-        pc_requested >=
-        fde->fd_initial_location + fde->fd_address_range) {
-        _dwarf_error(dbg, error, DW_DLE_PC_NOT_IN_FDE_RANGE);
-        return DW_DLV_ERROR;
-    }
-
-    cie = fde->fd_cie;
     if (cie->ci_initial_table == NULL) {
         Dwarf_Small *instrstart = cie->ci_cie_instr_start;
         Dwarf_Small *instrend = instrstart +cie->ci_length +
@@ -1607,39 +1581,441 @@ _dwarf_get_fde_info_for_a_pc_row(Dwarf_Fde fde,
             return res;
         }
     }
+    return DW_DLV_OK;
+}
 
-    {
-        Dwarf_Small *instr_end = fde->fd_fde_instr_start +
-            fde->fd_length +
-            fde->fd_length_size +
-            fde->fd_extension_size - (fde->fd_fde_instr_start -
-                fde->fd_fde_start);
-        if (instr_end > fde->fd_fde_end) {
-            _dwarf_error(dbg, error,DW_DLE_FDE_INSTR_PTR_ERROR);
-            return DW_DLV_ERROR;
-        }
+/*  Runs the FDE instructions up to pc_requested. */
+static int
+exec_fde_instr_for_pc(Dwarf_Fde fde,
+    Dwarf_Addr pc_requested,
+    Dwarf_Frame table,
+    Dwarf_Half cfa_reg_col_num,
+    Dwarf_Bool * has_more_rows,
+    Dwarf_Addr * subsequent_pc,
+    Dwarf_Error * error)
+{
+    Dwarf_Debug dbg = fde->fd_dbg;
+    Dwarf_Sword icount = 0;
+    Dwarf_Small *instr_end = fde->fd_fde_instr_start +
+        fde->fd_length +
+        fde->fd_length_size +
+        fde->fd_extension_size - (fde->fd_fde_instr_start -
+            fde->fd_fde_start);
 
-        res = _dwarf_exec_frame_instr( /* make_instr= */ false,
-            /* ret_frame_instr= */ NULL,
-            /* search_pc */ true,
-            /* search_pc_val */ pc_requested,
-            fde->fd_initial_location,
-            fde->fd_fde_instr_start,
-            instr_end,
-            table,
-            cie, dbg,
-            cfa_reg_col_num, &icount,
-            has_more_rows,
-            subsequent_pc,
-            error);
+    if (instr_end > fde->fd_fde_end) {
+        _dwarf_error(dbg, error,DW_DLE_FDE_INSTR_PTR_ERROR);
+        return DW_DLV_ERROR;
+    }
+    return _dwarf_exec_frame_instr( /* make_instr= */ false,
+        /* ret_frame_instr= */ NULL,
+        /* search_pc */ true,
+        /* search_pc_val */ pc_requested,
+        fde->fd_initial_location,
+        fde->fd_fde_instr_start,
+        instr_end,
+        table,
+        fde->fd_cie, dbg,
+        cfa_reg_col_num, &icount,
+        has_more_rows,
+        subsequent_pc,
+        error);
+}
+
+static Dwarf_Bool
+reg_rules_differ(struct Dwarf_Reg_Rule_s *a,
+    struct Dwarf_Reg_Rule_s *b)
+{
+    if (a->ru_is_off != b->ru_is_off ||
+        a->ru_value_type != b->ru_value_type ||
+        a->ru_register != b->ru_register ||
+        a->ru_offset_or_block_len != b->ru_offset_or_block_len ||
+        a->ru_block != b->ru_block) {
+        return true;
+    }
+    return false;
+}
+
+static void
+free_frame_rows(struct Dwarf_Frame_Rows_s *rt)
+{
+    free(rt->rt_rows);
+    free(rt->rt_deltas);
+    free(rt);
+}
+
+/*  Unlinks the fde from the row cache LRU list
+    and frees its row table.  */
+static void
+drop_fde_rows(Dwarf_Debug dbg, Dwarf_Fde fde)
+{
+    struct Dwarf_Frame_Row_Cache_s *rc = &dbg->de_frame_row_cache;
+
+    if (!fde->fd_rows) {
+        return;
+    }
+    if (fde->fd_rows_lru_prev) {
+        fde->fd_rows_lru_prev->fd_rows_lru_next = fde->fd_rows_lru_next;
+    } else {
+        rc->rc_lru_head = fde->fd_rows_lru_next;
+    }
+    if (fde->fd_rows_lru_next) {
+        fde->fd_rows_lru_next->fd_rows_lru_prev = fde->fd_rows_lru_prev;
+    } else {
+        rc->rc_lru_tail = fde->fd_rows_lru_prev;
+    }
+    rc->rc_bytes -= fde->fd_rows->rt_bytes;
+    free_frame_rows(fde->fd_rows);
+    fde->fd_rows = 0;
+    fde->fd_rows_lru_prev = 0;
+    fde->fd_rows_lru_next = 0;
+}
+
+static void
+make_fde_rows_most_recent(Dwarf_Debug dbg, Dwarf_Fde fde)
+{
+    struct Dwarf_Frame_Row_Cache_s *rc = &dbg->de_frame_row_cache;
+
+    if (rc->rc_lru_head == fde) {
+        return;
+    }
+    /* Unlink. fde is not the head so it has a prev. */
+    fde->fd_rows_lru_prev->fd_rows_lru_next = fde->fd_rows_lru_next;
+    if (fde->fd_rows_lru_next) {
+        fde->fd_rows_lru_next->fd_rows_lru_prev = fde->fd_rows_lru_prev;
+    } else {
+        rc->rc_lru_tail = fde->fd_rows_lru_prev;
+    }
+    /* Put at head. */
+    fde->fd_rows_lru_prev = 0;
+    fde->fd_rows_lru_next = rc->rc_lru_head;
+    rc->rc_lru_head->fd_rows_lru_prev = fde;
+    rc->rc_lru_head = fde;
+}
+
+/*  Drops least recently used row tables till
+    at least 'needed' bytes are free under the limit. */
+static void
+trim_frame_row_cache(Dwarf_Debug dbg, Dwarf_Unsigned needed)
+{
+    struct Dwarf_Frame_Row_Cache_s *rc = &dbg->de_frame_row_cache;
+
+    while (rc->rc_lru_tail &&
+        (rc->rc_bytes + needed) > rc->rc_max_bytes) {
+        drop_fde_rows(dbg,rc->rc_lru_tail);
+    }
+}
+
+void
+_dwarf_frame_row_cache_flush(Dwarf_Debug dbg)
+{
+    struct Dwarf_Frame_Row_Cache_s *rc = &dbg->de_frame_row_cache;
+
+    while (rc->rc_lru_head) {
+        drop_fde_rows(dbg,rc->rc_lru_head);
+    }
+}
+
+/*  Evaluates every row of the fde once, recording each row
+    as its location, CFA rule and the register rules
+    that changed from the row before.
+    Each row is found with exactly the same
+    _dwarf_exec_frame_instr() search a direct query
+    would do, so a row table answer is always identical
+    to a direct answer.
+    Returns DW_DLV_NO_ENTRY if the table would not
+    fit in the cache at all.  */
+static int
+build_fde_rows(Dwarf_Debug dbg, Dwarf_Fde fde,
+    Dwarf_Half cfa_reg_col_num,
+    struct Dwarf_Frame_Rows_s **rows_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Frame_s work;
+    struct Dwarf_Reg_Rule_s *prev = 0;
+    struct Dwarf_Frame_Rows_s *rt = 0;
+    Dwarf_Unsigned rows_size = 0;
+    Dwarf_Unsigned deltas_size = 0;
+    unsigned reg_count = dbg->de_frame_reg_rules_entry_count;
+    Dwarf_Addr pc = fde->fd_initial_location;
+    Dwarf_Addr pc_end = fde->fd_initial_location + fde->fd_address_range;
+    Dwarf_Cie cie = fde->fd_cie;
+    unsigned i = 0;
+    int res = 0;
+
+    if (cie->ci_initial_table->fr_reg_count != reg_count) {
+        /* Table size changed after the CIE row was made. */
+        return DW_DLV_NO_ENTRY;
+    }
+    res = dwarf_initialize_fde_table(dbg, &work, reg_count, error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    rt = (struct Dwarf_Frame_Rows_s *)calloc(1,
+        sizeof(struct Dwarf_Frame_Rows_s));
+    prev = (struct Dwarf_Reg_Rule_s *)calloc(reg_count,
+        sizeof(struct Dwarf_Reg_Rule_s));
+    if (!rt || !prev) {
+        free(rt);
+        free(prev);
+        dwarf_free_fde_table(&work);
+        _dwarf_error(dbg, error, DW_DLE_DF_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    memcpy(prev,cie->ci_initial_table->fr_reg,
+        reg_count*sizeof(struct Dwarf_Reg_Rule_s));
+
+    for (;;) {
+        Dwarf_Bool has_more_rows = false;
+        Dwarf_Addr subsequent_pc = 0;
+        struct Dwarf_Frame_Row_s *row = 0;
+
+        res = exec_fde_instr_for_pc(fde,pc,&work,cfa_reg_col_num,
+            &has_more_rows,&subsequent_pc,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (rt->rt_row_count >= rows_size) {
+            Dwarf_Unsigned newsize = rows_size? rows_size*2: 8;
+            struct Dwarf_Frame_Row_s *newrows =
+                (struct Dwarf_Frame_Row_s *)realloc(rt->rt_rows,
+                newsize*sizeof(struct Dwarf_Frame_Row_s));
+
+            if (!newrows) {
+                _dwarf_error(dbg, error, DW_DLE_DF_ALLOC_FAIL);
+                res = DW_DLV_ERROR;
+                break;
+            }
+            rt->rt_rows = newrows;
+            rows_size = newsize;
+        }
+        row = rt->rt_rows + rt->rt_row_count;
+        row->fw_loc = work.fr_loc;
+        row->fw_cfa_rule = work.fr_cfa_rule;
+        row->fw_first_delta = rt->rt_delta_count;
+        row->fw_delta_count = 0;
+        for (i = 0; i < reg_count; ++i) {
+            struct Dwarf_Frame_Row_Delta_s *d = 0;
+
+            if (!reg_rules_differ(&work.fr_reg[i],&prev[i])) {
+                continue;
+            }
+            if (rt->rt_delta_count >= deltas_size) {
+                Dwarf_Unsigned newsize = deltas_size? deltas_size*2: 16;
+                struct Dwarf_Frame_Row_Delta_s *newdeltas =
+                    (struct Dwarf_Frame_Row_Delta_s *)realloc(
+                    rt->rt_deltas,
+                    newsize*sizeof(struct Dwarf_Frame_Row_Delta_s));
+
+                if (!newdeltas) {
+                    _dwarf_error(dbg, error, DW_DLE_DF_ALLOC_FAIL);
+                    res = DW_DLV_ERROR;
+                    break;
+                }
+                rt->rt_deltas = newdeltas;
+                deltas_size = newsize;
+            }
+            d = rt->rt_deltas + rt->rt_delta_count;
+            d->rd_column = i;
+            d->rd_rule = work.fr_reg[i];
+            prev[i] = work.fr_reg[i];
+            rt->rt_delta_count++;
+            row->fw_delta_count++;
+        }
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        rt->rt_row_count++;
+        if ((sizeof(struct Dwarf_Frame_Rows_s) +
+            rt->rt_row_count*sizeof(struct Dwarf_Frame_Row_s) +
+            rt->rt_delta_count*sizeof(struct Dwarf_Frame_Row_Delta_s)) >
+            dbg->de_frame_row_cache.rc_max_bytes) {
+            /*  Will not fit, so stop now rather than
+                evaluating rows we would discard. */
+            res = DW_DLV_NO_ENTRY;
+            break;
+        }
+        if (!has_more_rows || subsequent_pc <= pc ||
+            subsequent_pc >= pc_end) {
+            rt->rt_last_has_more_rows = has_more_rows;
+            rt->rt_last_subsequent_pc = subsequent_pc;
+            break;
+        }
+        pc = subsequent_pc;
     }
+    free(prev);
+    dwarf_free_fde_table(&work);
     if (res != DW_DLV_OK) {
+        free_frame_rows(rt);
         return res;
     }
+    rt->rt_bytes = sizeof(struct Dwarf_Frame_Rows_s) +
+        rows_size*sizeof(struct Dwarf_Frame_Row_s) +
+        deltas_size*sizeof(struct Dwarf_Frame_Row_Delta_s);
+    if (rt->rt_bytes > dbg->de_frame_row_cache.rc_max_bytes) {
+        free_frame_rows(rt);
+        return DW_DLV_NO_ENTRY;
+    }
+    *rows_out = rt;
+    return DW_DLV_OK;
+}
 
+/*  Answers a pc query from the fde's row table,
+    building the table first if need be.
+    Returns DW_DLV_NO_ENTRY if the caller
+    should execute the instructions directly. */
+static int
+get_fde_row_from_cache(Dwarf_Fde fde,
+    Dwarf_Addr pc_requested,
+    Dwarf_Frame table,
+    Dwarf_Half cfa_reg_col_num,
+    Dwarf_Bool * has_more_rows,
+    Dwarf_Addr * subsequent_pc,
+    Dwarf_Error * error)
+{
+    Dwarf_Debug dbg = fde->fd_dbg;
+    struct Dwarf_Frame_Row_Cache_s *rc = &dbg->de_frame_row_cache;
+    struct Dwarf_Frame_Rows_s *rt = fde->fd_rows;
+    struct Dwarf_Frame_Row_s *row = 0;
+    struct Dwarf_Reg_Rule_s *cierules = fde->fd_cie->ci_initial_table->fr_reg;
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = 0;
+    Dwarf_Unsigned k = 0;
+    Dwarf_Unsigned r = 0;
+    unsigned regcount = 0;
+
+    if (!rt) {
+        int res = 0;
+
+        if (fde->fd_rows_no_fit_max &&
+            rc->rc_max_bytes <= fde->fd_rows_no_fit_max) {
+            return DW_DLV_NO_ENTRY;
+        }
+        res = build_fde_rows(dbg,fde,cfa_reg_col_num,&rt,error);
+        if (res == DW_DLV_NO_ENTRY) {
+            fde->fd_rows_no_fit_max = rc->rc_max_bytes;
+        }
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        trim_frame_row_cache(dbg,rt->rt_bytes);
+        fde->fd_rows = rt;
+        fde->fd_rows_lru_prev = 0;
+        fde->fd_rows_lru_next = rc->rc_lru_head;
+        if (rc->rc_lru_head) {
+            rc->rc_lru_head->fd_rows_lru_prev = fde;
+        } else {
+            rc->rc_lru_tail = fde;
+        }
+        rc->rc_lru_head = fde;
+        rc->rc_bytes += rt->rt_bytes;
+    } else {
+        make_fde_rows_most_recent(dbg,fde);
+    }
+
+    /*  Find the last row with fw_loc <= pc_requested.
+        rt_rows[0].fw_loc is the fde initial location
+        so there always is one. */
+    high = rt->rt_row_count;
+    while ((high - low) > 1) {
+        Dwarf_Unsigned mid = low + (high - low)/2;
+
+        if (rt->rt_rows[mid].fw_loc <= pc_requested) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    k = low;
+
+    regcount = MIN(table->fr_reg_count,
+        fde->fd_cie->ci_initial_table->fr_reg_count);
+    memcpy(table->fr_reg,cierules,
+        regcount*sizeof(struct Dwarf_Reg_Rule_s));
+    for (r = 0; r <= k; ++r) {
+        struct Dwarf_Frame_Row_Delta_s *d = 0;
+        struct Dwarf_Frame_Row_Delta_s *dend = 0;
+
+        row = rt->rt_rows + r;
+        d = rt->rt_deltas + row->fw_first_delta;
+        dend = d + row->fw_delta_count;
+        for ( ; d < dend; ++d) {
+            if (d->rd_column < regcount) {
+                table->fr_reg[d->rd_column] = d->rd_rule;
+            }
+        }
+    }
+    row = rt->rt_rows + k;
+    table->fr_loc = row->fw_loc;
+    table->fr_cfa_rule = row->fw_cfa_rule;
+    if ((k+1) < rt->rt_row_count) {
+        if (has_more_rows) {
+            *has_more_rows = true;
+        }
+        if (subsequent_pc) {
+            *subsequent_pc = rt->rt_rows[k+1].fw_loc;
+        }
+    } else {
+        if (has_more_rows) {
+            *has_more_rows = rt->rt_last_has_more_rows;
+        }
+        if (subsequent_pc) {
+            *subsequent_pc = rt->rt_last_subsequent_pc;
+        }
+    }
     return DW_DLV_OK;
 }
 
+/* Return the register rules for all registers at a given pc.
+*/
+static int
+_dwarf_get_fde_info_for_a_pc_row(Dwarf_Fde fde,
+    Dwarf_Addr pc_requested,
+    Dwarf_Frame table,
+    Dwarf_Half cfa_reg_col_num,
+    Dwarf_Bool * has_more_rows,
+    Dwarf_Addr * subsequent_pc,
+    Dwarf_Error * error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Cie cie = 0;
+    int res = 0;
+
+    if (fde == NULL) {
+        _dwarf_error(NULL, error, DW_DLE_FDE_NULL);
+        return DW_DLV_ERROR;
+    }
+
+    dbg = fde->fd_dbg;
+    if (dbg == NULL) {
+        _dwarf_error(NULL, error, DW_DLE_FDE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+
+    if (pc_requested < fde->fd_initial_location ||
+        pc_requested >=
+        fde->fd_initial_location + fde->fd_address_range) {
+        _dwarf_error(dbg, error, DW_DLE_PC_NOT_IN_FDE_RANGE);
+        return DW_DLV_ERROR;
+    }
+
+    cie = fde->fd_cie;
+    res = ensure_cie_initial_table(dbg,cie,cfa_reg_col_num,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (dbg->de_frame_row_cache.rc_max_bytes &&
+        cfa_reg_col_num == dbg->de_frame_cfa_col_number) {
+        res = get_fde_row_from_cache(fde,pc_requested,table,
+            cfa_reg_col_num,has_more_rows,subsequent_pc,error);
+        if (res != DW_DLV_NO_ENTRY) {
+            return res;
+        }
+        /*  Too big to cache. Just do it directly. */
+    }
+    return exec_fde_instr_for_pc(fde,pc_requested,table,
+        cfa_reg_col_num,has_more_rows,subsequent_pc,error);
+}
+
 /*  A consumer call for efficiently getting the register info
     for all registers in one call.
 
@@ -2440,6 +2816,7 @@ dwarf_set_frame_rule_initial_value(Dwarf_Debug dbg, Dwarf_Half value)
 {
     Dwarf_Half orig = dbg->de_frame_rule_initial_value;
     dbg->de_frame_rule_initial_value = value;
+    _dwarf_frame_row_cache_flush(dbg);
     return orig;
 }
 
@@ -2475,6 +2852,7 @@ dwarf_set_frame_rule_table_size(Dwarf_Debug dbg, Dwarf_Half value)
     if (value < DW_FRAME_LAST_REG_NUM) {
         dbg->de_frame_reg_rules_entry_count = DW_FRAME_LAST_REG_NUM;
     }
+    _dwarf_frame_row_cache_flush(dbg);
     return orig;
 }
 /*  This allows consumers to set the CFA register value
@@ -2492,6 +2870,7 @@ dwarf_set_frame_cfa_value(Dwarf_Debug dbg, Dwarf_Half value)
 {
     Dwarf_Half orig = dbg->de_frame_cfa_col_number;
     dbg->de_frame_cfa_col_number = value;
+    _dwarf_frame_row_cache_flush(dbg);
     return orig;
 }
 /* Similar to above, but for the other crucial fields for frames. */
@@ -2500,6 +2879,7 @@ dwarf_set_frame_same_value(Dwarf_Debug dbg, Dwarf_Half value)
 {
     Dwarf_Half orig = dbg->de_frame_same_value_number;
     dbg->de_frame_same_value_number = value;
+    _dwarf_frame_row_cache_flush(dbg);
     return orig;
 }
 Dwarf_Half
@@ -2507,6 +2887,27 @@ dwarf_set_frame_undefined_value(Dwarf_Debug dbg, Dwarf_Half value)
 {
     Dwarf_Half orig = dbg->de_frame_same_value_number;
     dbg->de_frame_undefined_value_number = value;
+    _dwarf_frame_row_cache_flush(dbg);
+    return orig;
+}
+
+/*  Sets the limit, in bytes, of the memory used for
+    per-fde compiled row tables and returns the previous limit.
+    With a non-zero limit the first pc query on an fde
+    evaluates all the rows of that fde once and later
+    queries on it are a binary search.
+    The least recently used fde row tables are dropped
+    to stay within the limit.
+    Zero (the default) turns the cache off and frees
+    any row tables.
+    New October 2026. */
+Dwarf_Unsigned
+dwarf_set_frame_row_cache_size(Dwarf_Debug dbg, Dwarf_Unsigned max_bytes)
+{
+    Dwarf_Unsigned orig = dbg->de_frame_row_cache.rc_max_bytes;
+
+    dbg->de_frame_row_cache.rc_max_bytes = max_bytes;
+    trim_frame_row_cache(dbg,0);
     return orig;
 }
 
@@ -2588,6 +2989,9 @@ _dwarf_fde_destructor(void *f)
         dwarf_free_fde_table(&fde->fd_fde_table);
         fde->fd_have_fde_tab = false;
     }
+    if (fde->fd_rows) {
+        drop_fde_rows(fde->fd_dbg,fde);
+    }
 }
 
 static void
@@ -331,8 +331,60 @@ struct Dwarf_Fde_s {
     Dwarf_Addr    fd_fde_pc_requested;
     Dwarf_Bool    fd_have_fde_tab;
 
+    /*  Non-null if the row cache is on (see
+        dwarf_set_frame_row_cache_size()) and this fde's
+        complete row table has been built.
+        fd_rows_lru_prev/next link the fdes with
+        row tables, most recently used first, so the
+        least recently used can be dropped
+        when the cache is full. */
+    struct Dwarf_Frame_Rows_s *fd_rows;
+    Dwarf_Fde fd_rows_lru_prev;
+    Dwarf_Fde fd_rows_lru_next;
+    /*  Non-zero: the row table did not fit in a cache
+        of this many bytes, so do not try again
+        unless the cache is made bigger. */
+    Dwarf_Unsigned fd_rows_no_fit_max;
 };
 
+/*  One register rule that differs from that in the
+    previous row (or, for the first row,
+    from the CIE initial instructions row). */
+struct Dwarf_Frame_Row_Delta_s {
+    Dwarf_Half              rd_column;
+    struct Dwarf_Reg_Rule_s rd_rule;
+};
+
+/*  One row of a compiled row table.  Its register rules
+    are those of the previous row changed by
+    fw_delta_count deltas starting at fw_first_delta.  */
+struct Dwarf_Frame_Row_s {
+    Dwarf_Addr              fw_loc;
+    struct Dwarf_Reg_Rule_s fw_cfa_rule;
+    Dwarf_Unsigned          fw_first_delta;
+    Dwarf_Unsigned          fw_delta_count;
+};
+
+/*  The fully evaluated rows of one FDE, built by running
+    the frame instructions once, so later pc queries
+    are a binary search plus replaying a few deltas.  */
+struct Dwarf_Frame_Rows_s {
+    struct Dwarf_Frame_Row_s       *rt_rows;
+    Dwarf_Unsigned                  rt_row_count;
+    struct Dwarf_Frame_Row_Delta_s *rt_deltas;
+    Dwarf_Unsigned                  rt_delta_count;
+
+    /*  What the instructions said after the last row,
+        exactly as _dwarf_exec_frame_instr() reported it. */
+    Dwarf_Bool                      rt_last_has_more_rows;
+    Dwarf_Addr                      rt_last_subsequent_pc;
+
+    /* Bytes charged against the cache limit. */
+    Dwarf_Unsigned                  rt_bytes;
+};
+
+void _dwarf_frame_row_cache_flush(Dwarf_Debug dbg);
+
 
 int
 _dwarf_frame_address_offsets(Dwarf_Debug dbg, Dwarf_Addr ** addrlist,
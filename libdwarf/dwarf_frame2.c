@@ -1673,3 +1673,258 @@ dwarf_fde_cie_list_dealloc(Dwarf_Debug dbg,
     if (fde_data)
         dwarf_dealloc(dbg, fde_data, DW_DLA_LIST);
 }
+
+/*  Reads one encoded value from .eh_frame_hdr.
+    Only the applications gcc and the linkers use
+    in .eh_frame_hdr are handled: absolute,
+    DW_EH_PE_pcrel and DW_EH_PE_datarel (relative to the
+    start of .eh_frame_hdr).
+    Returns DW_DLV_NO_ENTRY for anything else. */
+static int
+read_eh_hdr_value(Dwarf_Debug dbg,
+    Dwarf_Small * hdr_start,
+    Dwarf_Small * input_field,
+    int gnu_encoding,
+    Dwarf_Small * hdr_end,
+    Dwarf_Unsigned * value_out,
+    Dwarf_Small ** input_field_updated,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned value = 0;
+    Dwarf_Addr hdr_addr = dbg->de_debug_frame_eh_gnu_hdr.dss_addr;
+    int res = 0;
+
+    if (gnu_encoding == DW_EH_PE_omit || (gnu_encoding & 0x80)) {
+        /* Omitted or indirect. */
+        return DW_DLV_NO_ENTRY;
+    }
+    res = read_encoded_ptr(dbg, (Dwarf_Small *)NULL,
+        input_field, gnu_encoding & 0x0f, hdr_end,
+        dbg->de_pointer_size,
+        &value, input_field_updated, error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    switch (gnu_encoding & 0x70) {
+    case DW_EH_PE_absptr:
+        break;
+    case DW_EH_PE_pcrel:
+        value += hdr_addr + (input_field - hdr_start);
+        break;
+    case DW_EH_PE_datarel:
+        value += hdr_addr;
+        break;
+    default:
+        return DW_DLV_NO_ENTRY;
+    }
+    *value_out = value;
+    return DW_DLV_OK;
+}
+
+/*  Size of one fixed-size encoded value, or zero if
+    the encoding is not fixed-size. */
+static unsigned
+eh_hdr_encoded_size(int gnu_encoding, Dwarf_Half address_size)
+{
+    switch (gnu_encoding & 0x0f) {
+    case DW_EH_PE_absptr:
+        return address_size;
+    case DW_EH_PE_udata2:
+    case DW_EH_PE_sdata2:
+        return 2;
+    case DW_EH_PE_udata4:
+    case DW_EH_PE_sdata4:
+        return 4;
+    case DW_EH_PE_udata8:
+    case DW_EH_PE_sdata8:
+        return 8;
+    default:
+        break;
+    }
+    return 0;
+}
+
+/*  Finds the .eh_frame FDE for pc_of_interest using
+    the binary search table in .eh_frame_hdr, creating only
+    that FDE and its CIE.  Unlike dwarf_get_fde_list_eh()
+    this does not read all of .eh_frame, so a few lookups
+    in a large executable are cheap.
+    The CIEs are kept (in de_eh_hdr_cie_head) and shared
+    by later calls.  The caller should
+    dwarf_dealloc(dbg,fde,DW_DLA_FDE) the returned fde
+    when done with it.
+    Returns DW_DLV_NO_ENTRY if there is no .eh_frame_hdr,
+    if its table is absent or in a form this does not
+    handle, or if no FDE covers pc_of_interest.
+    New October 2026. */
+int
+dwarf_get_fde_at_pc_eh_hdr(Dwarf_Debug dbg,
+    Dwarf_Addr pc_of_interest,
+    Dwarf_Fde * returned_fde,
+    Dwarf_Addr * lopc,
+    Dwarf_Addr * hipc,
+    Dwarf_Error * error)
+{
+    struct Dwarf_Section_s *hdrsec = 0;
+    struct Dwarf_Section_s *ehsec = 0;
+    Dwarf_Small *hdr_start = 0;
+    Dwarf_Small *hdr_end = 0;
+    Dwarf_Small *ptr = 0;
+    Dwarf_Small *table = 0;
+    Dwarf_Small *eh_start = 0;
+    Dwarf_Small *eh_end = 0;
+    Dwarf_Small *cieptr_val = 0;
+    Dwarf_Small version = 0;
+    Dwarf_Small eh_frame_ptr_enc = 0;
+    Dwarf_Small fde_count_enc = 0;
+    Dwarf_Small table_enc = 0;
+    Dwarf_Unsigned eh_frame_addr = 0;
+    Dwarf_Unsigned fde_count = 0;
+    Dwarf_Unsigned entry_size = 0;
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = 0;
+    Dwarf_Unsigned fde_addr = 0;
+    Dwarf_Unsigned fde_offset = 0;
+    Dwarf_Cie cie = 0;
+    Dwarf_Fde fde = 0;
+    struct cie_fde_prefix_s prefix;
+    int res = 0;
+
+    if (dbg == NULL) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    hdrsec = &dbg->de_debug_frame_eh_gnu_hdr;
+    ehsec = &dbg->de_debug_frame_eh_gnu;
+    res = _dwarf_load_section(dbg, hdrsec,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = _dwarf_load_section(dbg, ehsec,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    hdr_start = hdrsec->dss_data;
+    hdr_end = hdr_start + hdrsec->dss_size;
+    eh_start = ehsec->dss_data;
+    eh_end = eh_start + ehsec->dss_size;
+    if (hdrsec->dss_size < 4) {
+        return DW_DLV_NO_ENTRY;
+    }
+    version = hdr_start[0];
+    eh_frame_ptr_enc = hdr_start[1];
+    fde_count_enc = hdr_start[2];
+    table_enc = hdr_start[3];
+    if (version != 1) {
+        return DW_DLV_NO_ENTRY;
+    }
+    ptr = hdr_start + 4;
+    res = read_eh_hdr_value(dbg,hdr_start,ptr,eh_frame_ptr_enc,
+        hdr_end,&eh_frame_addr,&ptr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = read_eh_hdr_value(dbg,hdr_start,ptr,fde_count_enc,
+        hdr_end,&fde_count,&ptr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    entry_size = 2*eh_hdr_encoded_size(table_enc,dbg->de_pointer_size);
+    if (!entry_size || !fde_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    table = ptr;
+    if (fde_count > (Dwarf_Unsigned)(hdr_end - table)/entry_size) {
+        _dwarf_error(dbg, error, DW_DLE_DEBUG_FRAME_LENGTH_BAD);
+        return DW_DLV_ERROR;
+    }
+
+    /*  The table is sorted by initial location.
+        Find the last entry at or below pc_of_interest. */
+    high = fde_count;
+    while (low < high) {
+        Dwarf_Unsigned mid = low + (high - low)/2;
+        Dwarf_Unsigned loc = 0;
+        Dwarf_Small *unused = 0;
+
+        res = read_eh_hdr_value(dbg,hdr_start,table + mid*entry_size,
+            table_enc,hdr_end,&loc,&unused,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (loc <= pc_of_interest) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == 0) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = read_eh_hdr_value(dbg,hdr_start,
+        table + (low-1)*entry_size + entry_size/2,
+        table_enc,hdr_end,&fde_addr,&ptr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    fde_offset = fde_addr - eh_frame_addr;
+    if (fde_addr < eh_frame_addr || fde_offset >= ehsec->dss_size) {
+        _dwarf_error(dbg, error, DW_DLE_DEBUG_FRAME_LENGTH_BAD);
+        return DW_DLV_ERROR;
+    }
+
+    memset(&prefix, 0, sizeof(prefix));
+    res = dwarf_read_cie_fde_prefix(dbg, eh_start + fde_offset,
+        eh_start, ehsec->dss_index, ehsec->dss_size,
+        &prefix, error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (prefix.cf_cie_id == 0) {
+        /* The table pointed at a CIE, not an FDE. */
+        _dwarf_error(dbg, error, DW_DLE_NO_CIE_FOR_FDE);
+        return DW_DLV_ERROR;
+    }
+    cieptr_val = get_cieptr_given_offset(prefix.cf_cie_id,
+        /* use_gnu_cie_calc= */ 1,
+        eh_start, prefix.cf_cie_id_addr);
+    res = dwarf_find_existing_cie_ptr(cieptr_val,
+        dbg->de_eh_hdr_cie_head, &cie, dbg->de_eh_hdr_cie_head);
+    if (res == DW_DLV_NO_ENTRY) {
+        res = dwarf_create_cie_from_start(dbg, cieptr_val,
+            eh_start, ehsec->dss_index, ehsec->dss_size,
+            eh_end,
+            /* cie_id_value */ 0,
+            dbg->de_eh_hdr_cie_count,
+            /* use_gnu_cie_calc= */ 1,
+            &cie, error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        cie->ci_next = dbg->de_eh_hdr_cie_head;
+        dbg->de_eh_hdr_cie_head = cie;
+        dbg->de_eh_hdr_cie_count++;
+    }
+    res = dwarf_create_fde_from_after_start(dbg, &prefix,
+        eh_start, prefix.cf_addr_after_prefix, eh_end,
+        /* use_gnu_cie_calc= */ 1,
+        cie, &fde, error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (pc_of_interest < fde->fd_initial_location ||
+        pc_of_interest >= (fde->fd_initial_location +
+        fde->fd_address_range)) {
+        /* pc_of_interest is in a gap between FDEs. */
+        dwarf_dealloc(dbg, fde, DW_DLA_FDE);
+        return DW_DLV_NO_ENTRY;
+    }
+    if (lopc != NULL) {
+        *lopc = fde->fd_initial_location;
+    }
+    if (hipc != NULL) {
+        *hipc = fde->fd_initial_location + fde->fd_address_range - 1;
+    }
+    *returned_fde = fde;
+    return DW_DLV_OK;
+}
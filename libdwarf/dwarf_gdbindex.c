@@ -413,6 +413,88 @@ dwarf_gdbindex_symboltable_entry(
     return DW_DLV_OK;
 }
 
+/*  The gdb symbol name hash, mapped_index_string_hash()
+    in gdb. From version 5 on names are hashed as
+    if lower case. */
+static Dwarf_Unsigned
+gdbindex_name_hash(Dwarf_Unsigned version, const char *name)
+{
+    const unsigned char *cp = (const unsigned char *)name;
+    gdbindex_offset_type r = 0;
+
+    for (; *cp; ++cp) {
+        unsigned c = *cp;
+
+        if (version >= 5 && c >= 'A' && c <= 'Z') {
+            c = c - 'A' + 'a';
+        }
+        r = r * 67 + c - 113;
+    }
+    return r;
+}
+
+/*  New October 2026.
+    Finds name in the symbol table hash, the way gdb does,
+    and returns the index of its symbol table entry
+    (for dwarf_gdbindex_symboltable_entry()).
+    The table size is a power of two; the probe step
+    comes from the hash too.  Version 4 and later
+    indexes can be searched this way. */
+int
+dwarf_gdbindex_symboltable_lookup(Dwarf_Gdbindex gdbindexptr,
+    const char     * name,
+    Dwarf_Unsigned * entryindex,
+    Dwarf_Error    * error)
+{
+    Dwarf_Unsigned count =  gdbindexptr->gi_symboltablehdr.dg_count;
+    unsigned fieldlen = gdbindexptr->gi_symboltablehdr.dg_fieldlen;
+    Dwarf_Small *section_end = gdbindexptr->gi_section_data +
+        gdbindexptr->gi_section_length;
+    Dwarf_Small *pooldata = gdbindexptr->gi_section_data +
+        gdbindexptr->gi_constant_pool_offset;
+    Dwarf_Unsigned hash = 0;
+    Dwarf_Unsigned slot = 0;
+    Dwarf_Unsigned step = 0;
+    Dwarf_Unsigned probes = 0;
+
+    if (gdbindexptr->gi_version < 4 ||
+        !count || (count & (count-1))) {
+        _dwarf_error(gdbindexptr->gi_dbg, error,
+            DW_DLE_GDB_INDEX_INDEX_ERROR);
+        return DW_DLV_ERROR;
+    }
+    hash = gdbindex_name_hash(gdbindexptr->gi_version,name);
+    slot = hash & (count-1);
+    step = (((hash * 17) & 0xffffffff) & (count-1)) | 1;
+    for (probes = 0; probes < count; ++probes) {
+        Dwarf_Small *base = gdbindexptr->gi_symboltablehdr.dg_base +
+            slot*gdbindexptr->gi_symboltablehdr.dg_entry_length;
+        Dwarf_Unsigned symoffset = 0;
+        Dwarf_Unsigned cuoffset = 0;
+        Dwarf_Small *str = 0;
+
+        READ_GDBINDEX(symoffset ,Dwarf_Unsigned,
+            base,
+            fieldlen);
+        READ_GDBINDEX(cuoffset ,Dwarf_Unsigned,
+            base + fieldlen,
+            fieldlen);
+        if (!symoffset && !cuoffset) {
+            /* An empty slot. */
+            return DW_DLV_NO_ENTRY;
+        }
+        str = pooldata + symoffset;
+        if (str < section_end &&
+            memchr(str,0,section_end - str) &&
+            !strcmp((const char *)str,name)) {
+            *entryindex = slot;
+            return DW_DLV_OK;
+        }
+        slot = (slot + step) & (count-1);
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
 int
 dwarf_gdbindex_cuvector_length(Dwarf_Gdbindex gdbindex,
     Dwarf_Unsigned   cuvector_offset,
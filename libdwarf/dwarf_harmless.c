@@ -56,8 +56,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "dwarf_frame.h"
+#include "dwarf_concurrent.h"
 #include "dwarf_harmless.h"
 
+static int get_harmless_error_list(struct Dwarf_Harmless_s *dhp,
+    unsigned count,
+    const char ** errmsg_ptrs_array,
+    unsigned * errs_count);
+static void insert_harmless_error(struct Dwarf_Harmless_s *dhp,
+    char *newerror);
 
 /*  The pointers returned here through errmsg_ptrs_array
     become invalidated by any call to libdwarf. Any call.
@@ -68,6 +75,21 @@ int dwarf_get_harmless_error_list(Dwarf_Debug dbg,
     unsigned * errs_count)
 {
     struct Dwarf_Harmless_s *dhp = &dbg->de_harmless_errors;
+    int res = 0;
+
+    DWARF_STATE_LOCK(dbg);
+    res = get_harmless_error_list(dhp,count,errmsg_ptrs_array,
+        errs_count);
+    DWARF_STATE_UNLOCK(dbg);
+    return res;
+}
+
+static int
+get_harmless_error_list(struct Dwarf_Harmless_s *dhp,
+    unsigned  count,
+    const char ** errmsg_ptrs_array,
+    unsigned * errs_count)
+{
     if (!dhp->dh_errors) {
         dhp->dh_errs_count = 0;
         return DW_DLV_NO_ENTRY;
@@ -121,7 +143,15 @@ safe_strncpy(char *targ, char *src, unsigned spaceavail)
 void dwarf_insert_harmless_error(Dwarf_Debug dbg,
     char *newerror)
 {
-    struct Dwarf_Harmless_s *dhp = &dbg->de_harmless_errors;
+    DWARF_STATE_LOCK(dbg);
+    insert_harmless_error(&dbg->de_harmless_errors,newerror);
+    DWARF_STATE_UNLOCK(dbg);
+}
+
+static void
+insert_harmless_error(struct Dwarf_Harmless_s *dhp,
+    char *newerror)
+{
     unsigned next = 0;
     unsigned cur = dhp->dh_next_to_use;
     char *msgspace;
@@ -0,0 +1,590 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    The index cache.
+    A symbolizer opens the same objects over and over
+    and each open used to build its address-to-line index
+    (dwarf_addr_line.c) again from the line tables.
+    With dwarf_set_index_cache_dir() the index, once built,
+    is written to a file in the cache directory, and
+    dwarf_addr_line_index_build() on a later open of the
+    same object maps that file and uses the rows,
+    sequences and file names in place.
+
+    The file is the index arrays exactly as they are in
+    memory, after a header (struct index_cache_header_s),
+    so it is only ever read by a libdwarf built the
+    same way on a machine of the same byte order.
+    The file name is made of the object build id (or
+    "nobuildid") and a hash identifying the
+    .debug_info and .debug_line contents: with a build id
+    just their sizes, without one their bytes.
+    The header repeats all that and adds the counts
+    and a hash of everything after the header.
+    A file that does not match in every respect, or whose
+    arrays do not make a consistent index, is ignored
+    (and replaced when the index is built again).
+    Files are written under a temporary name and renamed,
+    so a reader never sees a partial file.
+    Cache failures of any kind just mean building
+    the index.  */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#include "dwarf_addr_line.h"
+#include "dwarf_index_cache.h"
+
+#define FALSE 0
+#define TRUE 1
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H)
+#define HAVE_INDEX_CACHE 1
+#endif
+
+/*  FNV-1a style, but 8 bytes at a time. */
+#define CACHE_HASH_PRIME (((Dwarf_Unsigned)0x100 << 32) | 0x1b3)
+
+Dwarf_Unsigned
+_dwarf_cache_hash(Dwarf_Unsigned h,
+    const Dwarf_Small *p,
+    Dwarf_Unsigned len)
+{
+    Dwarf_Unsigned i = 0;
+
+    for (; (i + 8) <= len; i += 8) {
+        Dwarf_Unsigned w = 0;
+
+        memcpy(&w,p+i,sizeof(w));
+        h ^= w;
+        h *= CACHE_HASH_PRIME;
+        h ^= h >> 29;
+    }
+    for (; i < len; ++i) {
+        h ^= p[i];
+        h *= CACHE_HASH_PRIME;
+    }
+    return h;
+}
+
+/*  Sets de_cache_objkey to the hex GNU build id of the
+    object, or to "nobuildid". */
+int
+_dwarf_cache_object_key(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Obj_Access_Interface_s *o = dbg->de_obj_file;
+    Dwarf_Unsigned count = o->methods->get_section_count(o->object);
+    Dwarf_Unsigned i = 1;
+    const char *key = "nobuildid";
+    char hexkey[2*64 + 1];
+
+    for ( ; i < count; ++i) {
+        Dwarf_Obj_Access_Section sec;
+        Dwarf_Small *data = 0;
+        Dwarf_Small *end = 0;
+        Dwarf_Unsigned namesz = 0;
+        Dwarf_Unsigned descsz = 0;
+        Dwarf_Small *desc = 0;
+        Dwarf_Unsigned k = 0;
+        int err = 0;
+
+        memset(&sec,0,sizeof(sec));
+        if (o->methods->get_section_info(o->object,i,&sec,&err) !=
+            DW_DLV_OK || !sec.name ||
+            strcmp(sec.name,".note.gnu.build-id") || sec.size < 16) {
+            continue;
+        }
+        if (o->methods->load_section(o->object,i,&data,&err) !=
+            DW_DLV_OK || !data) {
+            break;
+        }
+        end = data + sec.size;
+        READ_UNALIGNED_CK(dbg,namesz,Dwarf_Unsigned,data,4,
+            error,end);
+        READ_UNALIGNED_CK(dbg,descsz,Dwarf_Unsigned,data+4,4,
+            error,end);
+        desc = data + 12 + ((namesz + 3) & ~3);
+        if (descsz == 0 || descsz > 64 || desc + descsz > end) {
+            break;
+        }
+        for (k = 0; k < descsz; ++k) {
+            snprintf(hexkey + 2*k,3,"%02x",desc[k]);
+        }
+        key = hexkey;
+        break;
+    }
+    dbg->de_cache_objkey = strdup(key);
+    if (!dbg->de_cache_objkey) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Sets (or with cache_dir NULL, clears) the directory
+    of the index cache of dbg.
+    Returns DW_DLV_NO_ENTRY if this libdwarf cannot
+    map files.  */
+int
+dwarf_set_index_cache_dir(Dwarf_Debug dbg,
+    const char *cache_dir,
+    Dwarf_Error * error)
+{
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+#ifdef HAVE_INDEX_CACHE
+    free(dbg->de_index_cache_dir);
+    dbg->de_index_cache_dir = 0;
+    if (cache_dir) {
+        dbg->de_index_cache_dir = strdup(cache_dir);
+        if (!dbg->de_index_cache_dir) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+    }
+    return DW_DLV_OK;
+#else
+    return DW_DLV_NO_ENTRY;
+#endif
+}
+
+#ifdef HAVE_INDEX_CACHE
+/*  "libdwALI", the address-to-line index. */
+#define INDEX_CACHE_MAGIC   "libdwALI"
+/*  Change this whenever the file layout or the meaning
+    of anything in it changes. */
+#define INDEX_CACHE_VERSION 1
+#define INDEX_CACHE_BYTE_ORDER \
+    (((Dwarf_Unsigned)0x01020304 << 32) | 0x05060708)
+/*  The sizes of the records, as one number. */
+#define INDEX_CACHE_LAYOUT \
+    (((Dwarf_Unsigned)sizeof(struct Dwarf_Addr_Line_Row_s) << 32) | \
+    ((Dwarf_Unsigned)sizeof(struct Dwarf_Addr_Line_Seq_s) << 16) | \
+    (Dwarf_Unsigned)sizeof(Dwarf_Addr))
+
+/*  All the fields are 8 bytes so there is no padding
+    and the arrays after it are 8 byte aligned.
+    After the header come
+        ih_row_count rows,
+        ih_seq_count sequences,
+        ih_file_count Dwarf_Unsigned name offsets
+            into the names,
+        ih_names_size bytes of NUL terminated names.  */
+struct index_cache_header_s {
+    char           ih_magic[8];
+    Dwarf_Unsigned ih_version;
+    Dwarf_Unsigned ih_byte_order;
+    Dwarf_Unsigned ih_layout;
+    Dwarf_Unsigned ih_info_size;
+    Dwarf_Unsigned ih_line_size;
+    Dwarf_Unsigned ih_ident_hash;
+    Dwarf_Unsigned ih_row_count;
+    Dwarf_Unsigned ih_seq_count;
+    Dwarf_Unsigned ih_file_count;
+    Dwarf_Unsigned ih_names_size;
+    Dwarf_Unsigned ih_file_size;
+    Dwarf_Unsigned ih_payload_hash;
+};
+
+/*  Fills in the identity fields of header for dbg.
+    Returns DW_DLV_NO_ENTRY if there is no cache or
+    the object cannot be identified. */
+static int
+cache_identity(Dwarf_Debug dbg,
+    struct index_cache_header_s *header)
+{
+    struct Dwarf_Section_s *info = &dbg->de_debug_info;
+    struct Dwarf_Section_s *line = &dbg->de_debug_line;
+    Dwarf_Error err = 0;
+    Dwarf_Unsigned h = DW_CACHE_HASH_SEED;
+
+    if (!dbg->de_index_cache_dir) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (!dbg->de_cache_objkey) {
+        if (_dwarf_cache_object_key(dbg,&err) != DW_DLV_OK) {
+            dwarf_dealloc(dbg,err,DW_DLA_ERROR);
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    /*  Loaded first as the size of a compressed
+        section changes when it is loaded. */
+    if (_dwarf_load_debug_info(dbg,&err) != DW_DLV_OK ||
+        _dwarf_load_section(dbg,line,&err) != DW_DLV_OK) {
+        dwarf_dealloc(dbg,err,DW_DLA_ERROR);
+        return DW_DLV_NO_ENTRY;
+    }
+    memset(header,0,sizeof(*header));
+    memcpy(header->ih_magic,INDEX_CACHE_MAGIC,
+        sizeof(header->ih_magic));
+    header->ih_version = INDEX_CACHE_VERSION;
+    header->ih_byte_order = INDEX_CACHE_BYTE_ORDER;
+    header->ih_layout = INDEX_CACHE_LAYOUT;
+    header->ih_info_size = info->dss_size;
+    header->ih_line_size = line->dss_size;
+    h = _dwarf_cache_hash(h,(Dwarf_Small *)&header->ih_info_size,
+        2*sizeof(Dwarf_Unsigned));
+    if (!strcmp(dbg->de_cache_objkey,"nobuildid")) {
+        h = _dwarf_cache_hash(h,info->dss_data,info->dss_size -
+            info->dss_size%8);
+        h = _dwarf_cache_hash(h,line->dss_data,line->dss_size);
+    }
+    header->ih_ident_hash = h;
+    return DW_DLV_OK;
+}
+
+/*  Returns the malloc-ed cache file name for header,
+    or NULL. */
+static char *
+cache_path(Dwarf_Debug dbg,
+    struct index_cache_header_s *header)
+{
+    char *path = 0;
+    size_t len = strlen(dbg->de_index_cache_dir) +
+        strlen(dbg->de_cache_objkey) + 30;
+
+    path = malloc(len);
+    if (!path) {
+        return 0;
+    }
+    snprintf(path,len,"%s/%s-%016" DW_PR_DUx ".ali",
+        dbg->de_index_cache_dir,dbg->de_cache_objkey,
+        header->ih_ident_hash);
+    return path;
+}
+
+/*  Returns DW_DLV_OK if the mapped file at area, size
+    bytes long, is a consistent index with the identity
+    in expect (checking the header first, as that is
+    quick). */
+static int
+check_cache_file(Dwarf_Small *area,
+    Dwarf_Unsigned size,
+    struct index_cache_header_s *expect)
+{
+    struct index_cache_header_s *header =
+        (struct index_cache_header_s *)area;
+    Dwarf_Unsigned rowsize = sizeof(struct Dwarf_Addr_Line_Row_s);
+    Dwarf_Unsigned seqsize = sizeof(struct Dwarf_Addr_Line_Seq_s);
+    Dwarf_Unsigned offsize = sizeof(Dwarf_Unsigned);
+    Dwarf_Unsigned left = 0;
+    struct Dwarf_Addr_Line_Row_s *rows = 0;
+    struct Dwarf_Addr_Line_Seq_s *seqs = 0;
+    Dwarf_Unsigned *offsets = 0;
+    Dwarf_Small *names = 0;
+    Dwarf_Unsigned i = 0;
+
+    if (size < sizeof(*header) ||
+        memcmp(header->ih_magic,expect->ih_magic,
+            sizeof(header->ih_magic)) ||
+        header->ih_version != expect->ih_version ||
+        header->ih_byte_order != expect->ih_byte_order ||
+        header->ih_layout != expect->ih_layout ||
+        header->ih_info_size != expect->ih_info_size ||
+        header->ih_line_size != expect->ih_line_size ||
+        header->ih_ident_hash != expect->ih_ident_hash ||
+        header->ih_file_size != size) {
+        return DW_DLV_NO_ENTRY;
+    }
+    /*  The counts must account for the file size exactly.
+        Dividing first means nothing can overflow. */
+    left = size - sizeof(*header);
+    if (header->ih_row_count > left/rowsize) {
+        return DW_DLV_NO_ENTRY;
+    }
+    left -= header->ih_row_count*rowsize;
+    if (header->ih_seq_count > left/seqsize) {
+        return DW_DLV_NO_ENTRY;
+    }
+    left -= header->ih_seq_count*seqsize;
+    if (header->ih_file_count > left/offsize) {
+        return DW_DLV_NO_ENTRY;
+    }
+    left -= header->ih_file_count*offsize;
+    if (header->ih_names_size != left) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (_dwarf_cache_hash(DW_CACHE_HASH_SEED,area + sizeof(*header),
+        size - sizeof(*header)) != header->ih_payload_hash) {
+        return DW_DLV_NO_ENTRY;
+    }
+
+    /*  The hash matching should mean the file is as
+        written, but a lookup must not be able to go
+        outside the arrays whatever the file holds. */
+    rows = (struct Dwarf_Addr_Line_Row_s *)(header+1);
+    seqs = (struct Dwarf_Addr_Line_Seq_s *)(rows +
+        header->ih_row_count);
+    offsets = (Dwarf_Unsigned *)(seqs + header->ih_seq_count);
+    names = (Dwarf_Small *)(offsets + header->ih_file_count);
+    for (i = 0; i < header->ih_seq_count; ++i) {
+        if (!seqs[i].as_row_count ||
+            seqs[i].as_first_row >= header->ih_row_count ||
+            seqs[i].as_row_count >
+                header->ih_row_count - seqs[i].as_first_row) {
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    for (i = 0; i < header->ih_row_count; ++i) {
+        if (rows[i].ar_file != ADDR_LINE_NO_FILE &&
+            rows[i].ar_file >= header->ih_file_count) {
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    if (header->ih_file_count &&
+        (!header->ih_names_size ||
+        names[header->ih_names_size-1] != 0)) {
+        return DW_DLV_NO_ENTRY;
+    }
+    for (i = 0; i < header->ih_file_count; ++i) {
+        if (offsets[i] >= header->ih_names_size) {
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    return DW_DLV_OK;
+}
+
+/*  Returns DW_DLV_OK if index is now the index
+    mapped from the cache file for dbg,
+    else DW_DLV_NO_ENTRY. */
+int
+_dwarf_addr_line_cache_load(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index)
+{
+    struct index_cache_header_s expect;
+    struct index_cache_header_s *header = 0;
+    char *path = 0;
+    struct stat st;
+    Dwarf_Small *area = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Unsigned *offsets = 0;
+    char *names = 0;
+    Dwarf_Unsigned i = 0;
+    int fd = -1;
+
+    if (cache_identity(dbg,&expect) != DW_DLV_OK) {
+        return DW_DLV_NO_ENTRY;
+    }
+    path = cache_path(dbg,&expect);
+    if (!path) {
+        return DW_DLV_NO_ENTRY;
+    }
+    fd = open(path,O_RDONLY);
+    free(path);
+    if (fd < 0) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (fstat(fd,&st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return DW_DLV_NO_ENTRY;
+    }
+    size = (Dwarf_Unsigned)st.st_size;
+    area = mmap(0,size,PROT_READ,MAP_PRIVATE,fd,0);
+    close(fd);
+    if (area == MAP_FAILED) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (check_cache_file(area,size,&expect) != DW_DLV_OK) {
+        munmap(area,size);
+        return DW_DLV_NO_ENTRY;
+    }
+    header = (struct index_cache_header_s *)area;
+    if (header->ih_file_count) {
+        index->ai_files = (char **)malloc(header->ih_file_count*
+            sizeof(char *));
+        if (!index->ai_files) {
+            munmap(area,size);
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    index->ai_rows = (struct Dwarf_Addr_Line_Row_s *)(header+1);
+    index->ai_row_count = header->ih_row_count;
+    index->ai_row_size = header->ih_row_count;
+    index->ai_seqs = (struct Dwarf_Addr_Line_Seq_s *)
+        (index->ai_rows + header->ih_row_count);
+    index->ai_seq_count = header->ih_seq_count;
+    index->ai_seq_size = header->ih_seq_count;
+    offsets = (Dwarf_Unsigned *)(index->ai_seqs + header->ih_seq_count);
+    names = (char *)(offsets + header->ih_file_count);
+    for (i = 0; i < header->ih_file_count; ++i) {
+        index->ai_files[i] = names + offsets[i];
+    }
+    index->ai_file_count = header->ih_file_count;
+    index->ai_file_size = header->ih_file_count;
+    index->ai_mmap_area = area;
+    index->ai_mmap_size = size;
+    return DW_DLV_OK;
+}
+
+/*  Returns FALSE if fewer than len bytes could be
+    written. */
+static int
+write_all(int fd, const void *p, Dwarf_Unsigned len)
+{
+    const char *cp = (const char *)p;
+
+    while (len > 0) {
+        ssize_t w = write(fd,cp,len);
+
+        if (w <= 0) {
+            return FALSE;
+        }
+        cp += w;
+        len -= w;
+    }
+    return TRUE;
+}
+
+/*  Writes the newly built index to the cache,
+    if there is one. */
+void
+_dwarf_addr_line_cache_store(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index)
+{
+    struct index_cache_header_s header;
+    Dwarf_Unsigned rowbytes = index->ai_row_count*
+        sizeof(struct Dwarf_Addr_Line_Row_s);
+    Dwarf_Unsigned seqbytes = index->ai_seq_count*
+        sizeof(struct Dwarf_Addr_Line_Seq_s);
+    Dwarf_Unsigned *offsets = 0;
+    char *names = 0;
+    Dwarf_Unsigned names_size = 0;
+    Dwarf_Unsigned h = DW_CACHE_HASH_SEED;
+    Dwarf_Unsigned i = 0;
+    char *path = 0;
+    char *tmppath = 0;
+    size_t len = 0;
+    int fd = -1;
+    int ok = FALSE;
+
+    if (cache_identity(dbg,&header) != DW_DLV_OK) {
+        return;
+    }
+    if (index->ai_file_count) {
+        offsets = (Dwarf_Unsigned *)malloc(index->ai_file_count*
+            sizeof(Dwarf_Unsigned));
+        if (!offsets) {
+            return;
+        }
+    }
+    for (i = 0; i < index->ai_file_count; ++i) {
+        offsets[i] = names_size;
+        names_size += strlen(index->ai_files[i]) + 1;
+    }
+    names = malloc(names_size? names_size: 1);
+    if (!names) {
+        free(offsets);
+        return;
+    }
+    for (i = 0; i < index->ai_file_count; ++i) {
+        strcpy(names + offsets[i],index->ai_files[i]);
+    }
+    header.ih_row_count = index->ai_row_count;
+    header.ih_seq_count = index->ai_seq_count;
+    header.ih_file_count = index->ai_file_count;
+    header.ih_names_size = names_size;
+    header.ih_file_size = sizeof(header) + rowbytes + seqbytes +
+        index->ai_file_count*sizeof(Dwarf_Unsigned) + names_size;
+    /*  Every piece but the names is a multiple of 8 bytes
+        so this is the hash of the whole payload. */
+    h = _dwarf_cache_hash(h,(Dwarf_Small *)index->ai_rows,rowbytes);
+    h = _dwarf_cache_hash(h,(Dwarf_Small *)index->ai_seqs,seqbytes);
+    h = _dwarf_cache_hash(h,(Dwarf_Small *)offsets,
+        index->ai_file_count*sizeof(Dwarf_Unsigned));
+    h = _dwarf_cache_hash(h,(Dwarf_Small *)names,names_size);
+    header.ih_payload_hash = h;
+
+    path = cache_path(dbg,&header);
+    if (path) {
+        len = strlen(path) + 30;
+        tmppath = malloc(len);
+    }
+    if (tmppath) {
+        snprintf(tmppath,len,"%s.%ld.tmp",path,(long)getpid());
+        fd = open(tmppath,O_WRONLY|O_CREAT|O_EXCL,0644);
+    }
+    if (fd >= 0) {
+        ok = write_all(fd,&header,sizeof(header)) &&
+            write_all(fd,index->ai_rows,rowbytes) &&
+            write_all(fd,index->ai_seqs,seqbytes) &&
+            write_all(fd,offsets,
+                index->ai_file_count*sizeof(Dwarf_Unsigned)) &&
+            write_all(fd,names,names_size);
+        if (close(fd) != 0 || !ok ||
+            rename(tmppath,path) != 0) {
+            unlink(tmppath);
+        }
+    }
+    free(tmppath);
+    free(path);
+    free(names);
+    free(offsets);
+}
+
+void
+_dwarf_index_cache_unmap(void *area,
+    Dwarf_Unsigned size)
+{
+    munmap(area,size);
+}
+
+#else /* !HAVE_INDEX_CACHE */
+
+int
+_dwarf_addr_line_cache_load(UNUSEDARG Dwarf_Debug dbg,
+    UNUSEDARG struct Dwarf_Addr_Line_Index_s *index)
+{
+    return DW_DLV_NO_ENTRY;
+}
+
+void
+_dwarf_addr_line_cache_store(UNUSEDARG Dwarf_Debug dbg,
+    UNUSEDARG struct Dwarf_Addr_Line_Index_s *index)
+{
+}
+
+void
+_dwarf_index_cache_unmap(UNUSEDARG void *area,
+    UNUSEDARG Dwarf_Unsigned size)
+{
+}
+#endif /* HAVE_INDEX_CACHE */
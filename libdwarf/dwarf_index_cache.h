@@ -0,0 +1,53 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  The index cache keeps derived structures of a
+    Dwarf_Debug (so far the address-to-line index)
+    in files in the dwarf_set_index_cache_dir() directory
+    so a later open of the same object maps them instead
+    of building them again.  See dwarf_index_cache.c */
+
+/*  The starting value for _dwarf_cache_hash(). */
+#define DW_CACHE_HASH_SEED \
+    (((Dwarf_Unsigned)0xcbf29ce4 << 32) | 0x84222325)
+
+/*  A hash of len bytes at p, continuing from h.
+    Hashing in pieces gives the same value as hashing
+    all at once if every piece but the last is a
+    multiple of 8 bytes long.  */
+Dwarf_Unsigned _dwarf_cache_hash(Dwarf_Unsigned h,
+    const Dwarf_Small *p,
+    Dwarf_Unsigned len);
+
+int _dwarf_cache_object_key(Dwarf_Debug dbg,
+    Dwarf_Error *error);
+
+struct Dwarf_Addr_Line_Index_s;
+int _dwarf_addr_line_cache_load(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index);
+void _dwarf_addr_line_cache_store(Dwarf_Debug dbg,
+    struct Dwarf_Addr_Line_Index_s *index);
+void _dwarf_index_cache_unmap(void *area,
+    Dwarf_Unsigned size);
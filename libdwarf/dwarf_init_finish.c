@@ -37,6 +37,8 @@
 
 #include "dwarf_incl.h"
 #include "dwarf_harmless.h"
+#include "dwarf_index_cache.h"
+#include "dwarf_concurrent.h"
 
 /* For consistency, use the HAVE_LIBELF_H symbol */
 #ifdef HAVE_ELF_H
@@ -52,6 +54,16 @@
 #ifdef HAVE_ZLIB
 #include "zlib.h"
 #endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#include <fcntl.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 #ifndef ELFCOMPRESS_ZLIB
 #define ELFCOMPRESS_ZLIB 1
@@ -74,6 +86,10 @@
 #define FALSE 0
 #define TRUE  1
 
+static int load_section(Dwarf_Debug dbg,
+    struct Dwarf_Section_s *section,
+    Dwarf_Error * error);
+
 /*  Global definition of the function pointer type, typedef
     in dwarf_opaque.h */
 _dwarf_get_elf_flags_func_ptr_type _dwarf_get_elf_flags_func_ptr;
@@ -89,7 +105,9 @@ static Dwarf_Small _dwarf_assume_string_in_bounds;
 static Dwarf_Small _dwarf_apply_relocs = 1;
 
 /*  Call this after calling dwarf_init but before doing anything else.
-    It applies to all objects, not just the current object.  */
+    It applies to all objects, not just the current object,
+    except those given their own setting with
+    dwarf_set_reloc_application_b().  */
 int
 dwarf_set_reloc_application(int apply)
 {
@@ -107,6 +125,38 @@ dwarf_set_stringcheck(int newval)
     return oldval;
 }
 
+/*  New October 2026.
+    The per-dbg versions of the above, so programs
+    using several objects (perhaps from several threads)
+    need not share one setting.  */
+int
+dwarf_set_reloc_application_b(Dwarf_Debug dbg, int apply)
+{
+    int oldval = 0;
+
+    if (!dbg) {
+        return 0;
+    }
+    oldval = dbg->de_apply_relocs_set? dbg->de_apply_relocs:
+        _dwarf_apply_relocs;
+    dbg->de_apply_relocs = apply;
+    dbg->de_apply_relocs_set = TRUE;
+    return oldval;
+}
+
+int
+dwarf_set_stringcheck_b(Dwarf_Debug dbg, int newval)
+{
+    int oldval = 0;
+
+    if (!dbg) {
+        return 0;
+    }
+    oldval = dbg->de_assume_string_in_bounds;
+    dbg->de_assume_string_in_bounds = newval;
+    return oldval;
+}
+
 /* Unifies the basic duplicate/empty testing and section
    data setting to one place. */
 static int
@@ -138,7 +188,7 @@ get_basic_section_data(Dwarf_Debug dbg,
     secdata->dss_addr = doas->addr;
     secdata->dss_link = doas->link;
     secdata->dss_entrysize = doas->entrysize;
-    if (_dwarf_get_elf_flags_func_ptr) {
+    if (dbg->de_get_elf_flags) {
         /*  We do this so we do not need to update the public struct
             Dwarf_Obj_Access_Section_s and thereby cause
             binary and source incompatibility. */
@@ -149,7 +199,7 @@ get_basic_section_data(Dwarf_Debug dbg,
         struct Dwarf_Obj_Access_Interface_s *o = 0;
 
         o = dbg->de_obj_file;
-        res = _dwarf_get_elf_flags_func_ptr(
+        res = dbg->de_get_elf_flags(
             o->object, section_index,
             &flags,&addralign,
             &interr);
@@ -402,6 +452,10 @@ enter_section_in_de_debug_sections_array(Dwarf_Debug dbg,
         &dbg->de_debug_frame_eh_gnu,
         DW_DLE_DEBUG_FRAME_DUPLICATE,0,
         TRUE,err);
+    SET_UP_SECTION(dbg,scn_name,".eh_frame_hdr",
+        &dbg->de_debug_frame_eh_gnu_hdr,
+        DW_DLE_DEBUG_FRAME_DUPLICATE,0,
+        FALSE,err);
     SET_UP_SECTION(dbg,scn_name,".debug_loc",
         &dbg->de_debug_loc,
         DW_DLE_DEBUG_LOC_DUPLICATE,0,
@@ -610,6 +664,7 @@ this_section_dwarf_relevant(const char *scn_name,int type)
         return TRUE;
     }
     if(    strcmp(scn_name, ".eh_frame")
+        && strcmp(scn_name, ".eh_frame_hdr")
         && strcmp(scn_name, ".symtab")
         && strcmp(scn_name, ".strtab")
         && strcmp(scn_name, ".gdb_index")
@@ -890,6 +945,22 @@ int
 dwarf_object_init(Dwarf_Obj_Access_Interface* obj, Dwarf_Handler errhand,
     Dwarf_Ptr errarg, Dwarf_Debug* ret_dbg,
     Dwarf_Error* error)
+{
+    return _dwarf_object_init_b(obj,errhand,errarg,
+        _dwarf_get_elf_flags_func_ptr,ret_dbg,error);
+}
+
+/*  New October 2026. As dwarf_object_init() but the
+    caller says how to get ELF section flags, so an
+    access method other than dwarf_elf_access.c
+    need not touch the global _dwarf_get_elf_flags_func_ptr. */
+int
+_dwarf_object_init_b(Dwarf_Obj_Access_Interface* obj,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    _dwarf_get_elf_flags_func_ptr_type flags_func,
+    Dwarf_Debug* ret_dbg,
+    Dwarf_Error* error)
 {
     Dwarf_Debug dbg = 0;
     int setup_result = DW_DLV_OK;
@@ -918,6 +989,7 @@ dwarf_object_init(Dwarf_Obj_Access_Interface* obj, Dwarf_Handler errhand,
     dbg->de_frame_undefined_value_number  = DW_FRAME_UNDEFINED_VAL;
 
     dbg->de_obj_file = obj;
+    dbg->de_get_elf_flags = flags_func;
 
     setup_result = _dwarf_setup(dbg, error);
     if (setup_result == DW_DLV_OK) {
@@ -1023,9 +1095,26 @@ dwarf_object_finish(Dwarf_Debug dbg, Dwarf_Error * error)
     The test case klingler2/compresseddebug.amd64 actually
     inflates about 8 times. */
 #define ALLOWED_ZLIB_INFLATION 16
+
+/*  One compressed section to inflate: the zlib stream
+    and the space it inflates into. */
+struct zlib_job_s {
+    struct Dwarf_Section_s *zj_section;
+    Bytef  *zj_src;
+    uLong   zj_srclen;
+    Bytef  *zj_dest;
+    uLongf  zj_destlen;
+    /*  The uncompress() return value. */
+    int     zj_zres;
+};
+
+/*  Finds the zlib stream of a compressed section and the
+    length it inflates to, and checks the length is
+    believable. */
 static int
-do_decompress_zlib(Dwarf_Debug dbg,
+zlib_section_stream(Dwarf_Debug dbg,
     struct Dwarf_Section_s *section,
+    struct zlib_job_s *job,
     Dwarf_Error * error)
 {
     Bytef *basesrc = (Bytef *)section->dss_data;
@@ -1033,9 +1122,6 @@ do_decompress_zlib(Dwarf_Debug dbg,
     uLong srclen = section->dss_size;
     Dwarf_Unsigned flags = section->dss_flags;
     Dwarf_Small *endsection = 0;
-    int res = 0;
-    Bytef *dest = 0;
-    uLongf destlen = 0;
     Dwarf_Unsigned uncompressed_len = 0;
 
     endsection = basesrc + srclen;
@@ -1115,37 +1201,220 @@ do_decompress_zlib(Dwarf_Debug dbg,
     if( (src +srclen) > endsection) {
         DWARF_DBG_ERROR(dbg, DW_DLE_ZLIB_SECTION_SHORT, DW_DLV_ERROR);
     }
-    destlen = uncompressed_len;
-    dest = malloc(destlen);
-    if(!dest) {
-        DWARF_DBG_ERROR(dbg, DW_DLE_ALLOC_FAIL, DW_DLV_ERROR);
+    job->zj_section = section;
+    job->zj_src = src;
+    job->zj_srclen = srclen;
+    job->zj_destlen = uncompressed_len;
+    return DW_DLV_OK;
+}
+
+/*  Touches nothing but the job, so any number of
+    jobs may be inflated at once on different threads. */
+static void
+zlib_inflate_job(struct zlib_job_s *job)
+{
+    job->zj_zres = uncompress(job->zj_dest,&job->zj_destlen,
+        job->zj_src,job->zj_srclen);
+}
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H)
+#define HAVE_ZCACHE 1
+#endif
+
+#ifdef HAVE_ZCACHE
+/*  The decompressed section cache.
+    With dwarf_set_decompress_cache_dir() each inflated
+    section is also written to a file in the cache directory
+    and a later open of the same object maps that file
+    (private, copy on write, as relocation may write)
+    instead of inflating again.
+    The file name is made of the object build id (if any),
+    a hash of the compressed bytes and the inflated length,
+    so a changed object never finds a stale file.
+    Files are written under a temporary name and renamed,
+    so a reader never sees a partial file.
+    Cache failures of any kind just mean inflating. */
+
+/*  Returns the malloc-ed cache file name for the job,
+    or NULL. */
+static char *
+zcache_path(Dwarf_Debug dbg, struct zlib_job_s *job)
+{
+    char *path = 0;
+    size_t len = 0;
+
+    if (!dbg->de_cache_objkey) {
+        Dwarf_Error err = 0;
+
+        if (_dwarf_cache_object_key(dbg,&err) != DW_DLV_OK) {
+            dwarf_dealloc(dbg,err,DW_DLA_ERROR);
+            return 0;
+        }
     }
-    res = uncompress(dest,&destlen,src,srclen);
-    if (res == Z_BUF_ERROR) {
-        free(dest);
-        DWARF_DBG_ERROR(dbg, DW_DLE_ZLIB_BUF_ERROR, DW_DLV_ERROR);
-    } else if (res == Z_MEM_ERROR) {
-        free(dest);
-        DWARF_DBG_ERROR(dbg, DW_DLE_ALLOC_FAIL, DW_DLV_ERROR);
-    } else if (res != Z_OK) {
-        free(dest);
+    len = strlen(dbg->de_zcache_dir) + strlen(dbg->de_cache_objkey) +
+        60;
+    path = malloc(len);
+    if (!path) {
+        return 0;
+    }
+    snprintf(path,len,"%s/%s-%016" DW_PR_DUx "-%" DW_PR_DUx ".zdc",
+        dbg->de_zcache_dir,dbg->de_cache_objkey,
+        _dwarf_cache_hash(DW_CACHE_HASH_SEED,job->zj_src,job->zj_srclen),
+        (Dwarf_Unsigned)job->zj_destlen);
+    return path;
+}
+
+/*  Returns DW_DLV_OK if the section now maps its
+    cache file, else DW_DLV_NO_ENTRY. */
+static int
+zcache_lookup(Dwarf_Debug dbg, struct zlib_job_s *job)
+{
+    struct Dwarf_Section_s *section = job->zj_section;
+    char *path = 0;
+    struct stat st;
+    void *area = 0;
+    int fd = -1;
+
+    if (!dbg->de_zcache_dir || !job->zj_destlen) {
+        return DW_DLV_NO_ENTRY;
+    }
+    path = zcache_path(dbg,job);
+    if (!path) {
+        return DW_DLV_NO_ENTRY;
+    }
+    fd = open(path,O_RDONLY);
+    free(path);
+    if (fd < 0) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (fstat(fd,&st) != 0 ||
+        (Dwarf_Unsigned)st.st_size != (Dwarf_Unsigned)job->zj_destlen) {
+        close(fd);
+        return DW_DLV_NO_ENTRY;
+    }
+    area = mmap(0,job->zj_destlen,PROT_READ|PROT_WRITE,MAP_PRIVATE,
+        fd,0);
+    close(fd);
+    if (area == MAP_FAILED) {
+        return DW_DLV_NO_ENTRY;
+    }
+    section->dss_data = area;
+    section->dss_size = job->zj_destlen;
+    section->dss_mmap_realarea = area;
+    section->dss_mmap_size = job->zj_destlen;
+    section->dss_requires_decompress = FALSE;
+    return DW_DLV_OK;
+}
+
+/*  Writes the inflated job to the cache, if there is one. */
+static void
+zcache_store(Dwarf_Debug dbg, struct zlib_job_s *job)
+{
+    char *path = 0;
+    char *tmppath = 0;
+    size_t len = 0;
+    int fd = -1;
+    Bytef *p = job->zj_dest;
+    uLongf remaining = job->zj_destlen;
+
+    if (!dbg->de_zcache_dir || !job->zj_destlen) {
+        return;
+    }
+    path = zcache_path(dbg,job);
+    if (!path) {
+        return;
+    }
+    len = strlen(path) + 30;
+    tmppath = malloc(len);
+    if (!tmppath) {
+        free(path);
+        return;
+    }
+    snprintf(tmppath,len,"%s.%ld.tmp",path,(long)getpid());
+    fd = open(tmppath,O_WRONLY|O_CREAT|O_EXCL,0644);
+    if (fd >= 0) {
+        while (remaining > 0) {
+            ssize_t w = write(fd,p,remaining);
+
+            if (w <= 0) {
+                break;
+            }
+            p += w;
+            remaining -= w;
+        }
+        if (close(fd) != 0 || remaining > 0 ||
+            rename(tmppath,path) != 0) {
+            unlink(tmppath);
+        }
+    }
+    free(tmppath);
+    free(path);
+}
+#endif /* HAVE_ZCACHE */
+
+/*  Makes the inflated space the section data. */
+static int
+zlib_install_job(Dwarf_Debug dbg,
+    struct zlib_job_s *job,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Section_s *section = job->zj_section;
+    int res = job->zj_zres;
+
+    if (res != Z_OK) {
+        free(job->zj_dest);
+        job->zj_dest = 0;
+        if (res == Z_BUF_ERROR) {
+            DWARF_DBG_ERROR(dbg, DW_DLE_ZLIB_BUF_ERROR, DW_DLV_ERROR);
+        } else if (res == Z_MEM_ERROR) {
+            DWARF_DBG_ERROR(dbg, DW_DLE_ALLOC_FAIL, DW_DLV_ERROR);
+        }
         /* Probably Z_DATA_ERROR. */
         DWARF_DBG_ERROR(dbg, DW_DLE_ZLIB_DATA_ERROR, DW_DLV_ERROR);
     }
     /* Z_OK */
-    section->dss_data = dest;
-    section->dss_size = destlen;
+#ifdef HAVE_ZCACHE
+    zcache_store(dbg,job);
+#endif
+    section->dss_data = job->zj_dest;
+    section->dss_size = job->zj_destlen;
     section->dss_data_was_malloc = TRUE;
     section->dss_requires_decompress = FALSE;
+    job->zj_dest = 0;
     return DW_DLV_OK;
 }
-#endif /* HAVE_ZLIB */
 
+static int
+do_decompress_zlib(Dwarf_Debug dbg,
+    struct Dwarf_Section_s *section,
+    Dwarf_Error * error)
+{
+    struct zlib_job_s job;
+    int res = 0;
 
-/*  Load the ELF section with the specified index and set its
-    dss_data pointer to the memory where it was loaded.  */
-int
-_dwarf_load_section(Dwarf_Debug dbg,
+    memset(&job,0,sizeof(job));
+    res = zlib_section_stream(dbg,section,&job,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+#ifdef HAVE_ZCACHE
+    if (zcache_lookup(dbg,&job) == DW_DLV_OK) {
+        return DW_DLV_OK;
+    }
+#endif
+    job.zj_dest = malloc(job.zj_destlen);
+    if(!job.zj_dest) {
+        DWARF_DBG_ERROR(dbg, DW_DLE_ALLOC_FAIL, DW_DLV_ERROR);
+    }
+    zlib_inflate_job(&job);
+    return zlib_install_job(dbg,&job,error);
+}
+#endif /* HAVE_ZLIB */
+
+/*  Reads the section bytes through the object access
+    methods, not yet decompressed or relocated. */
+static int
+load_raw_section(Dwarf_Debug dbg,
     struct Dwarf_Section_s *section,
     Dwarf_Error * error)
 {
@@ -1153,10 +1422,6 @@ _dwarf_load_section(Dwarf_Debug dbg,
     int err = 0;
     struct Dwarf_Obj_Access_Interface_s *o = 0;
 
-    /* check to see if the section is already loaded */
-    if (section->dss_data !=  NULL) {
-        return DW_DLV_OK;
-    }
     o = dbg->de_obj_file;
     /*  There is an elf convention that section index 0  is reserved,
         and that section is always empty.
@@ -1173,14 +1438,85 @@ _dwarf_load_section(Dwarf_Debug dbg,
     if (res == DW_DLV_ERROR) {
         DWARF_DBG_ERROR(dbg, err, DW_DLV_ERROR);
     }
-    if (res == DW_DLV_NO_ENTRY) {
-        /*  Gets this for section->dss_index 0.
-            Which by ELF definition is a section index
-            which is not used (reserved by Elf to
-            mean no-section-index).
-            Otherwise NULL dss_data gets error.
-            BSS would legitimately have no data, but
-            no DWARF related section could possbly be bss. */
+    /*  DW_DLV_NO_ENTRY for section->dss_index 0.
+        Which by ELF definition is a section index
+        which is not used (reserved by Elf to
+        mean no-section-index).
+        Otherwise NULL dss_data gets error.
+        BSS would legitimately have no data, but
+        no DWARF related section could possbly be bss. */
+    return res;
+}
+
+static int
+relocate_loaded_section(Dwarf_Debug dbg,
+    struct Dwarf_Section_s *section,
+    Dwarf_Error * error)
+{
+    int res = DW_DLV_OK;
+    int err = 0;
+    struct Dwarf_Obj_Access_Interface_s *o = dbg->de_obj_file;
+
+    if (dbg->de_apply_relocs_set) {
+        if (!dbg->de_apply_relocs) {
+            return res;
+        }
+    } else if (_dwarf_apply_relocs == 0) {
+        return res;
+    }
+    if (section->dss_reloc_size == 0) {
+        return res;
+    }
+    if (!o->methods->relocate_a_section) {
+        return res;
+    }
+    /*apply relocations */
+    res = o->methods->relocate_a_section( o->object, section->dss_index,
+        dbg, &err);
+    if (res == DW_DLV_ERROR) {
+        DWARF_DBG_ERROR(dbg, err, DW_DLV_ERROR);
+    }
+    return res;
+}
+
+/*  Load the ELF section with the specified index and set its
+    dss_data pointer to the memory where it was loaded.  */
+int
+_dwarf_load_section(Dwarf_Debug dbg,
+    struct Dwarf_Section_s *section,
+    Dwarf_Error * error)
+{
+    int res  = DW_DLV_ERROR;
+
+    /* check to see if the section is already loaded */
+    if (section->dss_data !=  NULL) {
+        return DW_DLV_OK;
+    }
+    if (!dbg->de_concurrent) {
+        return load_section(dbg,section,error);
+    }
+    /*  In concurrent-read mode every section that would
+        load already has, so this is rare: one thread
+        at a time tries again. */
+    DWARF_BUILD_LOCK(dbg);
+    res = load_section(dbg,section,error);
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
+
+static int
+load_section(Dwarf_Debug dbg,
+    struct Dwarf_Section_s *section,
+    Dwarf_Error * error)
+{
+    int res  = DW_DLV_ERROR;
+
+    /* check to see if the section is already loaded */
+    if (section->dss_data !=  NULL) {
+        return DW_DLV_OK;
+    }
+    res = load_raw_section(dbg,section,error);
+    if (res != DW_DLV_OK) {
         return res;
     }
     if (section->dss_requires_decompress) {
@@ -1198,22 +1534,264 @@ _dwarf_load_section(Dwarf_Debug dbg,
         DWARF_DBG_ERROR(dbg,DW_DLE_ZDEBUG_REQUIRES_ZLIB, DW_DLV_ERROR);
 #endif
     }
-    if (_dwarf_apply_relocs == 0) {
-        return res;
+    return relocate_loaded_section(dbg,section,error);
+}
+
+#ifdef HAVE_ZLIB
+#ifdef HAVE_PTHREAD
+/*  The jobs still to inflate, taken one at a time
+    by each thread, largest first. */
+struct zlib_pool_s {
+    struct zlib_job_s *zp_jobs;
+    unsigned           zp_count;
+    unsigned           zp_next;
+    pthread_mutex_t    zp_lock;
+};
+
+static void *
+zlib_pool_worker(void *arg)
+{
+    struct zlib_pool_s *pool = (struct zlib_pool_s *)arg;
+
+    for (;;) {
+        unsigned i = 0;
+
+        pthread_mutex_lock(&pool->zp_lock);
+        i = pool->zp_next++;
+        pthread_mutex_unlock(&pool->zp_lock);
+        if (i >= pool->zp_count) {
+            break;
+        }
+        zlib_inflate_job(&pool->zp_jobs[i]);
     }
-    if (section->dss_reloc_size == 0) {
-        return res;
+    return 0;
+}
+#endif /* HAVE_PTHREAD */
+
+static int
+zlib_job_compare(const void *l, const void *r)
+{
+    const struct zlib_job_s *lj = (const struct zlib_job_s *)l;
+    const struct zlib_job_s *rj = (const struct zlib_job_s *)r;
+
+    if (lj->zj_destlen > rj->zj_destlen) {
+        return -1;
     }
-    if (!o->methods->relocate_a_section) {
-        return res;
+    if (lj->zj_destlen < rj->zj_destlen) {
+        return 1;
     }
-    /*apply relocations */
-    res = o->methods->relocate_a_section( o->object, section->dss_index,
-        dbg, &err);
-    if (res == DW_DLV_ERROR) {
-        DWARF_DBG_ERROR(dbg, err, DW_DLV_ERROR);
+    return 0;
+}
+
+/*  Inflates the jobs using up to thread_count threads,
+    the calling thread being one of them. */
+static void
+zlib_run_jobs(struct zlib_job_s *jobs, unsigned count,
+    unsigned thread_count)
+{
+    qsort(jobs,count,sizeof(struct zlib_job_s),zlib_job_compare);
+#ifdef HAVE_PTHREAD
+    if (thread_count > 1 && count > 1) {
+        struct zlib_pool_s pool;
+        pthread_t *threads = 0;
+        unsigned started = 0;
+        unsigned t = 0;
+
+        if (thread_count > count) {
+            thread_count = count;
+        }
+        memset(&pool,0,sizeof(pool));
+        pool.zp_jobs = jobs;
+        pool.zp_count = count;
+        pthread_mutex_init(&pool.zp_lock,0);
+        threads = (pthread_t *)calloc(thread_count-1,sizeof(pthread_t));
+        if (threads) {
+            for ( ; started < thread_count-1; ++started) {
+                if (pthread_create(&threads[started],0,
+                    zlib_pool_worker,&pool)) {
+                    /*  Fewer threads just take longer. */
+                    break;
+                }
+            }
+        }
+        zlib_pool_worker(&pool);
+        for (t = 0; t < started; ++t) {
+            pthread_join(threads[t],0);
+        }
+        free(threads);
+        pthread_mutex_destroy(&pool.zp_lock);
+        return;
     }
-    return res;
+#endif /* HAVE_PTHREAD */
+    {
+        unsigned i = 0;
+
+        for ( ; i < count; ++i) {
+            zlib_inflate_job(&jobs[i]);
+        }
+    }
+}
+#endif /* HAVE_ZLIB */
+
+/*  Loads every compressed DWARF section of dbg not yet
+    loaded, inflating them at once on up to thread_count
+    threads (0 meaning one per online processor), so the
+    cost is paid here and not by whatever query
+    first touches each section.
+    Each zlib stream is inflated by a single thread, so
+    the time is at least that of the largest section.
+    Returns DW_DLV_NO_ENTRY if there is nothing to do.
+    A section that fails to decompress is left unloaded
+    and the failure is reported when it is used.
+    New October 2026. */
+int
+dwarf_decompress_sections(Dwarf_Debug dbg,
+    unsigned thread_count,
+    Dwarf_Error * error)
+{
+    struct Dwarf_Section_s *pending[DWARF_MAX_DEBUG_SECTIONS];
+    unsigned count = 0;
+    unsigned i = 0;
+
+    if (!dbg) {
+        DWARF_DBG_ERROR(NULL, DW_DLE_DBG_NULL, DW_DLV_ERROR);
+    }
+    for (i = 0; i < dbg->de_debug_sections_total_entries; ++i) {
+        struct Dwarf_Section_s *section =
+            dbg->de_debug_sections[i].ds_secdata;
+        unsigned k = 0;
+
+        if (!section->dss_requires_decompress ||
+            section->dss_data || !section->dss_size) {
+            continue;
+        }
+        for (k = 0; k < count; ++k) {
+            if (pending[k] == section) {
+                break;
+            }
+        }
+        if (k == count) {
+            pending[count++] = section;
+        }
+    }
+    if (!count) {
+        return DW_DLV_NO_ENTRY;
+    }
+#ifdef HAVE_ZLIB
+    {
+        struct zlib_job_s jobs[DWARF_MAX_DEBUG_SECTIONS];
+        unsigned jobcount = 0;
+        unsigned k = 0;
+        int res = DW_DLV_OK;
+
+        if (thread_count == 0) {
+#if defined(HAVE_UNISTD_H) && defined(_SC_NPROCESSORS_ONLN)
+            long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+            thread_count = cpus > 0? (unsigned)cpus:1;
+#else
+            thread_count = 1;
+#endif
+        }
+        memset(jobs,0,sizeof(jobs));
+        /*  Reading the object is not thread safe (libelf, for
+            one, is not) so everything but the inflation
+            is done here, in this thread.
+            A section that cannot be decompressed is
+            left unloaded, so the error is reported when
+            (if ever) the section is used, as it would be
+            without this call. */
+        for (i = 0; i < count; ++i) {
+            struct Dwarf_Section_s *section = pending[i];
+            struct zlib_job_s *job = &jobs[jobcount];
+            Dwarf_Error secerr = 0;
+
+            res = load_raw_section(dbg,section,&secerr);
+            if (res == DW_DLV_OK && section->dss_data) {
+                res = zlib_section_stream(dbg,section,job,&secerr);
+            }
+            if (res != DW_DLV_OK || !section->dss_data) {
+                dwarf_dealloc(dbg,secerr,DW_DLA_ERROR);
+                section->dss_data = 0;
+                continue;
+            }
+#ifdef HAVE_ZCACHE
+            if (zcache_lookup(dbg,job) == DW_DLV_OK) {
+                res = relocate_loaded_section(dbg,section,&secerr);
+                dwarf_dealloc(dbg,secerr,DW_DLA_ERROR);
+                memset(job,0,sizeof(*job));
+                continue;
+            }
+#endif
+            job->zj_dest = malloc(job->zj_destlen);
+            if (!job->zj_dest) {
+                section->dss_data = 0;
+                continue;
+            }
+            ++jobcount;
+        }
+        zlib_run_jobs(jobs,jobcount,thread_count);
+        for (k = 0; k < jobcount; ++k) {
+            struct zlib_job_s *job = &jobs[k];
+            Dwarf_Error secerr = 0;
+
+            res = zlib_install_job(dbg,job,&secerr);
+            if (res != DW_DLV_OK) {
+                job->zj_section->dss_data = 0;
+            } else {
+                res = relocate_loaded_section(dbg,job->zj_section,
+                    &secerr);
+            }
+            dwarf_dealloc(dbg,secerr,DW_DLA_ERROR);
+        }
+    }
+    return DW_DLV_OK;
+#else
+    /*  Only to report DW_DLE_ZDEBUG_REQUIRES_ZLIB. */
+    return _dwarf_load_section(dbg,pending[0],error);
+#endif /* HAVE_ZLIB */
+}
+
+/*  Sets (or with cache_dir NULL, clears) the directory
+    of the decompressed section cache of dbg.
+    Returns DW_DLV_NO_ENTRY if this libdwarf cannot
+    decompress or cannot map files.
+    New October 2026. */
+int
+dwarf_set_decompress_cache_dir(Dwarf_Debug dbg,
+    const char *cache_dir,
+    Dwarf_Error * error)
+{
+    if (!dbg) {
+        DWARF_DBG_ERROR(NULL, DW_DLE_DBG_NULL, DW_DLV_ERROR);
+    }
+#if defined(HAVE_ZLIB) && defined(HAVE_ZCACHE)
+    free(dbg->de_zcache_dir);
+    dbg->de_zcache_dir = 0;
+    if (cache_dir) {
+        dbg->de_zcache_dir = strdup(cache_dir);
+        if (!dbg->de_zcache_dir) {
+            DWARF_DBG_ERROR(dbg, DW_DLE_ALLOC_FAIL, DW_DLV_ERROR);
+        }
+    }
+    return DW_DLV_OK;
+#else
+    return DW_DLV_NO_ENTRY;
+#endif
+}
+
+/*  Unmaps a section mapped from the decompressed
+    section cache, if it is one. */
+void
+_dwarf_unmap_cached_section(struct Dwarf_Section_s *section)
+{
+#if defined(HAVE_ZLIB) && defined(HAVE_ZCACHE)
+    if (section->dss_mmap_realarea) {
+        munmap(section->dss_mmap_realarea,section->dss_mmap_size);
+    }
+#endif
+    section->dss_mmap_realarea = 0;
+    section->dss_mmap_size = 0;
 }
 
 /* This is a hack so clients can verify offsets.
@@ -501,10 +501,13 @@ dwarf_srcfiles(Dwarf_Die die,
     dwarf_srcline_dealloc(line_context)
     and dealloc of DW_DLA_LINE_CONTEXT
     from the new interface for uniformity here.
+
+    With a row_callback (dwarf_srclines_rows()) the rows
+    go to the callback and no Dwarf_Line is made.
 */
 
-int
-_dwarf_internal_srclines(Dwarf_Die die,
+static int
+internal_srclines(Dwarf_Die die,
     Dwarf_Bool is_new_interface,
     Dwarf_Unsigned * version,
     Dwarf_Small    * table_count, /* returns 0,1, or 2 */
@@ -515,6 +518,8 @@ _dwarf_internal_srclines(Dwarf_Die die,
     Dwarf_Signed * linecount_actuals,
     Dwarf_Bool doaddrs,
     Dwarf_Bool dolines,
+    Dwarf_Line_Row_Callback row_callback,
+    void *row_callback_data,
     Dwarf_Error * error)
 {
     /*  This pointer is used to scan the portion of the .debug_line
@@ -642,6 +647,8 @@ _dwarf_internal_srclines(Dwarf_Die die,
     }
     line_context->lc_new_style_access = is_new_interface;
     line_context->lc_compilation_directory = comp_dir;
+    line_context->lc_row_callback = row_callback;
+    line_context->lc_row_callback_data = row_callback_data;
     /*  We are in dwarf_internal_srclines() */
     {
         Dwarf_Small *newlinep = 0;
@@ -791,6 +798,64 @@ _dwarf_internal_srclines(Dwarf_Die die,
     return (DW_DLV_OK);
 }
 
+int
+_dwarf_internal_srclines(Dwarf_Die die,
+    Dwarf_Bool is_new_interface,
+    Dwarf_Unsigned * version,
+    Dwarf_Small    * table_count, /* returns 0,1, or 2 */
+    Dwarf_Line_Context *line_context_out,
+    Dwarf_Line ** linebuf,
+    Dwarf_Signed * linecount,
+    Dwarf_Line ** linebuf_actuals,
+    Dwarf_Signed * linecount_actuals,
+    Dwarf_Bool doaddrs,
+    Dwarf_Bool dolines,
+    Dwarf_Error * error)
+{
+    return internal_srclines(die,is_new_interface,version,
+        table_count,line_context_out,linebuf,linecount,
+        linebuf_actuals,linecount_actuals,doaddrs,dolines,
+        0,0,error);
+}
+
+/*  New October 2026.
+    The rows of the line table of the CU of die, one
+    callback per row, with no per-row allocation:
+    only the line context (the header, file and
+    directory names) is made, and freed before
+    returning.  A two-level table also keeps its
+    logicals rows (see emit_line_row()). */
+int
+dwarf_srclines_rows(Dwarf_Die die,
+    Dwarf_Line_Row_Callback callback,
+    void *user_data,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned version = 0;
+    Dwarf_Small table_count = 0;
+    Dwarf_Line_Context line_context = 0;
+    Dwarf_Bool is_new_interface = true;
+    int res = 0;
+
+    res = internal_srclines(die,
+        is_new_interface,
+        &version,
+        &table_count,
+        &line_context,
+        /* linebuf= */ 0,
+        /* linecount= */ 0,
+        /* linebuf_actuals= */ 0,
+        /* linecount_actuals= */ 0,
+        /* addrlist= */ false,
+        /* linelist= */ true,
+        callback,user_data,
+        error);
+    if (res == DW_DLV_OK) {
+        dwarf_srclines_dealloc_b(line_context);
+    }
+    return res;
+}
+
 int
 dwarf_get_ranges_section_name(Dwarf_Debug dbg,
     const char **section_name_out,
@@ -1882,7 +1947,8 @@ _dwarf_free_chain_entries(Dwarf_Debug dbg,Dwarf_Chain head,int count)
 {
     int i = 0;
     Dwarf_Chain curr_chain = head;
-    for (i = 0; i < count; i++) {
+    /*  No chain with dwarf_srclines_rows(). */
+    for (i = 0; i < count && curr_chain; i++) {
         Dwarf_Chain t = curr_chain;
         curr_chain = curr_chain->ch_next;
         dwarf_dealloc(dbg, t, DW_DLA_CHAIN);
@@ -1952,6 +2018,10 @@ _dwarf_line_context_destructor(void *m)
         line_context->lc_subprogs = 0;
         line_context->lc_subprogs_count = 0;
     }
+    free(line_context->lc_logical_rows);
+    line_context->lc_logical_rows = 0;
+    line_context->lc_logical_row_count = 0;
+    line_context->lc_logical_row_max = 0;
     line_context->lc_magic = 0;
     return;
 }
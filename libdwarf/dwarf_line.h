@@ -207,6 +207,22 @@ struct Dwarf_Line_Context_s {
     /* Non-zero only if two-level table with actuals */
     Dwarf_Line   *lc_linebuf_actuals;
     Dwarf_Unsigned lc_linecount_actuals;
+
+    /*  Set only by dwarf_srclines_rows(): rows are handed
+        to lc_row_callback instead of becoming Dwarf_Lines.
+        lc_rows_stopped is set when the callback asks
+        to stop. */
+    Dwarf_Line_Row_Callback lc_row_callback;
+    void          *lc_row_callback_data;
+    Dwarf_Bool     lc_rows_stopped;
+
+    /*  With lc_row_callback, the rows of the logicals table
+        of a two-level table, which DW_LNS_pop_context and
+        DW_LNS_set_address_from_logical refer back to.
+        Single-level tables keep nothing here. */
+    Dwarf_Line_Row *lc_logical_rows;
+    Dwarf_Unsigned lc_logical_row_count;
+    Dwarf_Unsigned lc_logical_row_max;
 };
 
 
@@ -872,6 +872,71 @@ _dwarf_read_line_table_header(Dwarf_Debug dbg,
 }
 
 
+/*  New October 2026.
+    With lc_row_callback set (dwarf_srclines_rows())
+    the row in regs is handed to the callback by value
+    instead of becoming a Dwarf_Line.
+    Rows of a two-level logicals table are also kept,
+    in one array, as later opcodes refer back to them.
+    Sets lc_rows_stopped if the callback says to stop. */
+static int
+emit_line_row(Dwarf_Debug dbg,
+    Dwarf_Line_Context line_context,
+    struct Dwarf_Line_Registers_s *regs,
+    Dwarf_Bool is_addr_set,
+    Dwarf_Bool is_single_table,
+    Dwarf_Bool is_actuals_table,
+    Dwarf_Unsigned row_number,
+    Dwarf_Error *error)
+{
+    Dwarf_Line_Row row;
+    int res = 0;
+
+    memset(&row,0,sizeof(row));
+    row.rw_row = row_number;
+    row.rw_address = regs->lr_address;
+    row.rw_file = regs->lr_file;
+    row.rw_line = regs->lr_line;
+    row.rw_column = regs->lr_column;
+    row.rw_discriminator = regs->lr_discriminator;
+    row.rw_call_context = regs->lr_call_context;
+    row.rw_subprogram = regs->lr_subprogram;
+    row.rw_isa = regs->lr_isa;
+    row.rw_is_stmt = regs->lr_is_stmt;
+    row.rw_basic_block = regs->lr_basic_block;
+    row.rw_end_sequence = regs->lr_end_sequence;
+    row.rw_prologue_end = regs->lr_prologue_end;
+    row.rw_epilogue_begin = regs->lr_epilogue_begin;
+    row.rw_is_addr_set = is_addr_set;
+    row.rw_is_actuals = is_actuals_table;
+    if (!is_single_table && !is_actuals_table) {
+        if (line_context->lc_logical_row_count ==
+            line_context->lc_logical_row_max) {
+            Dwarf_Unsigned newmax =
+                line_context->lc_logical_row_max?
+                2*line_context->lc_logical_row_max: 64;
+            Dwarf_Line_Row *newrows = (Dwarf_Line_Row *)
+                realloc(line_context->lc_logical_rows,
+                newmax*sizeof(Dwarf_Line_Row));
+
+            if (!newrows) {
+                _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+                return DW_DLV_ERROR;
+            }
+            line_context->lc_logical_rows = newrows;
+            line_context->lc_logical_row_max = newmax;
+        }
+        line_context->lc_logical_rows[
+            line_context->lc_logical_row_count++] = row;
+    }
+    res = line_context->lc_row_callback(line_context,&row,
+        line_context->lc_row_callback_data);
+    if (res != DW_DLV_OK) {
+        line_context->lc_rows_stopped = TRUE;
+    }
+    return DW_DLV_OK;
+}
+
 /*  Read one line table program. For two-level line tables, this
     function is called once for each table. */
 static int
@@ -936,7 +1001,7 @@ read_line_table_program(Dwarf_Debug dbg,
         line_context->lc_default_is_stmt);
 
     /* Start of statement program.  */
-    while (line_ptr < line_ptr_end) {
+    while (line_ptr < line_ptr_end && !line_context->lc_rows_stopped) {
         int type = 0;
         Dwarf_Small opcode = 0;
 
@@ -1018,7 +1083,17 @@ read_line_table_program(Dwarf_Debug dbg,
                 opcode,line_count+1, &regs,is_single_table, is_actuals_table);
 #endif /* PRINTING_DETAILS */
 
-            if (dolines) {
+            if (line_context->lc_row_callback) {
+                int eres = emit_line_row(dbg,line_context,&regs,
+                    is_addr_set,is_single_table,is_actuals_table,
+                    line_count+1,error);
+
+                if (eres != DW_DLV_OK) {
+                    return eres;
+                }
+                is_addr_set = false;
+                line_count++;
+            } else if (dolines) {
                 curr_line =
                     (Dwarf_Line) _dwarf_get_alloc(dbg, DW_DLA_LINE, 1);
                 if (curr_line == NULL) {
@@ -1082,7 +1157,17 @@ read_line_table_program(Dwarf_Debug dbg,
                 print_line_detail(dbg,"DW_LNS_copy",
                     opcode,line_count+1, &regs,is_single_table, is_actuals_table);
 #endif /* PRINTING_DETAILS */
-                if (dolines) {
+                if (line_context->lc_row_callback) {
+                    int eres = emit_line_row(dbg,line_context,&regs,
+                        is_addr_set,is_single_table,is_actuals_table,
+                        line_count+1,error);
+
+                    if (eres != DW_DLV_OK) {
+                        return eres;
+                    }
+                    is_addr_set = false;
+                    line_count++;
+                } else if (dolines) {
                     curr_line = (Dwarf_Line) _dwarf_get_alloc(dbg,
                         DW_DLA_LINE, 1);
                     if (curr_line == NULL) {
@@ -1326,7 +1411,15 @@ read_line_table_program(Dwarf_Debug dbg,
                         dbg,error,line_ptr_end);
                     advance_line = (Dwarf_Sword) stmp;
                     regs.lr_line = regs.lr_line + advance_line;
-                    if (regs.lr_line >= 1 &&
+                    if (line_context->lc_row_callback) {
+                        if (regs.lr_line >= 1 && regs.lr_line - 1 <
+                            line_context->lc_logical_row_count) {
+                            regs.lr_address = line_context->
+                                lc_logical_rows[regs.lr_line - 1].
+                                rw_address;
+                            regs.lr_op_index = 0;
+                        }
+                    } else if (regs.lr_line >= 1 &&
                         regs.lr_line - 1 < logicals_count) {
                         regs.lr_address =
                             logicals[regs.lr_line - 1]->li_address;
@@ -1394,7 +1487,22 @@ read_line_table_program(Dwarf_Debug dbg,
                 Dwarf_Chain logical_chain = head_chain;
                 Dwarf_Line logical_line = 0;
 
-                if (logical_num > 0 && logical_num <= line_count) {
+                if (line_context->lc_row_callback) {
+                    if (logical_num > 0 && logical_num <=
+                        line_context->lc_logical_row_count) {
+                        Dwarf_Line_Row *lrow =
+                            line_context->lc_logical_rows +
+                            logical_num - 1;
+
+                        regs.lr_file = lrow->rw_file;
+                        regs.lr_line = lrow->rw_line;
+                        regs.lr_column = lrow->rw_column;
+                        regs.lr_discriminator = lrow->rw_discriminator;
+                        regs.lr_is_stmt = lrow->rw_is_stmt;
+                        regs.lr_call_context = lrow->rw_call_context;
+                        regs.lr_subprogram = lrow->rw_subprogram;
+                    }
+                } else if (logical_num > 0 && logical_num <= line_count) {
                     for (i = 1; i < logical_num; i++) {
                         logical_chain = logical_chain->ch_next;
                     }
@@ -1453,7 +1561,17 @@ read_line_table_program(Dwarf_Debug dbg,
 
             case DW_LNE_end_sequence:{
                 regs.lr_end_sequence = true;
-                if (dolines) {
+                if (line_context->lc_row_callback) {
+                    int eres = emit_line_row(dbg,line_context,&regs,
+                        is_addr_set,is_single_table,is_actuals_table,
+                        line_count+1,error);
+
+                    if (eres != DW_DLV_OK) {
+                        return eres;
+                    }
+                    is_addr_set = false;
+                    line_count++;
+                } else if (dolines) {
                     curr_line = (Dwarf_Line)
                         _dwarf_get_alloc(dbg, DW_DLA_LINE, 1);
                     if (curr_line == NULL) {
@@ -1677,6 +1795,10 @@ read_line_table_program(Dwarf_Debug dbg,
             } /* End switch. */
         }
     }
+    if (line_context->lc_row_callback) {
+        /* The rows are all handed out, there is no block. */
+        return DW_DLV_OK;
+    }
     block_line = (Dwarf_Line *)
         _dwarf_get_alloc(dbg, DW_DLA_LIST, line_count);
     if (block_line == NULL) {
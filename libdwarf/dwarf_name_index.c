@@ -0,0 +1,835 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    Name to DIE lookup.
+    dwarf_get_globals() and dwarf_get_pubtypes() return
+    every entry, each in its own allocation, and leave the
+    caller to search them; the .gdb_index functions
+    (dwarf_gdbindex.c) return the raw tables.
+    Here a name is looked up directly: in the .gdb_index
+    symbol hash table if the object has a usable .gdb_index,
+    else in a hash table (see dwarf_name_index.h) made
+    once from .debug_pubnames and .debug_pubtypes.
+    .gdb_index records only the unit of a name, so the DIE
+    is found by reading that unit's DIEs with a
+    DIE cursor, matching the qualified name.  */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include "dwarf_gdbindex.h"
+#include "dwarf_name_index.h"
+#include "dwarf_concurrent.h"
+
+#define FALSE 0
+#define TRUE 1
+
+/*  The highest .gdb_index version whose layout
+    is known to be as read here. */
+#define NAME_GDBINDEX_MAX_VERSION 8
+
+/*  Attributes of a DIE looked at for its name. */
+#define NAME_VIEW_COUNT 32
+
+/*  DIEs nested deeper than this are not looked at
+    for a .gdb_index name. */
+#define NAME_SCOPE_DEPTH 64
+
+/*  FNV-1a. */
+static Dwarf_Unsigned
+name_hash(const char *name)
+{
+    const unsigned char *cp = (const unsigned char *)name;
+    Dwarf_Unsigned h = 0xcbf29ce4;
+
+    h = (h << 32) | 0x84222325;
+    for (; *cp; ++cp) {
+        h ^= *cp;
+        h *= ((Dwarf_Unsigned)0x100 << 32) | 0x1b3;
+    }
+    return h;
+}
+
+/*  Sets ni_gdbindex if the object has a .gdb_index
+    that dwarf_gdbindex_symboltable_lookup() can search.
+    Any problem with it just means using pubnames. */
+static void
+open_gdbindex(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *index)
+{
+    Dwarf_Gdbindex gi = 0;
+    Dwarf_Unsigned version = 0;
+    Dwarf_Unsigned cu_list_offset = 0;
+    Dwarf_Unsigned types_cu_list_offset = 0;
+    Dwarf_Unsigned address_area_offset = 0;
+    Dwarf_Unsigned symbol_table_offset = 0;
+    Dwarf_Unsigned constant_pool_offset = 0;
+    Dwarf_Unsigned section_size = 0;
+    Dwarf_Unsigned reserved = 0;
+    Dwarf_Unsigned symtab_count = 0;
+    const char *section_name = 0;
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    res = dwarf_gdbindex_header(dbg,&gi,&version,&cu_list_offset,
+        &types_cu_list_offset,&address_area_offset,
+        &symbol_table_offset,&constant_pool_offset,&section_size,
+        &reserved,&section_name,&lerr);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        }
+        return;
+    }
+    symtab_count = gi->gi_symboltablehdr.dg_count;
+    if (version < 4 || version > NAME_GDBINDEX_MAX_VERSION ||
+        cu_list_offset > types_cu_list_offset ||
+        types_cu_list_offset > address_area_offset ||
+        address_area_offset > symbol_table_offset ||
+        symbol_table_offset > constant_pool_offset ||
+        constant_pool_offset > section_size ||
+        !symtab_count || (symtab_count & (symtab_count-1))) {
+        dwarf_gdbindex_free(gi);
+        return;
+    }
+    index->ni_gdbindex = gi;
+    index->ni_gdb_cu_count = gi->gi_culisthdr.dg_count;
+    index->ni_gdb_tu_count = gi->gi_typesculisthdr.dg_count;
+}
+
+/*  Adds the .debug_pubnames (types FALSE) or
+    .debug_pubtypes entries to ni_entries. */
+static int
+add_pub_entries(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *index,
+    Dwarf_Bool types,
+    Dwarf_Error *error)
+{
+    Dwarf_Global *globals = 0;
+    Dwarf_Type *pubtypes = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    struct Dwarf_Name_Index_Entry_s *newents = 0;
+    int res = 0;
+
+    if (types) {
+        res = dwarf_get_pubtypes(dbg,&pubtypes,&count,error);
+    } else {
+        res = dwarf_get_globals(dbg,&globals,&count,error);
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    newents = (struct Dwarf_Name_Index_Entry_s *)realloc(
+        index->ni_entries,(index->ni_count + count)*
+        sizeof(struct Dwarf_Name_Index_Entry_s));
+    if (!newents) {
+        res = DW_DLV_ERROR;
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+    } else {
+        index->ni_entries = newents;
+    }
+    for (i = 0; i < count && res == DW_DLV_OK; ++i) {
+        struct Dwarf_Name_Index_Entry_s *ent =
+            index->ni_entries + index->ni_count;
+        char *name = 0;
+
+        /*  The names point into the section data
+            and so outlive the list. */
+        if (types) {
+            res = dwarf_pubtype_name_offsets(pubtypes[i],&name,
+                &ent->ne_die_offset,&ent->ne_cu_die_offset,error);
+            ent->ne_kind = DW_NAME_KIND_TYPE;
+        } else {
+            res = dwarf_global_name_offsets(globals[i],&name,
+                &ent->ne_die_offset,&ent->ne_cu_die_offset,error);
+            ent->ne_kind = DW_NAME_KIND_NONE;
+        }
+        if (res == DW_DLV_OK) {
+            ent->ne_name = name;
+            ent->ne_hash = name_hash(name);
+            index->ni_count++;
+        }
+    }
+    if (types) {
+        dwarf_pubtypes_dealloc(dbg,pubtypes,count);
+    } else {
+        dwarf_globals_dealloc(dbg,globals,count);
+    }
+    return res;
+}
+
+/*  Makes ni_slots for the ni_entries. */
+static int
+make_slots(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *index,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned slot_count = 16;
+    Dwarf_Unsigned mask = 0;
+    Dwarf_Unsigned i = 0;
+
+    while (slot_count < 2*index->ni_count) {
+        slot_count *= 2;
+    }
+    index->ni_slots = (Dwarf_Unsigned *)calloc(slot_count,
+        sizeof(Dwarf_Unsigned));
+    if (!index->ni_slots) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    index->ni_slot_count = slot_count;
+    mask = slot_count - 1;
+    for (i = 0; i < index->ni_count; ++i) {
+        Dwarf_Unsigned s = index->ni_entries[i].ne_hash & mask;
+
+        while (index->ni_slots[s]) {
+            s = (s+1) & mask;
+        }
+        index->ni_slots[s] = i+1;
+    }
+    return DW_DLV_OK;
+}
+
+static void
+free_index(struct Dwarf_Name_Index_s *index)
+{
+    if (index->ni_gdbindex) {
+        dwarf_gdbindex_free(index->ni_gdbindex);
+    }
+    free(index->ni_entries);
+    free(index->ni_slots);
+    free(index);
+}
+
+static int
+index_build(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Name_Index_s *index = 0;
+    Dwarf_Bool have_pub = FALSE;
+    int res = 0;
+
+    if (dbg->de_name_index) {
+        return DW_DLV_OK;
+    }
+    index = (struct Dwarf_Name_Index_s *)
+        calloc(1,sizeof(struct Dwarf_Name_Index_s));
+    if (!index) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    open_gdbindex(dbg,index);
+    if (index->ni_gdbindex) {
+        dbg->de_name_index = index;
+        return DW_DLV_OK;
+    }
+    res = add_pub_entries(dbg,index,FALSE,error);
+    if (res == DW_DLV_OK) {
+        have_pub = TRUE;
+    }
+    if (res != DW_DLV_ERROR) {
+        res = add_pub_entries(dbg,index,TRUE,error);
+        if (res == DW_DLV_OK) {
+            have_pub = TRUE;
+        }
+    }
+    if (res != DW_DLV_ERROR) {
+        res = have_pub? make_slots(dbg,index,error): DW_DLV_NO_ENTRY;
+    }
+    if (res != DW_DLV_OK) {
+        free_index(index);
+        return res;
+    }
+    dbg->de_name_index = index;
+    return DW_DLV_OK;
+}
+
+/*  Makes the name index of dbg if it has not been made
+    yet. Returns DW_DLV_NO_ENTRY if the object has none
+    of .gdb_index, .debug_pubnames and .debug_pubtypes. */
+int
+dwarf_name_index_build(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    int res = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    DWARF_BUILD_LOCK(dbg);
+    res = index_build(dbg,error);
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
+
+/*  Frees the index, dwarf_finish() calls this. */
+void
+_dwarf_name_index_destroy(Dwarf_Debug dbg)
+{
+    if (dbg->de_name_index) {
+        free_index(dbg->de_name_index);
+        dbg->de_name_index = 0;
+    }
+}
+
+void
+dwarf_name_index_free(Dwarf_Debug dbg)
+{
+    if (dbg) {
+        _dwarf_name_index_destroy(dbg);
+    }
+}
+
+/*  The string value of a DW_AT_name view, or NULL
+    if it is not a string form we can read here.  */
+static const char *
+view_string(Dwarf_Debug dbg,
+    Dwarf_CU_Context context,
+    Dwarf_Attr_View *view)
+{
+    Dwarf_Unsigned offset = 0;
+    char *str = 0;
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    switch (view->av_form) {
+    case DW_FORM_string:
+        return (const char *)view->av_data;
+    case DW_FORM_strp:
+    case DW_FORM_line_strp:
+        offset = view->av_value;
+        break;
+    case DW_FORM_strx:
+    case DW_FORM_GNU_str_index:
+        res = _dwarf_extract_string_offset_via_str_offsets(dbg,
+            (Dwarf_Small *)view->av_data,
+            (Dwarf_Small *)view->av_data + view->av_length,
+            view->av_attr,view->av_form,context,&offset,&lerr);
+        if (res != DW_DLV_OK) {
+            if (res == DW_DLV_ERROR) {
+                dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+            }
+            return 0;
+        }
+        break;
+    default:
+        return 0;
+    }
+    res = _dwarf_extract_local_debug_str_string_given_offset(dbg,
+        view->av_form,offset,&str,&lerr);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+        }
+        return 0;
+    }
+    return str;
+}
+
+/*  Whether a DIE with this tag could be what a .gdb_index
+    name of the given kind (DW_NAME_KIND_NONE matches
+    any) refers to.  Members, parameters and the like
+    are never in the index; a DW_TAG_member that is a
+    declaration is a static data member, which is. */
+static Dwarf_Bool
+tag_fits_kind(Dwarf_Half tag,
+    Dwarf_Bool is_decl,
+    Dwarf_Small kind)
+{
+    Dwarf_Small tagkind = DW_NAME_KIND_OTHER;
+
+    switch (tag) {
+    case DW_TAG_member:
+        if (!is_decl) {
+            return FALSE;
+        }
+        tagkind = DW_NAME_KIND_VARIABLE;
+        break;
+    case DW_TAG_formal_parameter:
+    case DW_TAG_unspecified_parameters:
+    case DW_TAG_inheritance:
+    case DW_TAG_template_type_parameter:
+    case DW_TAG_template_value_parameter:
+    case DW_TAG_GNU_template_parameter_pack:
+    case DW_TAG_GNU_formal_parameter_pack:
+    case DW_TAG_imported_declaration:
+    case DW_TAG_imported_module:
+    case DW_TAG_label:
+        return FALSE;
+    case DW_TAG_subprogram:
+    case DW_TAG_entry_point:
+        tagkind = DW_NAME_KIND_FUNCTION;
+        break;
+    case DW_TAG_variable:
+    case DW_TAG_constant:
+    case DW_TAG_enumerator:
+        tagkind = DW_NAME_KIND_VARIABLE;
+        break;
+    case DW_TAG_base_type:
+    case DW_TAG_class_type:
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_enumeration_type:
+    case DW_TAG_typedef:
+    case DW_TAG_subrange_type:
+    case DW_TAG_unspecified_type:
+    case DW_TAG_interface_type:
+    case DW_TAG_namespace:
+        tagkind = DW_NAME_KIND_TYPE;
+        break;
+    default:
+        break;
+    }
+    return kind == DW_NAME_KIND_NONE ||
+        kind == DW_NAME_KIND_OTHER || kind == tagkind;
+}
+
+/*  Whether the DIE's name becomes part of the qualified
+    name of the DIEs it owns, as with "ns::" in "ns::get". */
+static Dwarf_Bool
+tag_is_scope(Dwarf_Half tag,
+    Dwarf_Bool is_enum_class)
+{
+    switch (tag) {
+    case DW_TAG_namespace:
+    case DW_TAG_class_type:
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_interface_type:
+        return TRUE;
+    case DW_TAG_enumeration_type:
+        return is_enum_class;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+/*  Finds the DIE that the .gdb_index name refers to in
+    the unit whose unit DIE is at cu_die_offset.
+    .gdb_index names are qualified ("ns::get", "S::m"),
+    so as the cursor goes down through namespaces,
+    classes and the like, scope_len[depth] records how
+    much of name the enclosing scope names have matched,
+    or -1 if they do not match (or the DIEs are within
+    a function, where nothing is indexed).
+    A definition is preferred to a declaration, and a
+    DIE whose DW_AT_specification is the matching
+    declaration (a member function defined outside
+    its class) counts as the definition.
+    gold indexes the enumerators of an enum class
+    without the enumeration's name, so failing all else
+    such an enumerator is matched that way too.
+    Sets *die_offset_out zero if there is
+    none (or the unit cannot be read).  */
+static void
+find_named_die(Dwarf_Debug dbg,
+    Dwarf_Off cu_die_offset,
+    Dwarf_Bool is_info,
+    const char *name,
+    Dwarf_Small kind,
+    Dwarf_Off *die_offset_out)
+{
+    Dwarf_Die cu_die = 0;
+    Dwarf_CU_Context context = 0;
+    Dwarf_Die_Cursor cursor = 0;
+    Dwarf_Attr_View views[NAME_VIEW_COUNT];
+    Dwarf_Signed scope_len[NAME_SCOPE_DEPTH];
+    Dwarf_Off decl_offset = 0;
+    Dwarf_Off found_offset = 0;
+    Dwarf_Off enum_offset = 0;
+    Dwarf_Signed enum_depth = 0;
+    Dwarf_Signed enum_prefix = 0;
+    Dwarf_Half tag = 0;
+    Dwarf_Signed depth = 0;
+    Dwarf_Unsigned code = 0;
+    Dwarf_Unsigned name_len = strlen(name);
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    *die_offset_out = 0;
+    res = dwarf_offdie_b(dbg,cu_die_offset,is_info,&cu_die,&lerr);
+    if (res == DW_DLV_OK) {
+        context = cu_die->di_cu_context;
+        res = dwarf_die_cursor_open(cu_die,&cursor,&lerr);
+    }
+    scope_len[0] = -1;
+    while (res == DW_DLV_OK && !found_offset) {
+        Dwarf_Unsigned attr_count = 0;
+        Dwarf_Unsigned i = 0;
+        const char *diename = 0;
+        Dwarf_Bool is_decl = FALSE;
+        Dwarf_Bool is_enum_class = FALSE;
+        Dwarf_Off spec_offset = 0;
+        Dwarf_Signed prefix = 0;
+        Dwarf_Signed inner = -1;
+
+        res = dwarf_next_die(cursor,&tag,&depth,&code,&lerr);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (depth >= NAME_SCOPE_DEPTH) {
+            continue;
+        }
+        if (depth < enum_depth) {
+            enum_depth = 0;
+        }
+        if (depth == 0) {
+            /*  The unit DIE. What it owns is unqualified. */
+            if (NAME_SCOPE_DEPTH > 1) {
+                scope_len[1] = 0;
+            }
+            continue;
+        }
+        prefix = scope_len[depth];
+        if (depth+1 < NAME_SCOPE_DEPTH) {
+            scope_len[depth+1] = -1;
+        }
+        if (prefix < 0 && depth != enum_depth) {
+            continue;
+        }
+        res = dwarf_die_cursor_attrs(cursor,views,NAME_VIEW_COUNT,
+            &attr_count,&lerr);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (attr_count > NAME_VIEW_COUNT) {
+            attr_count = NAME_VIEW_COUNT;
+        }
+        for (i = 0; i < attr_count; ++i) {
+            Dwarf_Attr_View *view = views+i;
+
+            switch (view->av_attr) {
+            case DW_AT_name:
+                diename = view_string(dbg,context,view);
+                break;
+            case DW_AT_declaration:
+                is_decl = view->av_value != 0;
+                break;
+            case DW_AT_enum_class:
+                is_enum_class = view->av_value != 0;
+                break;
+            case DW_AT_specification:
+                if (view->av_form == DW_FORM_ref_addr) {
+                    spec_offset = view->av_value;
+                } else {
+                    spec_offset = view->av_value +
+                        context->cc_debug_offset;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        if (decl_offset && spec_offset == decl_offset) {
+            res = dwarf_die_cursor_offset(cursor,&found_offset,
+                &lerr);
+            break;
+        }
+        if (!diename && tag == DW_TAG_namespace) {
+            diename = "(anonymous namespace)";
+        }
+        if (!diename) {
+            /*  An unnamed enumeration's enumerators belong
+                to the enclosing scope. */
+            if (tag == DW_TAG_enumeration_type && !is_enum_class &&
+                depth+1 < NAME_SCOPE_DEPTH) {
+                scope_len[depth+1] = prefix;
+            }
+            continue;
+        }
+        if (tag == DW_TAG_enumerator && depth == enum_depth) {
+            if (!enum_offset && !strcmp(name+enum_prefix,diename)) {
+                res = dwarf_die_cursor_offset(cursor,&enum_offset,
+                    &lerr);
+                if (res != DW_DLV_OK) {
+                    break;
+                }
+            }
+            if (prefix < 0) {
+                continue;
+            }
+        }
+        if (tag_is_scope(tag,is_enum_class)) {
+            Dwarf_Unsigned len = strlen(diename);
+
+            if (prefix + len + 2 <= name_len &&
+                !strncmp(name+prefix,diename,len) &&
+                name[prefix+len] == ':' &&
+                name[prefix+len+1] == ':') {
+                inner = prefix + len + 2;
+            }
+        } else if (tag == DW_TAG_enumeration_type) {
+            inner = prefix;
+        }
+        if (tag == DW_TAG_enumeration_type && is_enum_class) {
+            enum_depth = depth+1;
+            enum_prefix = prefix;
+        }
+        if (depth+1 < NAME_SCOPE_DEPTH) {
+            scope_len[depth+1] = inner;
+        }
+        if (!strcmp(name+prefix,diename) &&
+            tag_fits_kind(tag,is_decl,kind)) {
+            Dwarf_Off off = 0;
+
+            res = dwarf_die_cursor_offset(cursor,&off,&lerr);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            if (!is_decl) {
+                found_offset = off;
+            } else if (!decl_offset) {
+                decl_offset = off;
+            }
+        }
+    }
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc(dbg,lerr,DW_DLA_ERROR);
+    }
+    if (cursor) {
+        dwarf_dealloc(dbg,cursor,DW_DLA_DIE_CURSOR);
+    }
+    if (cu_die) {
+        dwarf_dealloc(dbg,cu_die,DW_DLA_DIE);
+    }
+    if (found_offset) {
+        *die_offset_out = found_offset;
+    } else if (decl_offset) {
+        *die_offset_out = decl_offset;
+    } else {
+        *die_offset_out = enum_offset;
+    }
+}
+
+/*  Fills in result from one .gdb_index CU vector value.
+    Returns DW_DLV_NO_ENTRY if the CU index is not valid. */
+static int
+gdb_result(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *index,
+    Dwarf_Unsigned value,
+    const char *name,
+    Dwarf_Name_Result *result,
+    Dwarf_Error *error)
+{
+    Dwarf_Gdbindex gi = index->ni_gdbindex;
+    Dwarf_Unsigned cu_index = 0;
+    Dwarf_Unsigned reserved = 0;
+    Dwarf_Unsigned kind = 0;
+    Dwarf_Unsigned is_static = 0;
+    Dwarf_Unsigned cu_offset = 0;
+    Dwarf_Unsigned cu_length = 0;
+    Dwarf_Unsigned signature = 0;
+    Dwarf_Unsigned header_length = 0;
+    Dwarf_Bool is_info = TRUE;
+    int res = 0;
+
+    res = dwarf_gdbindex_cuvector_instance_expand_value(gi,value,
+        &cu_index,&reserved,&kind,&is_static,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (cu_index < index->ni_gdb_cu_count) {
+        res = dwarf_gdbindex_culist_entry(gi,cu_index,
+            &cu_offset,&cu_length,error);
+    } else if (cu_index - index->ni_gdb_cu_count <
+        index->ni_gdb_tu_count) {
+        is_info = FALSE;
+        res = dwarf_gdbindex_types_culist_entry(gi,
+            cu_index - index->ni_gdb_cu_count,
+            &cu_offset,&cu_length,&signature,error);
+    } else {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = is_info? _dwarf_load_debug_info(dbg,error):
+        _dwarf_load_debug_types(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (cu_offset >= (is_info? dbg->de_debug_info.dss_size:
+        dbg->de_debug_types.dss_size)) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = _dwarf_length_of_cu_header(dbg,cu_offset,is_info,
+        &header_length,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    result->nr_cu_die_offset = cu_offset + header_length;
+    result->nr_is_info = is_info;
+    result->nr_kind = (Dwarf_Small)kind;
+    result->nr_is_static = is_static != 0;
+    find_named_die(dbg,result->nr_cu_die_offset,is_info,name,
+        result->nr_kind,&result->nr_die_offset);
+    return DW_DLV_OK;
+}
+
+static int
+gdb_lookup(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *index,
+    const char *name,
+    Dwarf_Name_Result *results,
+    Dwarf_Unsigned result_max,
+    Dwarf_Unsigned *result_count,
+    Dwarf_Error *error)
+{
+    Dwarf_Gdbindex gi = index->ni_gdbindex;
+    Dwarf_Unsigned entryindex = 0;
+    Dwarf_Unsigned string_offset = 0;
+    Dwarf_Unsigned cuvector_offset = 0;
+    Dwarf_Unsigned inner_count = 0;
+    Dwarf_Unsigned max_inner = 0;
+    Dwarf_Unsigned found = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Small *vector = 0;
+    Dwarf_Small *section_end = 0;
+    int res = 0;
+
+    res = dwarf_gdbindex_symboltable_lookup(gi,name,&entryindex,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_gdbindex_symboltable_entry(gi,entryindex,
+        &string_offset,&cuvector_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_gdbindex_cuvector_length(gi,cuvector_offset,
+        &inner_count,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    /*  The count is not checked against the section
+        size by dwarf_gdbindex_cuvector_length(). */
+    vector = gi->gi_cuvectorhdr.dg_base + cuvector_offset;
+    section_end = gi->gi_section_data + gi->gi_section_length;
+    max_inner = (section_end - vector)/
+        gi->gi_cuvectorhdr.dg_entry_length - 1;
+    if (inner_count > max_inner) {
+        _dwarf_error(dbg, error, DW_DLE_GDB_INDEX_INDEX_ERROR);
+        return DW_DLV_ERROR;
+    }
+    for (i = 0; i < inner_count; ++i) {
+        Dwarf_Unsigned value = 0;
+        Dwarf_Name_Result result;
+
+        res = dwarf_gdbindex_cuvector_inner_attributes(gi,
+            cuvector_offset,i,&value,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        memset(&result,0,sizeof(result));
+        res = gdb_result(dbg,index,value,name,&result,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            continue;
+        }
+        if (found < result_max) {
+            results[found] = result;
+        }
+        found++;
+    }
+    *result_count = found;
+    return found? DW_DLV_OK: DW_DLV_NO_ENTRY;
+}
+
+static int
+pub_lookup(struct Dwarf_Name_Index_s *index,
+    const char *name,
+    Dwarf_Name_Result *results,
+    Dwarf_Unsigned result_max,
+    Dwarf_Unsigned *result_count)
+{
+    Dwarf_Unsigned hash = name_hash(name);
+    Dwarf_Unsigned mask = index->ni_slot_count - 1;
+    Dwarf_Unsigned s = hash & mask;
+    Dwarf_Unsigned found = 0;
+
+    for (; index->ni_slots[s]; s = (s+1) & mask) {
+        struct Dwarf_Name_Index_Entry_s *ent =
+            index->ni_entries + index->ni_slots[s] - 1;
+        Dwarf_Name_Result *result = 0;
+
+        if (ent->ne_hash != hash || strcmp(ent->ne_name,name)) {
+            continue;
+        }
+        if (found < result_max) {
+            result = results + found;
+            memset(result,0,sizeof(*result));
+            result->nr_die_offset = ent->ne_die_offset;
+            result->nr_cu_die_offset = ent->ne_cu_die_offset;
+            result->nr_is_info = TRUE;
+            result->nr_kind = ent->ne_kind;
+        }
+        found++;
+    }
+    *result_count = found;
+    return found? DW_DLV_OK: DW_DLV_NO_ENTRY;
+}
+
+/*  Looks up name, filling in up to result_max results and
+    returning through result_count the number of
+    DIEs found (which may be more than result_max).
+    Returns DW_DLV_NO_ENTRY if there are none or the
+    object has no name index.  */
+int
+dwarf_name_lookup(Dwarf_Debug dbg,
+    const char *name,
+    Dwarf_Name_Result *results,
+    Dwarf_Unsigned result_max,
+    Dwarf_Unsigned *result_count,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Name_Index_s *index = 0;
+    int res = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    *result_count = 0;
+    res = dwarf_name_index_build(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    index = dbg->de_name_index;
+    if (index->ni_gdbindex) {
+        return gdb_lookup(dbg,index,name,results,result_max,
+            result_count,error);
+    }
+    return pub_lookup(index,name,results,result_max,result_count);
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  The name index of a Dwarf_Debug, made on first use
+    by dwarf_name_index_build().
+
+    With a usable .gdb_index only ni_gdbindex is set and
+    names are looked up in the .gdb_index hash table.
+    Otherwise the .debug_pubnames and .debug_pubtypes
+    entries are read once into ni_entries (ne_name points
+    into the section data) and ni_slots is an open
+    addressing (linear probing) hash table of them whose
+    size is a power of two, at least twice the entry count.
+    A slot is zero if empty, else one more than the index
+    of its entry.  A name may have several entries
+    (a static function in several CUs), all are found
+    by probing on to the next empty slot.  */
+struct Dwarf_Name_Index_Entry_s {
+    const char    *ne_name;
+    Dwarf_Unsigned ne_hash;
+    Dwarf_Off      ne_die_offset;
+    Dwarf_Off      ne_cu_die_offset;
+    Dwarf_Small    ne_kind;
+};
+
+struct Dwarf_Name_Index_s {
+    Dwarf_Gdbindex                    ni_gdbindex;
+    /*  The .gdb_index CU list length, a CU index at
+        least this is a type unit. */
+    Dwarf_Unsigned                    ni_gdb_cu_count;
+    Dwarf_Unsigned                    ni_gdb_tu_count;
+
+    struct Dwarf_Name_Index_Entry_s  *ni_entries;
+    Dwarf_Unsigned                    ni_count;
+    Dwarf_Unsigned                   *ni_slots;
+    Dwarf_Unsigned                    ni_slot_count;
+};
+
+void _dwarf_name_index_destroy(Dwarf_Debug dbg);
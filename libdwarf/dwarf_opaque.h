@@ -75,6 +75,9 @@
     if we are processing a debug_info section. And vice versa
     for a debug_types section. */
 
+/*  The number of attribute value offsets a Dwarf_Die keeps. */
+#define DW_DIE_VALUE_CACHE 8
+
 struct Dwarf_Die_s {
     Dwarf_Byte_Ptr di_debug_ptr;
     Dwarf_Abbrev_List di_abbrev_list;
@@ -83,6 +86,16 @@ struct Dwarf_Die_s {
 
     /* TRUE if part of debug_info. FALSE if part of .debug_types. */
     Dwarf_Bool di_is_info;
+
+    /*  New October 2026.
+        The offsets from di_debug_ptr of the values of the
+        first di_value_count attributes, recorded as attribute
+        lookups step over them (see _dwarf_get_value_ptr())
+        so later lookups on this DIE start where
+        earlier ones got to.  Not kept for an abbreviation
+        with DW_FORM_indirect nor past 64K.  */
+    Dwarf_Small di_value_count;
+    Dwarf_Half di_value_offsets[DW_DIE_VALUE_CACHE];
 };
 
 struct Dwarf_Attribute_s {
@@ -248,9 +261,20 @@ struct Dwarf_CU_Context_s {
         Set when the CU die is accessed by dwarf_siblingof(). */
     Dwarf_Unsigned cc_cu_die_global_sec_offset;
 
-    Dwarf_Byte_Ptr cc_last_abbrev_ptr;
-    Dwarf_Byte_Ptr cc_last_abbrev_endptr;
-    Dwarf_Hash_Table cc_abbrev_hash_table;
+    /*  The abbreviations, shared with other CUs using
+        the same abbreviation table.  See dwarf_util.h */
+    struct Dwarf_Abbrev_Table_s *cc_abbrev_table;
+
+    /*  New October 2026.
+        The ends of the subtrees dwarf_siblingof_b() has
+        walked, so the next sibling of those DIEs is found
+        without walking again.  An open addressing hash table
+        of cc_sibling_slot_count (a power of two) entries,
+        cc_sibling_count in use. malloc()ed.
+        See struct Dwarf_Sibling_Slot_s.  */
+    struct Dwarf_Sibling_Slot_s *cc_sibling_slots;
+    Dwarf_Unsigned cc_sibling_slot_count;
+    Dwarf_Unsigned cc_sibling_count;
     Dwarf_CU_Context cc_next;
 
     /*unsigned char cc_offset_length; */
@@ -311,6 +335,14 @@ struct Dwarf_Section_s {
         Set dss_was_malloc  TRUE */
     Dwarf_Small    dss_requires_decompress;
 
+    /*  Non-zero if the decompressed data was mapped from
+        the decompressed section cache (see
+        dwarf_set_decompress_cache_dir()): the mapping,
+        to be unmapped by dwarf_finish() even if relocation
+        moved dss_data to a malloc copy. */
+    Dwarf_Small   *dss_mmap_realarea;
+    Dwarf_Unsigned dss_mmap_size;
+
     /*  For non-elf, leaving the following fields zero
         will mean they are ignored. */
     /*  dss_link should be zero unless a section has a link
@@ -360,6 +392,18 @@ struct Dwarf_Harmless_s {
   char **  dh_errors;
 };
 
+/*  Limits and tracks the memory used for compiled
+    frame row tables (struct Dwarf_Frame_Rows_s in dwarf_frame.h).
+    A zero rc_max_bytes (the default) means no row tables
+    are built. */
+struct Dwarf_Frame_Row_Cache_s {
+    Dwarf_Unsigned rc_max_bytes;
+    Dwarf_Unsigned rc_bytes;
+    /*  Most recently used first. */
+    Dwarf_Fde      rc_lru_head;
+    Dwarf_Fde      rc_lru_tail;
+};
+
 /* Data needed seperately for debug_info and debug_types
    as we may be reading both interspersed. */
 
@@ -374,10 +418,15 @@ struct Dwarf_Debug_InfoTypes_s {
     /*  Points to the last CU Context added to the list by
         dwarf_next_cu_header(). */
     Dwarf_CU_Context de_cu_context_list_end;
-    /*  This is the list of CU contexts read for dwarf_offdie().  These
-        may read ahead of dwarf_next_cu_header(). */
-    Dwarf_CU_Context de_offdie_cu_context;
-    Dwarf_CU_Context de_offdie_cu_context_end;
+    /*  Every CU context in de_cu_context_list (whether made
+        by dwarf_next_cu_header() or, reading ahead of it,
+        by dwarf_offdie()), sorted by cc_debug_offset
+        so an offset can be mapped to its CU by binary search.
+        A malloc-ed growable array of de_cu_context_index_size
+        entries of which de_cu_context_index_count are in use. */
+    Dwarf_CU_Context *de_cu_context_index;
+    Dwarf_Unsigned de_cu_context_index_count;
+    Dwarf_Unsigned de_cu_context_index_size;
 
     /*  Offset of last byte of last CU read.
         Actually one-past that last byte.  So
@@ -514,19 +563,21 @@ struct Dwarf_Tied_Data_s {
         This helps us do it only when it may be productive. */
     Dwarf_Bool td_is_tied_object;
 
-    /*  If non-zero is a dwarf_tsearch 'tree'.
-        Only non-zero if td_is_tied_object is set and
-        we had a reason to build the search tree..
-
-        The Key for each record is a Dwarf_Sig8
-        (8 bytes).
-        The data for each is a pointer to a Dwarf_CU_context
-        record in this dbg (cu_context in
-        one of this dbg's de_cu_context_list). */
-    void *td_tied_search;
-
+    /*  Signature lookups in a tied object use the
+        compile unit table of its de_sig_index. */
 };
 
+/*  This is an elf-only extension to get SHF_COMPRESSED flag from sh_flags.
+    if pointer not set (which is normal for non-elf objects)
+    it is fine.  */
+typedef int (*_dwarf_get_elf_flags_func_ptr_type)(
+    void* obj_in,
+    Dwarf_Half section_index,
+    Dwarf_Unsigned *flags_out,
+    Dwarf_Unsigned *addralign_out,
+    int *error);
+extern _dwarf_get_elf_flags_func_ptr_type _dwarf_get_elf_flags_func_ptr;
+
 struct Dwarf_Debug_s {
     /*  All file access methods and support data
         are hidden in this structure.
@@ -534,6 +585,11 @@ struct Dwarf_Debug_s {
         structure and contents. */
     struct Dwarf_Obj_Access_Interface_s *de_obj_file;
 
+    /*  The sh_flags access function for de_obj_file (or 0).
+        Recorded per dbg so objects opened through different
+        ELF access methods do not share it. */
+    _dwarf_get_elf_flags_func_ptr_type de_get_elf_flags;
+
     Dwarf_Handler de_errhand;
     Dwarf_Ptr de_errarg;
 
@@ -555,10 +611,32 @@ struct Dwarf_Debug_s {
         non-zero means do not do the check. */
     Dwarf_Small de_assume_string_in_bounds;
 
+    /*  Whether to apply relocations to sections as they
+        are loaded, set by dwarf_set_reloc_application_b().
+        Until that is called (de_apply_relocs_set zero)
+        the global dwarf_set_reloc_application() value
+        applies. */
+    Dwarf_Small de_apply_relocs;
+    Dwarf_Small de_apply_relocs_set;
+
     /*  Keep track of allocations so a dwarf_finish call can clean up.
         Null till a tree is created */
     void * de_alloc_tree;
 
+    /*  Non-null only while arena allocation is in effect.
+        See dwarf_set_alloc_arena() in dwarf_alloc.c */
+    struct Dwarf_Alloc_Arena_s *de_alloc_arena;
+    /*  Slabs of an arena that was turned off; the records
+        in them may still be in use so they are kept
+        till dwarf_finish(). */
+    struct Dwarf_Alloc_Arena_s *de_alloc_arena_retired;
+    /*  Count of records handed out by _dwarf_get_alloc()
+        and of records passed back to dwarf_dealloc(),
+        indexed by DW_DLA type.
+        See dwarf_get_alloc_stats(). */
+    Dwarf_Unsigned de_alloc_count[ALLOC_AREA_INDEX_TABLE_MAX];
+    Dwarf_Unsigned de_dealloc_count[ALLOC_AREA_INDEX_TABLE_MAX];
+
     /*  These fields are used to process debug_frame section.  **Updated
         by dwarf_get_fde_list in dwarf_frame.h */
     /*  Points to contiguous block of pointers to Dwarf_Cie_s structs. */
@@ -596,6 +674,14 @@ struct Dwarf_Debug_s {
     /* gnu: the g++ eh_frame section */
     struct Dwarf_Section_s de_debug_frame_eh_gnu;
 
+    /*  gnu: .eh_frame_hdr, a search table for .eh_frame.
+        Used by dwarf_get_fde_at_pc_eh_hdr(). */
+    struct Dwarf_Section_s de_debug_frame_eh_gnu_hdr;
+    /*  CIEs created for dwarf_get_fde_at_pc_eh_hdr(),
+        chained through ci_next.  Freed by dwarf_finish(). */
+    Dwarf_Cie de_eh_hdr_cie_head;
+    Dwarf_Unsigned de_eh_hdr_cie_count;
+
     struct Dwarf_Section_s de_debug_pubtypes; /* DWARF3 .debug_pubtypes */
 
 
@@ -657,6 +743,10 @@ struct Dwarf_Debug_s {
     unsigned char de_big_endian_object; /* Non-zero if big-endian
         object opened. */
 
+    /*  Per-FDE compiled frame row tables.
+        See dwarf_set_frame_row_cache_size() in dwarf_frame.c */
+    struct Dwarf_Frame_Row_Cache_s de_frame_row_cache;
+
     struct Dwarf_dbg_sect_s de_debug_sections[DWARF_MAX_DEBUG_SECTIONS];
     unsigned de_debug_sections_total_entries; /* Number actually used. */
 
@@ -666,6 +756,42 @@ struct Dwarf_Debug_s {
 
     struct Dwarf_Tied_Data_s de_tied_data;
 
+    /*  The address-to-line index, built on first use.
+        See dwarf_addr_line.c */
+    struct Dwarf_Addr_Line_Index_s *de_addr_line_index;
+
+    /*  The address-to-CU map, built on first use.
+        See dwarf_addr_cu.c */
+    struct Dwarf_Addr_CU_Map_s *de_addr_cu_map;
+
+    /*  The name lookup index, built on first use.
+        See dwarf_name_index.c */
+    struct Dwarf_Name_Index_s *de_name_index;
+
+    /*  The type unit and compile unit signature tables,
+        each built on first use. See dwarf_sig_index.c */
+    struct Dwarf_Sig_Index_s *de_sig_index;
+
+    /*  The abbreviation tables, one per .debug_abbrev
+        offset used, shared by the CUs. See dwarf_util.c */
+    struct Dwarf_Abbrev_Tables_s *de_abbrev_tables;
+
+    /*  The decompressed section cache directory, or NULL.
+        malloc-ed. */
+    char *de_zcache_dir;
+
+    /*  The object part of the decompressed section and
+        index cache file names (the build id), found on
+        first use by _dwarf_cache_object_key(). malloc-ed. */
+    char *de_cache_objkey;
+
+    /*  The index cache directory, or NULL. malloc-ed.
+        See dwarf_index_cache.c */
+    char *de_index_cache_dir;
+
+    /*  Non-null in concurrent-read mode.
+        See dwarf_concurrent.c */
+    struct Dwarf_Concurrent_s *de_concurrent;
 };
 
 int dwarf_printf(Dwarf_Debug dbg, const char * format, ...)
@@ -703,6 +829,7 @@ void *_dwarf_memcpy_swap_bytes(void *s1, const void *s2, size_t len);
 int _dwarf_load_section(Dwarf_Debug,
     struct Dwarf_Section_s *,
     Dwarf_Error *);
+void _dwarf_unmap_cached_section(struct Dwarf_Section_s *);
 
 
 int _dwarf_get_string_base_attr_value(Dwarf_Debug dbg,
@@ -779,8 +906,6 @@ _dwarf_search_for_signature(Dwarf_Debug dbg,
    Dwarf_Error *error);
 
 
-void _dwarf_tied_destroy_free_node(void *node);
-
 int
 _dwarf_next_cu_header_internal(Dwarf_Debug dbg,
     Dwarf_Bool is_info,
@@ -797,6 +922,14 @@ _dwarf_next_cu_header_internal(Dwarf_Debug dbg,
     Dwarf_Half     * header_cu_type,
     Dwarf_Error * error);
 
+int
+_dwarf_get_cu_context_at_offset(Dwarf_Debug dbg,
+    Dwarf_Off offset, Dwarf_Bool is_info,
+    Dwarf_CU_Context *context_out,
+    Dwarf_Sig8 *dwo_id_out,
+    Dwarf_Bool *dwo_id_present_out,
+    Dwarf_Error *error);
+
 /* Relates to .debug_addr */
 int _dwarf_look_in_local_and_tied(Dwarf_Half attr_form,
     Dwarf_CU_Context context,
@@ -823,16 +956,15 @@ int _dwarf_extract_local_debug_str_string_given_offset(Dwarf_Debug dbg,
 
 int _dwarf_file_name_is_full_path(Dwarf_Small  *fname);
 
-/*  This is an elf-only extension to get SHF_COMPRESSED flag from sh_flags.
-    if pointer not set (which is normal for non-elf objects)
-    it is fine.  */
-typedef int (*_dwarf_get_elf_flags_func_ptr_type)(
-    void* obj_in,
-    Dwarf_Half section_index,
-    Dwarf_Unsigned *flags_out,
-    Dwarf_Unsigned *addralign_out,
-    int *error);
-extern _dwarf_get_elf_flags_func_ptr_type _dwarf_get_elf_flags_func_ptr;
+/*  dwarf_object_init() with an explicit sh_flags access
+    function (which may be 0). */
+int _dwarf_object_init_b(Dwarf_Obj_Access_Interface* obj,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    _dwarf_get_elf_flags_func_ptr_type flags_func,
+    Dwarf_Debug* ret_dbg,
+    Dwarf_Error* error);
+
 
 Dwarf_Byte_Ptr _dwarf_calculate_info_section_start_ptr(Dwarf_CU_Context context, Dwarf_Unsigned *section_len_out);
 
@@ -30,8 +30,11 @@
 #include "dwarf_incl.h"
 #include <stdio.h>
 #include "dwarf_die_deliv.h"
+#include "dwarf_die_cursor.h"
+#include "dwarf_concurrent.h"
 
 #define TRUE 1
+#define FALSE 0
 static int _dwarf_die_attr_unsigned_constant(Dwarf_Die die,
     Dwarf_Half attr,
     Dwarf_Unsigned * return_val,
@@ -305,10 +308,9 @@ dwarf_attrlist(Dwarf_Die die,
 {
     Dwarf_Word attr_count = 0;
     Dwarf_Word i = 0;
+    Dwarf_Unsigned abi = 0;
     Dwarf_Half attr = 0;
     Dwarf_Half attr_form = 0;
-    Dwarf_Byte_Ptr abbrev_ptr = 0;
-    Dwarf_Byte_Ptr abbrev_end = 0;
     Dwarf_Abbrev_List abbrev_list = 0;
     Dwarf_Attribute new_attr = 0;
     Dwarf_Attribute head_attr = NULL;
@@ -317,7 +319,6 @@ dwarf_attrlist(Dwarf_Die die,
     Dwarf_Debug dbg = 0;
     Dwarf_Byte_Ptr info_ptr = 0;
     Dwarf_Byte_Ptr die_info_end = 0;
-    int lres = 0;
     Dwarf_CU_Context context = 0;
 
     CHECK_DIE(die, DW_DLV_ERROR);
@@ -326,90 +327,71 @@ dwarf_attrlist(Dwarf_Die die,
     die_info_end =
         _dwarf_calculate_info_section_end_ptr(context);
 
-    lres = _dwarf_get_abbrev_for_code(context,
-        die->di_abbrev_list->abl_code,
-        &abbrev_list,error);
-    if (lres == DW_DLV_ERROR) {
-        return lres;
-    }
-    if (lres == DW_DLV_NO_ENTRY) {
+    abbrev_list = die->di_abbrev_list;
+    if (!abbrev_list) {
         _dwarf_error(dbg, error, DW_DLE_DIE_BAD);
         return DW_DLV_ERROR;
     }
 
-    abbrev_ptr = abbrev_list->abl_abbrev_ptr;
-    abbrev_end = _dwarf_calculate_abbrev_section_end_ptr(context);
-
-
     info_ptr = die->di_debug_ptr;
     SKIP_LEB128_WORD_CK(info_ptr,dbg,error,die_info_end);
 
-    do {
-        Dwarf_Unsigned utmp2;
-
-        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp2,dbg,error,abbrev_end);
-        attr = (Dwarf_Half) utmp2;
-        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp2,dbg,error,abbrev_end);
-        attr_form = (Dwarf_Half) utmp2;
-        if (!_dwarf_valid_form_we_know(dbg,attr_form,attr)) {
-            _dwarf_error(dbg, error, DW_DLE_UNKNOWN_FORM);
+    /*  The attribute/form pairs were decoded (and the
+        forms checked) when the abbreviation was read. */
+    for (abi = 0; abi < abbrev_list->abl_count; ++abi) {
+        struct Dwarf_Abbrev_Attr_s *aa = abbrev_list->abl_attrs + abi;
+
+        attr = aa->aa_attr;
+        attr_form = aa->aa_form;
+        new_attr =
+            (Dwarf_Attribute) _dwarf_get_alloc(dbg, DW_DLA_ATTR, 1);
+        if (new_attr == NULL) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
             return DW_DLV_ERROR;
         }
 
-        if (attr != 0) {
-            new_attr =
-                (Dwarf_Attribute) _dwarf_get_alloc(dbg, DW_DLA_ATTR, 1);
-            if (new_attr == NULL) {
-                _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
-                return DW_DLV_ERROR;
-            }
+        new_attr->ar_attribute = attr;
+        new_attr->ar_attribute_form_direct = attr_form;
+        new_attr->ar_attribute_form = attr_form;
+        if (attr_form == DW_FORM_indirect) {
+            Dwarf_Unsigned utmp6;
 
-            new_attr->ar_attribute = attr;
-            new_attr->ar_attribute_form_direct = attr_form;
+            /* DECODE_LEB128_UWORD does info_ptr update */
+            DECODE_LEB128_UWORD_CK(info_ptr, utmp6,dbg,error,die_info_end);
+            attr_form = (Dwarf_Half) utmp6;
             new_attr->ar_attribute_form = attr_form;
-            if (attr_form == DW_FORM_indirect) {
-                Dwarf_Unsigned utmp6;
-
-                /* DECODE_LEB128_UWORD does info_ptr update */
-                DECODE_LEB128_UWORD_CK(info_ptr, utmp6,dbg,error,die_info_end);
-                attr_form = (Dwarf_Half) utmp6;
-                new_attr->ar_attribute_form = attr_form;
-            }
-            if (_dwarf_reference_outside_section(die,
-                (Dwarf_Small*) info_ptr,
-                (Dwarf_Small*) info_ptr)) {
-                _dwarf_error(dbg, error,DW_DLE_ATTR_OUTSIDE_SECTION);
-                return DW_DLV_ERROR;
-            }
-            new_attr->ar_cu_context = die->di_cu_context;
-            new_attr->ar_debug_ptr = info_ptr;
-            new_attr->ar_die = die;
-            {
-                Dwarf_Unsigned sov = 0;
-                int res = _dwarf_get_size_of_val(dbg,
-                    attr_form,
-                    die->di_cu_context->cc_version_stamp,
-                    die->di_cu_context->cc_address_size,
-                    info_ptr,
-                    die->di_cu_context->cc_length_size,
-                    &sov,
-                    die_info_end,
-                    error);
-                if(res!= DW_DLV_OK) {
-                    return res;
-                }
-                info_ptr += sov;
+        }
+        if (_dwarf_reference_outside_section(die,
+            (Dwarf_Small*) info_ptr,
+            (Dwarf_Small*) info_ptr)) {
+            _dwarf_error(dbg, error,DW_DLE_ATTR_OUTSIDE_SECTION);
+            return DW_DLV_ERROR;
+        }
+        new_attr->ar_cu_context = die->di_cu_context;
+        new_attr->ar_debug_ptr = info_ptr;
+        new_attr->ar_die = die;
+        {
+            Dwarf_Unsigned sov = 0;
+            int res = ABBREV_ATTR_VALUE_SIZE(context,
+                aa,attr_form,
+                info_ptr,
+                die_info_end,
+                &sov,
+                error);
+            if(res!= DW_DLV_OK) {
+                return res;
             }
+            info_ptr += sov;
+        }
 
-            if (head_attr == NULL)
-                head_attr = curr_attr = new_attr;
-            else {
-                curr_attr->ar_next = new_attr;
-                curr_attr = new_attr;
-            }
-            attr_count++;
+        if (head_attr == NULL)
+            head_attr = curr_attr = new_attr;
+        else {
+            curr_attr->ar_next = new_attr;
+            curr_attr = new_attr;
         }
-    } while (attr != 0 || attr_form != 0);
+        attr_count++;
+    }
 
     if (attr_count == 0) {
         *attrbuf = NULL;
@@ -445,6 +427,11 @@ dwarf_attrlist(Dwarf_Die die,
     Returns NULL on error, or if attr is not found.
     However, *attr_form is 0 on error, and positive
     otherwise.
+
+    The attribute is found in the decoded abbreviation
+    (abl_attrs) without looking at the DIE. Only the values
+    before it are stepped over, starting from the last value
+    offset recorded in the DIE by earlier lookups.
 */
 static int
 _dwarf_get_value_ptr(Dwarf_Die die,
@@ -453,86 +440,90 @@ _dwarf_get_value_ptr(Dwarf_Die die,
     Dwarf_Byte_Ptr * ptr_to_value,
     Dwarf_Error *error)
 {
-    Dwarf_Byte_Ptr abbrev_ptr = 0;
-    Dwarf_Byte_Ptr abbrev_end = 0;
-    Dwarf_Abbrev_List abbrev_list;
-    Dwarf_Half curr_attr = 0;
-    Dwarf_Half curr_attr_form = 0;
+    Dwarf_Abbrev_List abbrev_list = die->di_abbrev_list;
+    struct Dwarf_Abbrev_Attr_s *attrs = 0;
     Dwarf_Byte_Ptr info_ptr = 0;
     Dwarf_CU_Context context = die->di_cu_context;
     Dwarf_Byte_Ptr die_info_end = 0;
     Dwarf_Debug dbg = 0;
-    int lres = 0;
+    Dwarf_Bool cache_ok = FALSE;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Unsigned j = 0;
+    Dwarf_Half form = 0;
 
     if (!context) {
         _dwarf_error(NULL,error,DW_DLE_DIE_NO_CU_CONTEXT);
         return DW_DLV_ERROR;
     }
     dbg = context->cc_dbg;
-    die_info_end =
-        _dwarf_calculate_info_section_end_ptr(context);
-
-    lres = _dwarf_get_abbrev_for_code(context,
-        die->di_abbrev_list->abl_code,
-        &abbrev_list,error);
-    if (lres == DW_DLV_ERROR) {
-        return lres;
-    }
-    if (lres == DW_DLV_NO_ENTRY) {
+    if (!abbrev_list) {
         _dwarf_error(dbg,error,DW_DLE_CU_DIE_NO_ABBREV_LIST);
         return DW_DLV_ERROR;
     }
-
-    abbrev_ptr = abbrev_list->abl_abbrev_ptr;
-    abbrev_end = _dwarf_calculate_abbrev_section_end_ptr(context);
-
-    info_ptr = die->di_debug_ptr;
-    SKIP_LEB128_WORD_CK(info_ptr,dbg,error,die_info_end);
-
-    do {
-        Dwarf_Unsigned utmp3 = 0;
-        Dwarf_Unsigned value_size=0;
+    attrs = abbrev_list->abl_attrs;
+    count = abbrev_list->abl_count;
+    for (i = 0; i < count && attrs[i].aa_attr != attr; ++i) {
+    }
+    if (i == count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    cache_ok = !abbrev_list->abl_has_indirect;
+    if (i < die->di_value_count) {
+        *attr_form = attrs[i].aa_form;
+        *ptr_to_value = die->di_debug_ptr + die->di_value_offsets[i];
+        return DW_DLV_OK;
+    }
+    die_info_end =
+        _dwarf_calculate_info_section_end_ptr(context);
+    if (die->di_value_count) {
+        j = die->di_value_count - 1;
+        info_ptr = die->di_debug_ptr + die->di_value_offsets[j];
+    } else {
+        info_ptr = die->di_debug_ptr;
+        SKIP_LEB128_WORD_CK(info_ptr,dbg,error,die_info_end);
+        if (cache_ok) {
+            die->di_value_offsets[0] = info_ptr - die->di_debug_ptr;
+            die->di_value_count = 1;
+        }
+    }
+    for (;; ++j) {
+        Dwarf_Unsigned value_size = 0;
         int res = 0;
 
-        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp3,dbg,error,abbrev_end);
-        curr_attr = (Dwarf_Half) utmp3;
-        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp3,dbg,error,abbrev_end);
-        curr_attr_form = (Dwarf_Half) utmp3;
-        if (curr_attr_form == DW_FORM_indirect) {
+        form = attrs[j].aa_form;
+        if (form == DW_FORM_indirect) {
             Dwarf_Unsigned utmp6;
 
             /* DECODE_LEB128_UWORD updates info_ptr */
             DECODE_LEB128_UWORD_CK(info_ptr, utmp6,dbg,error,die_info_end);
-            curr_attr_form = (Dwarf_Half) utmp6;
+            form = (Dwarf_Half) utmp6;
         }
-
-        if (curr_attr == attr) {
-            *attr_form = curr_attr_form;
-            *ptr_to_value = info_ptr;
-            return DW_DLV_OK;
+        if (j == i) {
+            break;
         }
-
-        res = _dwarf_get_size_of_val(dbg,
-            curr_attr_form,
-            die->di_cu_context->cc_version_stamp,
-            die->di_cu_context->cc_address_size,
-            info_ptr,
-            die->di_cu_context->cc_length_size,
-            &value_size,
-            die_info_end,
-            error);
+        res = ABBREV_ATTR_VALUE_SIZE(context,attrs+j,form,
+            info_ptr,die_info_end,&value_size,error);
         if (res != DW_DLV_OK) {
             return res;
         }
-        if ((info_ptr + value_size) > die_info_end) {
+        if (value_size > (Dwarf_Unsigned)(die_info_end - info_ptr)) {
             /*  Something badly wrong. We point past end
                 of debug_info or debug_types . */
             _dwarf_error(dbg,error,DW_DLE_DIE_ABBREV_BAD);
             return DW_DLV_ERROR;
         }
         info_ptr+= value_size;
-    } while (curr_attr != 0 || curr_attr_form != 0);
-    return DW_DLV_NO_ENTRY;
+        if (cache_ok && j+1 == die->di_value_count &&
+            j+1 < DW_DIE_VALUE_CACHE &&
+            (info_ptr - die->di_debug_ptr) <= 0xffff) {
+            die->di_value_offsets[j+1] = info_ptr - die->di_debug_ptr;
+            die->di_value_count++;
+        }
+    }
+    *attr_form = form;
+    *ptr_to_value = info_ptr;
+    return DW_DLV_OK;
 }
 
 int
@@ -632,6 +623,96 @@ dwarf_attr(Dwarf_Die die,
     return DW_DLV_OK;
 }
 
+/*  New October 2026.
+    Fetches the values of the attr_count attributes in
+    attr_list in one pass over the DIE, without allocating
+    anything.  values[i] is for attr_list[i]: if the DIE
+    lacks that attribute it is all zero except av_attr.
+    *found_count is the number of attributes found.
+    Returns DW_DLV_NO_ENTRY if none of them is present.  */
+int
+dwarf_get_attrs(Dwarf_Die die,
+    const Dwarf_Half *attr_list,
+    Dwarf_Unsigned attr_count,
+    Dwarf_Attr_View *values,
+    Dwarf_Unsigned *found_count,
+    Dwarf_Error *error)
+{
+    Dwarf_CU_Context context = 0;
+    Dwarf_Abbrev_List abbrev_list = 0;
+    Dwarf_Debug dbg = 0;
+    Dwarf_Byte_Ptr info_ptr = 0;
+    Dwarf_Byte_Ptr die_info_end = 0;
+    Dwarf_Bool cache_ok = FALSE;
+    Dwarf_Unsigned found = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Unsigned j = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    context = die->di_cu_context;
+    dbg = context->cc_dbg;
+    abbrev_list = die->di_abbrev_list;
+    if (!abbrev_list) {
+        _dwarf_error(dbg,error,DW_DLE_CU_DIE_NO_ABBREV_LIST);
+        return DW_DLV_ERROR;
+    }
+    for (i = 0; i < attr_count; ++i) {
+        memset(values+i,0,sizeof(Dwarf_Attr_View));
+        values[i].av_attr = attr_list[i];
+    }
+    die_info_end =
+        _dwarf_calculate_info_section_end_ptr(context);
+    info_ptr = die->di_debug_ptr;
+    SKIP_LEB128_WORD_CK(info_ptr,dbg,error,die_info_end);
+    cache_ok = !abbrev_list->abl_has_indirect;
+    for (j = 0; j < abbrev_list->abl_count && found < attr_count; ++j) {
+        struct Dwarf_Abbrev_Attr_s *aa = abbrev_list->abl_attrs + j;
+        Dwarf_Half form = aa->aa_form;
+        Dwarf_Unsigned value_size = 0;
+        int res = 0;
+
+        if (cache_ok && j == die->di_value_count &&
+            j < DW_DIE_VALUE_CACHE &&
+            (info_ptr - die->di_debug_ptr) <= 0xffff) {
+            /*  Record the value offsets as dwarf_attr() would. */
+            die->di_value_offsets[j] = info_ptr - die->di_debug_ptr;
+            die->di_value_count = j+1;
+        }
+        if (form == DW_FORM_indirect) {
+            Dwarf_Unsigned utmp6;
+
+            DECODE_LEB128_UWORD_CK(info_ptr, utmp6,dbg,error,die_info_end);
+            form = (Dwarf_Half) utmp6;
+        }
+        res = ABBREV_ATTR_VALUE_SIZE(context,aa,form,
+            info_ptr,die_info_end,&value_size,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (value_size > (Dwarf_Unsigned)(die_info_end - info_ptr)) {
+            _dwarf_error(dbg,error,DW_DLE_DIE_ABBREV_BAD);
+            return DW_DLV_ERROR;
+        }
+        for (i = 0; i < attr_count; ++i) {
+            if (attr_list[i] == aa->aa_attr && !values[i].av_form) {
+                res = _dwarf_fill_attr_view(dbg,die_info_end,
+                    aa->aa_attr,form,info_ptr,value_size,
+                    values+i,error);
+                if (res != DW_DLV_OK) {
+                    return res;
+                }
+                ++found;
+            }
+        }
+        info_ptr += value_size;
+    }
+    *found_count = found;
+    if (!found) {
+        return DW_DLV_NO_ENTRY;
+    }
+    return DW_DLV_OK;
+}
+
 /*  A DWP (.dwp) package object never contains .debug_addr,
     only a normal .o or executable object.
     Error returned here is on dbg, not tieddbg. */
@@ -891,8 +972,8 @@ dwarf_dietype_offset(Dwarf_Die die,
 
 
 
-int
-_dwarf_get_string_base_attr_value(Dwarf_Debug dbg,
+static int
+get_string_base_attr_value(Dwarf_Debug dbg,
     Dwarf_CU_Context context,
     Dwarf_Unsigned *sbase_out,
     Dwarf_Error *error)
@@ -945,6 +1026,27 @@ _dwarf_get_string_base_attr_value(Dwarf_Debug dbg,
     *sbase_out = 0;
     return DW_DLV_OK;
 }
+
+/*  The base is recorded in the context on first use,
+    so in concurrent-read mode the whole lookup is
+    done under the build lock. */
+int
+_dwarf_get_string_base_attr_value(Dwarf_Debug dbg,
+    Dwarf_CU_Context context,
+    Dwarf_Unsigned *sbase_out,
+    Dwarf_Error *error)
+{
+    int res = 0;
+
+    if (!dbg->de_concurrent) {
+        return get_string_base_attr_value(dbg,context,
+            sbase_out,error);
+    }
+    DWARF_BUILD_LOCK(dbg);
+    res = get_string_base_attr_value(dbg,context,sbase_out,error);
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
 /*  Goes to the CU die and finds the DW_AT_GNU_addr_base
     (or DW_AT_addr_base ) and gets the value from that CU die
     and returns it thou abase_out. If we cannot find the value
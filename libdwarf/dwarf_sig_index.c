@@ -0,0 +1,390 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  New October 2026.
+    Signature to unit lookup for objects without a
+    DWP package index.
+    Resolving a DW_FORM_ref_sig8 (or, in a tied object,
+    the DW_AT_dwo_id of a skeleton CU) used to mean
+    reading CU headers, making a CU context for each,
+    until the signature turned up.
+    Here the type unit headers are read once, without
+    making any CU context, into a flat hash table
+    (see dwarf_sig_index.h).  A CU context is made only
+    for a unit actually looked up.
+    The compile unit table needs the DW_AT_dwo_id of
+    each CU die so it is built separately, and only
+    when a "cu" or tied lookup is done.  */
+
+#include "config.h"
+#include "dwarf_incl.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include "dwarf_sig_index.h"
+#include "dwarf_concurrent.h"
+
+#define FALSE 0
+#define TRUE 1
+
+/*  Starting sizes of the entry and slot arrays.
+    SIG_SLOTS_START must be a power of two. */
+#define SIG_ENTRIES_START 64
+#define SIG_SLOTS_START   128
+
+static Dwarf_Unsigned
+sig_hash(Dwarf_Sig8 *sig)
+{
+    Dwarf_Unsigned h = 0;
+
+    /*  Signatures are already hash values,
+        a little mixing is enough. */
+    memcpy(&h,sig->signature,sizeof(h));
+    h ^= h >> 31;
+    h *= 0x7feb352d;
+    h ^= h >> 29;
+    return h;
+}
+
+/*  Returns the st_entries index + 1 of sig, or 0.
+    If slot_out is non-null, the slot where sig is
+    or would go is returned through it. */
+static Dwarf_Unsigned
+sig_table_probe(struct Dwarf_Sig_Table_s *tab,
+    Dwarf_Sig8 *sig,
+    Dwarf_Unsigned *slot_out)
+{
+    Dwarf_Unsigned mask = tab->st_slot_count - 1;
+    Dwarf_Unsigned s = sig_hash(sig) & mask;
+
+    for (;; s = (s+1) & mask) {
+        Dwarf_Unsigned e = tab->st_slots[s];
+
+        if (!e || !memcmp(tab->st_entries[e-1].se_sig.signature,
+            sig->signature,sizeof(Dwarf_Sig8))) {
+            if (slot_out) {
+                *slot_out = s;
+            }
+            return e;
+        }
+    }
+}
+
+/*  Doubles the slot array and rehashes the entries. */
+static int
+sig_table_grow_slots(struct Dwarf_Sig_Table_s *tab)
+{
+    Dwarf_Unsigned newcount = tab->st_slot_count?
+        tab->st_slot_count*2:SIG_SLOTS_START;
+    Dwarf_Unsigned i = 0;
+
+    free(tab->st_slots);
+    tab->st_slot_count = 0;
+    tab->st_slots = (Dwarf_Unsigned *)calloc(newcount,
+        sizeof(Dwarf_Unsigned));
+    if (!tab->st_slots) {
+        return DW_DLV_ERROR;
+    }
+    tab->st_slot_count = newcount;
+    for (i = 0; i < tab->st_count; ++i) {
+        Dwarf_Unsigned s = 0;
+
+        sig_table_probe(tab,&tab->st_entries[i].se_sig,&s);
+        tab->st_slots[s] = i+1;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Adds an entry unless its signature is already
+    present, in which case the first unit with
+    the signature (in section order) is kept. */
+static int
+sig_table_add(Dwarf_Debug dbg,
+    struct Dwarf_Sig_Table_s *tab,
+    struct Dwarf_Sig_Index_Entry_s *ent,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned s = 0;
+
+    /*  Keep the load factor at most 3/4. */
+    if ((tab->st_count+1)*4 > tab->st_slot_count*3) {
+        if (sig_table_grow_slots(tab) != DW_DLV_OK) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+    }
+    if (sig_table_probe(tab,&ent->se_sig,&s)) {
+        return DW_DLV_OK;
+    }
+    if (tab->st_count == tab->st_size) {
+        Dwarf_Unsigned newsize = tab->st_size?
+            tab->st_size*2:SIG_ENTRIES_START;
+        struct Dwarf_Sig_Index_Entry_s *newents =
+            (struct Dwarf_Sig_Index_Entry_s *)realloc(tab->st_entries,
+            newsize*sizeof(struct Dwarf_Sig_Index_Entry_s));
+
+        if (!newents) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        tab->st_entries = newents;
+        tab->st_size = newsize;
+    }
+    tab->st_entries[tab->st_count] = *ent;
+    tab->st_count++;
+    tab->st_slots[s] = tab->st_count;
+    return DW_DLV_OK;
+}
+
+static void
+sig_table_free(struct Dwarf_Sig_Table_s *tab)
+{
+    free(tab->st_entries);
+    free(tab->st_slots);
+    memset(tab,0,sizeof(*tab));
+}
+
+/*  Reads the unit headers of .debug_info (is_info TRUE)
+    or .debug_types, adding the type units to the
+    type unit table (want_tu TRUE) or the compile units
+    with a DW_AT_dwo_id to the compile unit table.
+    Only the type unit header fields are read here,
+    as _dwarf_make_CU_Context() reads them. */
+static int
+scan_unit_headers(Dwarf_Debug dbg,
+    Dwarf_Bool is_info,
+    Dwarf_Bool want_tu,
+    struct Dwarf_Sig_Table_s *tab,
+    Dwarf_Error *error)
+{
+    Dwarf_Small *dataptr = 0;
+    Dwarf_Small *section_end_ptr = 0;
+    Dwarf_Unsigned section_size = 0;
+    Dwarf_Unsigned header_size = 0;
+    Dwarf_Off offset = 0;
+    int res = 0;
+
+    res = is_info?_dwarf_load_debug_info(dbg, error):
+        _dwarf_load_debug_types(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    dataptr = is_info? dbg->de_debug_info.dss_data:
+        dbg->de_debug_types.dss_data;
+    section_size = is_info? dbg->de_debug_info.dss_size:
+        dbg->de_debug_types.dss_size;
+    section_end_ptr = dataptr + section_size;
+    header_size = _dwarf_length_of_cu_header_simple(dbg,is_info);
+    while ((offset + header_size) < section_size) {
+        Dwarf_Small *cu_ptr = dataptr + offset;
+        Dwarf_Unsigned length = 0;
+        Dwarf_Half version = 0;
+        int length_size = 0;
+        int extension_size = 0;
+        int unit_type = is_info?DW_UT_compile:DW_UT_type;
+        Dwarf_Off next_offset = 0;
+        struct Dwarf_Sig_Index_Entry_s ent;
+
+        memset(&ent,0,sizeof(ent));
+        READ_AREA_LENGTH_CK(dbg, length, Dwarf_Unsigned,
+            cu_ptr, length_size, extension_size,
+            error,section_size,section_end_ptr);
+        next_offset = offset + length + length_size + extension_size;
+        if (length > section_size || next_offset > section_size) {
+            _dwarf_error(dbg, error, DW_DLE_CU_LENGTH_ERROR);
+            return DW_DLV_ERROR;
+        }
+        READ_UNALIGNED_CK(dbg, version, Dwarf_Half,
+            cu_ptr, sizeof(Dwarf_Half),error,section_end_ptr);
+        cu_ptr += sizeof(Dwarf_Half);
+        if (version < DW_CU_VERSION2 || version > DW_CU_VERSION5) {
+            _dwarf_error(dbg, error, DW_DLE_VERSION_STAMP_ERROR);
+            return DW_DLV_ERROR;
+        }
+        if (version == DW_CU_VERSION5) {
+            unsigned char ub = 0;
+
+            READ_UNALIGNED_CK(dbg, ub, unsigned char,
+                cu_ptr, sizeof(ub),error,section_end_ptr);
+            cu_ptr += sizeof(ub);
+            unit_type = ub;
+        }
+        ent.se_offset = offset;
+        ent.se_is_info = is_info;
+        if (want_tu && unit_type == DW_UT_type) {
+            /* Skip the abbrev offset and the address size. */
+            cu_ptr += length_size + 1;
+            if ((cu_ptr + sizeof(Dwarf_Sig8)) > section_end_ptr) {
+                _dwarf_error(dbg, error, DW_DLE_INFO_HEADER_ERROR);
+                return DW_DLV_ERROR;
+            }
+            memcpy(&ent.se_sig,cu_ptr,sizeof(Dwarf_Sig8));
+            cu_ptr += sizeof(Dwarf_Sig8);
+            READ_UNALIGNED_CK(dbg, ent.se_type_offset, Dwarf_Unsigned,
+                cu_ptr, length_size,error,section_end_ptr);
+            if (ent.se_type_offset >= length) {
+                _dwarf_error(dbg, error, DW_DLE_DEBUG_TYPEOFFSET_BAD);
+                return DW_DLV_ERROR;
+            }
+            res = sig_table_add(dbg,tab,&ent,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        } else if (!want_tu && is_info &&
+            (unit_type == DW_UT_compile ||
+            unit_type == DW_UT_partial)) {
+            Dwarf_Bool dwo_id_present = FALSE;
+
+            res = _dwarf_get_cu_context_at_offset(dbg,offset,is_info,
+                &ent.se_context,&ent.se_sig,&dwo_id_present,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            if (dwo_id_present) {
+                res = sig_table_add(dbg,tab,&ent,error);
+                if (res != DW_DLV_OK) {
+                    return res;
+                }
+            }
+        }
+        offset = next_offset;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+get_sig_index(Dwarf_Debug dbg,
+    struct Dwarf_Sig_Index_s **index_out,
+    Dwarf_Error *error)
+{
+    if (!dbg->de_sig_index) {
+        dbg->de_sig_index = (struct Dwarf_Sig_Index_s *)
+            calloc(1,sizeof(struct Dwarf_Sig_Index_s));
+        if (!dbg->de_sig_index) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+    }
+    *index_out = dbg->de_sig_index;
+    return DW_DLV_OK;
+}
+
+static int
+sig_table_find(Dwarf_Debug dbg,
+    struct Dwarf_Sig_Table_s *tab,
+    Dwarf_Bool want_tu,
+    Dwarf_Sig8 *sig,
+    struct Dwarf_Sig_Index_Entry_s **entry_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned e = 0;
+
+    if (!tab->st_built) {
+        int res = 0;
+
+        if (want_tu) {
+            /*  DWARF4 type units are in .debug_types,
+                DWARF5 ones in .debug_info. */
+            res = scan_unit_headers(dbg,FALSE,TRUE,tab,error);
+            if (res == DW_DLV_ERROR) {
+                sig_table_free(tab);
+                return res;
+            }
+        }
+        res = scan_unit_headers(dbg,TRUE,want_tu,tab,error);
+        if (res == DW_DLV_ERROR) {
+            sig_table_free(tab);
+            return res;
+        }
+        tab->st_built = TRUE;
+    }
+    if (!tab->st_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    e = sig_table_probe(tab,sig,0);
+    if (!e) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *entry_out = &tab->st_entries[e-1];
+    return DW_DLV_OK;
+}
+
+/*  Finds the type unit with type signature sig,
+    building the type unit table on first use.
+    The returned entry belongs to the dbg. */
+int
+_dwarf_sig_index_find_tu(Dwarf_Debug dbg,
+    Dwarf_Sig8 *sig,
+    struct Dwarf_Sig_Index_Entry_s **entry_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Sig_Index_s *index = 0;
+    int res = 0;
+
+    DWARF_BUILD_LOCK(dbg);
+    res = get_sig_index(dbg,&index,error);
+    if (res == DW_DLV_OK) {
+        res = sig_table_find(dbg,&index->si_tu,TRUE,sig,
+            entry_out,error);
+    }
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
+
+/*  Finds the compile unit whose DW_AT_dwo_id is sig,
+    building the compile unit table on first use.
+    The se_context of the returned entry is set. */
+int
+_dwarf_sig_index_find_cu(Dwarf_Debug dbg,
+    Dwarf_Sig8 *sig,
+    struct Dwarf_Sig_Index_Entry_s **entry_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Sig_Index_s *index = 0;
+    int res = 0;
+
+    DWARF_BUILD_LOCK(dbg);
+    res = get_sig_index(dbg,&index,error);
+    if (res == DW_DLV_OK) {
+        res = sig_table_find(dbg,&index->si_cu,FALSE,sig,
+            entry_out,error);
+    }
+    DWARF_BUILD_UNLOCK(dbg);
+    return res;
+}
+
+void
+_dwarf_sig_index_destroy(Dwarf_Debug dbg)
+{
+    if (!dbg->de_sig_index) {
+        return;
+    }
+    sig_table_free(&dbg->de_sig_index->si_tu);
+    sig_table_free(&dbg->de_sig_index->si_cu);
+    free(dbg->de_sig_index);
+    dbg->de_sig_index = 0;
+}
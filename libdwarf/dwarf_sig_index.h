@@ -0,0 +1,77 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms of version 2.1 of the GNU Lesser General Public License
+  as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+  Further, this software is distributed without any warranty that it is
+  free of the rightful claim of any third person regarding infringement
+  or the like.  Any license provided herein, whether implied or
+  otherwise, applies only to this software file.  Patent licenses, if
+  any, provided herein do not apply to combinations of this program with
+  other software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this program; if not, write the Free Software
+  Foundation, Inc., 51 Franklin Street - Fifth Floor, Boston MA 02110-1301,
+  USA.
+
+*/
+
+/*  The signature index of a Dwarf_Debug.
+
+    Two tables, each built on first use in one pass
+    over the unit headers:
+    the type unit table maps a type signature
+    (DW_FORM_ref_sig8) to the type unit in .debug_types
+    or (DWARF5) .debug_info, and the compile unit table
+    maps a DW_AT_dwo_id to the compile unit in .debug_info.
+
+    The entries are kept dense, in section order, in
+    st_entries.  st_slots is an open addressing (linear
+    probing) hash table whose size is a power of two.
+    A slot is zero if empty, else one more than the index
+    of its entry.  */
+struct Dwarf_Sig_Index_Entry_s {
+    Dwarf_Sig8       se_sig;
+    /*  Global offset of the unit header. */
+    Dwarf_Off        se_offset;
+    /*  Type units: the type DIE offset relative
+        to se_offset. */
+    Dwarf_Unsigned   se_type_offset;
+    /*  Compile units: the CU context, which lasts
+        as long as the dbg. */
+    Dwarf_CU_Context se_context;
+    Dwarf_Small      se_is_info;
+};
+
+struct Dwarf_Sig_Table_s {
+    struct Dwarf_Sig_Index_Entry_s *st_entries;
+    Dwarf_Unsigned                  st_count;
+    Dwarf_Unsigned                  st_size;
+
+    Dwarf_Unsigned                 *st_slots;
+    Dwarf_Unsigned                  st_slot_count;
+
+    Dwarf_Bool                      st_built;
+};
+
+struct Dwarf_Sig_Index_s {
+    struct Dwarf_Sig_Table_s si_tu;
+    struct Dwarf_Sig_Table_s si_cu;
+};
+
+int _dwarf_sig_index_find_tu(Dwarf_Debug dbg,
+    Dwarf_Sig8 *sig,
+    struct Dwarf_Sig_Index_Entry_s **entry_out,
+    Dwarf_Error *error);
+int _dwarf_sig_index_find_cu(Dwarf_Debug dbg,
+    Dwarf_Sig8 *sig,
+    struct Dwarf_Sig_Index_Entry_s **entry_out,
+    Dwarf_Error *error);
+void _dwarf_sig_index_destroy(Dwarf_Debug dbg);
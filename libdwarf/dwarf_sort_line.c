@@ -318,6 +318,7 @@ _dwarf_update_line_sec(Dwarf_Small * line_ptr,
 
 
     memset(dbg, 0, sizeof(struct Dwarf_Debug_s));
+    dbg->de_same_endian = 1;
     dbg->de_copy_word = memcpy;
     /*  Following is a straightforward decoding of the statement program
         prologue information. */
@@ -27,6 +27,7 @@
 #include "config.h"
 #include "dwarf_incl.h"
 #include "dwarf_tsearch.h"
+#include "dwarf_sig_index.h"
 #include <stdlib.h> /* for free(). */
 #include <stdio.h> /* For debugging. */
 
@@ -44,15 +45,6 @@
 
 
 
-/* Contexts are in a list in a dbg and
-   do not move once established.
-   So saving one is ok. as long as the dbg
-   exists. */
-struct Dwarf_Tied_Entry_s {
-  Dwarf_Sig8 dt_key;
-  Dwarf_CU_Context dt_context;
-};
-
 void
 _dwarf_dumpsig(const char *msg, Dwarf_Sig8 *sig,int lineno)
 {
@@ -67,6 +59,42 @@ _dwarf_dumpsig(const char *msg, Dwarf_Sig8 *sig,int lineno)
     printf(" line %d\n",lineno);
 }
 
+#ifndef TESTING
+
+/*  Finds the CU in tieddbg whose DW_AT_dwo_id is sig
+    using the compile unit table of the signature index
+    of tieddbg (see dwarf_sig_index.c), which reads
+    the CUs of tieddbg once, on the first call.
+    If out of memory returns DW_DLV_ERROR.  */
+int
+_dwarf_search_for_signature(Dwarf_Debug tieddbg,
+    Dwarf_Sig8 sig,
+    Dwarf_CU_Context *context_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Sig_Index_Entry_s *entry = 0;
+    int res = 0;
+
+    res = _dwarf_sig_index_find_cu(tieddbg,&sig,&entry,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    *context_out = entry->se_context;
+    return DW_DLV_OK;
+}
+#endif /* ndef TESTING */
+
+
+#ifdef TESTING
+
+/*  The tsearch records the tied signature search
+    used before the signature index, kept to
+    test dwarf_tsearch. */
+struct Dwarf_Tied_Entry_s {
+  Dwarf_Sig8 dt_key;
+  Dwarf_CU_Context dt_context;
+};
+
 static void *
 tied_make_entry(Dwarf_Sig8 *key, Dwarf_CU_Context val)
 {
@@ -115,7 +143,7 @@ tied_compare_function(const void *l, const void *r)
 }
 
 
-void
+static void
 _dwarf_tied_destroy_free_node(void*nodep)
 {
     struct Dwarf_Tied_Entry_s * enp = nodep;
@@ -123,163 +151,6 @@ _dwarf_tied_destroy_free_node(void*nodep)
     return;
 }
 
-#ifndef TESTING
-
-/*  This presumes only we are reading the debug_info
-    CUs from tieddbg. That is a reasonable
-    requirement, one hopes.
-    Currently it reads all the tied CUs at once, unless
-    there is an error..
-    */
-static int
-_dwarf_loop_reading_debug_info_for_cu(
-    Dwarf_Debug tieddbg,
-    Dwarf_Sig8 sig,
-    Dwarf_Error *error)
-{
-    unsigned loop_count = 0;
-    /*  We will not find tied signatures
-        for .debug_addr (or line tables) in .debug_types.
-        it seems. Those signatures point from
-        'normal' to 'dwo/dwp'  */
-    int is_info = TRUE;
-    Dwarf_CU_Context startingcontext = 0;
-    Dwarf_Unsigned next_cu_offset = 0;
-
-    startingcontext = tieddbg->de_info_reading.de_cu_context;
-
-    if (startingcontext) {
-        next_cu_offset =
-            startingcontext->cc_debug_offset +
-            startingcontext->cc_length +
-            startingcontext->cc_length_size +
-            startingcontext->cc_extension_size;
-    }
-
-    for (;;++loop_count) {
-        int sres = DW_DLV_OK;
-        Dwarf_Half cu_type = 0;
-        Dwarf_CU_Context latestcontext = 0;
-        Dwarf_Unsigned cu_header_length = 0;
-        Dwarf_Unsigned abbrev_offset = 0;
-        Dwarf_Half version_stamp = 0;
-        Dwarf_Half address_size = 0;
-        Dwarf_Half extension_size = 0;
-        Dwarf_Half length_size = 0;
-        Dwarf_Sig8 signature;
-        Dwarf_Bool has_signature = FALSE;
-        Dwarf_Unsigned typeoffset = 0;
-
-
-        memset(&signature,0,sizeof(signature));
-        sres = _dwarf_next_cu_header_internal(tieddbg,
-            is_info,
-            &cu_header_length, &version_stamp,
-            &abbrev_offset, &address_size,
-            &length_size,&extension_size,
-            &signature, &has_signature,
-            &typeoffset,
-            &next_cu_offset,
-            &cu_type, error);
-        if (sres == DW_DLV_NO_ENTRY) {
-            break;
-        }
-
-        latestcontext = tieddbg->de_info_reading.de_cu_context;
-
-        if (has_signature) {
-            void *retval = 0;
-            Dwarf_Sig8 consign =
-                latestcontext->cc_type_signature;
-            void *entry =
-                tied_make_entry(&consign,latestcontext);
-
-            if (!entry) {
-                return DW_DLV_NO_ENTRY;
-            }
-            /* Insert this signature and context. */
-            retval = dwarf_tsearch(entry,
-                &tieddbg->de_tied_data.td_tied_search,
-                tied_compare_function);
-            if (!retval) {
-                /* FAILED might be out of memory.*/
-                return DW_DLV_NO_ENTRY;
-            }
-#if 0 /* FIXME: do this? Not? */
-            /*  This could be a compiler error. But
-                let us not decide?  FIXME */
-            if (!latestcontext->cc_addr_base_present) {
-            }
-#endif
-            if (!tied_compare_function(&sig,&consign) ) {
-                /*  Identical. We found the matching CU. */
-                return DW_DLV_OK;
-            }
-        }
-    }
-    /*  Apparently we never found the sig we are looking for.
-        Pretend ok.  Caller will check for success. */
-    return DW_DLV_OK;
-}
-
-
-/* If out of memory just return DW_DLV_NO_ENTRY.
-*/
-int
-_dwarf_search_for_signature(Dwarf_Debug tieddbg,
-    Dwarf_Sig8 sig,
-    Dwarf_CU_Context *context_out,
-    Dwarf_Error *error)
-{
-
-    void *entry2 = 0;
-    struct Dwarf_Tied_Entry_s entry;
-    struct Dwarf_Tied_Data_s * tied = &tieddbg->de_tied_data;
-    int res = 0;
-
-    if (!tied->td_tied_search) {
-        dwarf_initialize_search_hash(&tied->td_tied_search,
-            tied_data_hashfunc,0);
-        if (!tied->td_tied_search) {
-            return DW_DLV_NO_ENTRY;
-        }
-    }
-    entry.dt_key = sig;
-    entry.dt_context = 0;
-    entry2 = dwarf_tfind(&entry,
-        &tied->td_tied_search,
-        tied_compare_function);
-    if (entry2) {
-        struct Dwarf_Tied_Entry_s *e2 =
-            *(struct Dwarf_Tied_Entry_s **)entry2;
-        *context_out = e2->dt_context;
-        return DW_DLV_OK;
-    }
-
-    /*  We assume the caller is NOT doing
-        info section read operations
-        on the tieddbg.  */
-    res  = _dwarf_loop_reading_debug_info_for_cu(
-        tieddbg,sig,error);
-    if (res == DW_DLV_ERROR) {
-        return res;
-    }
-
-    entry2 = dwarf_tfind(&entry,
-        &tied->td_tied_search,
-        tied_compare_function);
-    if (entry2) {
-        struct Dwarf_Tied_Entry_s *e2 =
-            *(struct Dwarf_Tied_Entry_s **)entry2;
-        *context_out = e2->dt_context;
-        return DW_DLV_OK;
-    }
-    return DW_DLV_NO_ENTRY;
-}
-#endif /* ndef TESTING */
-
-
-#ifdef TESTING
 
 struct test_data_s {
    const char action;
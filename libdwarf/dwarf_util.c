@@ -404,6 +404,193 @@ _dwarf_get_size_of_val(Dwarf_Debug dbg,
     }
 }
 
+/*  New October 2026.
+    Sets how the value size of aa->aa_form is found. */
+static void
+set_abbrev_attr_size_kind(struct Dwarf_Abbrev_Attr_s *aa)
+{
+    aa->aa_size_kind = DW_ABB_SIZE_FIXED;
+    aa->aa_fixed_size = 0;
+    switch (aa->aa_form) {
+    case DW_FORM_flag_present:
+        break;
+    case DW_FORM_data1:
+    case DW_FORM_ref1:
+    case DW_FORM_flag:
+        aa->aa_fixed_size = 1;
+        break;
+    case DW_FORM_data2:
+    case DW_FORM_ref2:
+        aa->aa_fixed_size = 2;
+        break;
+    case DW_FORM_data4:
+    case DW_FORM_ref4:
+        aa->aa_fixed_size = 4;
+        break;
+    case DW_FORM_data8:
+    case DW_FORM_ref8:
+    case DW_FORM_ref_sig8:
+        aa->aa_fixed_size = 8;
+        break;
+    case DW_FORM_addr:
+        aa->aa_size_kind = DW_ABB_SIZE_ADDRESS;
+        break;
+    case DW_FORM_strp:
+    case DW_FORM_sec_offset:
+    case DW_FORM_GNU_ref_alt:
+    case DW_FORM_GNU_strp_alt:
+    case DW_FORM_strp_sup:
+        aa->aa_size_kind = DW_ABB_SIZE_OFFSET;
+        break;
+    case DW_FORM_ref_addr:
+        aa->aa_size_kind = DW_ABB_SIZE_REF_ADDR;
+        break;
+    default:
+        aa->aa_size_kind = DW_ABB_SIZE_VARIABLE;
+        break;
+    }
+}
+
+/*  New October 2026.
+    Decodes the attribute/form pairs of abbrev into
+    abl_attrs.  The pairs were checked when the
+    abbreviation was first read.  */
+static int
+decode_abbrev_attrs(Dwarf_Debug dbg,
+    Dwarf_Abbrev_List abbrev,
+    Dwarf_Byte_Ptr end_abbrev_ptr,
+    Dwarf_Error *error)
+{
+    Dwarf_Byte_Ptr abbrev_ptr = abbrev->abl_abbrev_ptr;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Bool all_fixed = TRUE;
+
+    if (!abbrev->abl_count) {
+        abbrev->abl_all_fixed = TRUE;
+        return DW_DLV_OK;
+    }
+    abbrev->abl_attrs = (struct Dwarf_Abbrev_Attr_s *)
+        malloc(abbrev->abl_count*sizeof(struct Dwarf_Abbrev_Attr_s));
+    if (!abbrev->abl_attrs) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    for (i = 0; i < abbrev->abl_count; ++i) {
+        struct Dwarf_Abbrev_Attr_s *aa = abbrev->abl_attrs + i;
+        Dwarf_Unsigned utmp = 0;
+
+        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp,
+            dbg,error,end_abbrev_ptr);
+        aa->aa_attr = (Dwarf_Half)utmp;
+        DECODE_LEB128_UWORD_CK(abbrev_ptr, utmp,
+            dbg,error,end_abbrev_ptr);
+        aa->aa_form = (Dwarf_Half)utmp;
+        if (aa->aa_form == DW_FORM_indirect) {
+            abbrev->abl_has_indirect = TRUE;
+        }
+        if (aa->aa_attr == DW_AT_sibling) {
+            abbrev->abl_has_sibling = TRUE;
+        }
+        set_abbrev_attr_size_kind(aa);
+        switch (aa->aa_size_kind) {
+        case DW_ABB_SIZE_FIXED:
+            abbrev->abl_fixed_bytes += aa->aa_fixed_size;
+            break;
+        case DW_ABB_SIZE_ADDRESS:
+            abbrev->abl_address_count++;
+            break;
+        case DW_ABB_SIZE_OFFSET:
+            abbrev->abl_offset_count++;
+            break;
+        case DW_ABB_SIZE_REF_ADDR:
+            abbrev->abl_ref_addr_count++;
+            break;
+        default:
+            all_fixed = FALSE;
+            break;
+        }
+    }
+    abbrev->abl_all_fixed = all_fixed;
+    return DW_DLV_OK;
+}
+
+Dwarf_Bool
+_dwarf_abbrev_fixed_size(Dwarf_CU_Context cu_context,
+    Dwarf_Abbrev_List abbrev,
+    Dwarf_Unsigned *size_out)
+{
+    Dwarf_Unsigned ref_addr_size = 0;
+
+    if (!abbrev->abl_all_fixed) {
+        return FALSE;
+    }
+    if (abbrev->abl_address_count && !cu_context->cc_address_size) {
+        return FALSE;
+    }
+    ref_addr_size = (cu_context->cc_version_stamp == DW_CU_VERSION2)?
+        cu_context->cc_address_size: cu_context->cc_length_size;
+    *size_out = abbrev->abl_fixed_bytes +
+        abbrev->abl_address_count*cu_context->cc_address_size +
+        abbrev->abl_offset_count*cu_context->cc_length_size +
+        abbrev->abl_ref_addr_count*ref_addr_size;
+    return TRUE;
+}
+
+void
+_dwarf_abbrev_list_destructor(void *m)
+{
+    Dwarf_Abbrev_List abbrev = (Dwarf_Abbrev_List)m;
+
+    free(abbrev->abl_attrs);
+    abbrev->abl_attrs = 0;
+}
+
+int
+_dwarf_abbrev_attr_value_size(Dwarf_CU_Context cu_context,
+    struct Dwarf_Abbrev_Attr_s *aa,
+    Dwarf_Half form,
+    Dwarf_Small *val_ptr,
+    Dwarf_Small *section_end_ptr,
+    Dwarf_Unsigned *size_out,
+    Dwarf_Error *error)
+{
+    unsigned kind = aa->aa_size_kind;
+
+    if (form != aa->aa_form) {
+        /* DW_FORM_indirect. */
+        kind = DW_ABB_SIZE_VARIABLE;
+    }
+    switch (kind) {
+    case DW_ABB_SIZE_FIXED:
+        *size_out = aa->aa_fixed_size;
+        return DW_DLV_OK;
+    case DW_ABB_SIZE_ADDRESS:
+        if (cu_context->cc_address_size) {
+            *size_out = cu_context->cc_address_size;
+            return DW_DLV_OK;
+        }
+        break;
+    case DW_ABB_SIZE_OFFSET:
+        *size_out = cu_context->cc_length_size;
+        return DW_DLV_OK;
+    case DW_ABB_SIZE_REF_ADDR:
+        *size_out = (cu_context->cc_version_stamp == DW_CU_VERSION2)?
+            cu_context->cc_address_size: cu_context->cc_length_size;
+        return DW_DLV_OK;
+    default:
+        break;
+    }
+    return _dwarf_get_size_of_val(cu_context->cc_dbg,
+        form,
+        cu_context->cc_version_stamp,
+        cu_context->cc_address_size,
+        val_ptr,
+        cu_context->cc_length_size,
+        size_out,
+        section_end_ptr,
+        error);
+}
+
 /*  We allow an arbitrary number of HT_MULTIPLE entries
     before resizing.  It seems up to 20 or 30
     would work nearly as well.
@@ -468,71 +655,30 @@ _dwarf_valid_form_we_know(UNUSEDARG Dwarf_Debug dbg,
     return FALSE;
 }
 
-/*  This function returns a pointer to a Dwarf_Abbrev_List_s
-    struct for the abbrev with the given code.  It puts the
-    struct on the appropriate hash table.  It also adds all
-    the abbrev between the last abbrev added and this one to
-    the hash table.  In other words, the .debug_abbrev section
-    is scanned sequentially from the top for an abbrev with
-    the given code.  All intervening abbrevs are also put
-    into the hash table.
-
-    This function hashes the given code, and checks the chain
-    at that hash table entry to see if a Dwarf_Abbrev_List_s
-    with the given code exists.  If yes, it returns a pointer
-    to that struct.  Otherwise, it scans the .debug_abbrev
-    section from the last byte scanned for that CU till either
-    an abbrev with the given code is found, or an abbrev code
-    of 0 is read.  It puts Dwarf_Abbrev_List_s entries for all
-    abbrev's read till that point into the hash table.  The
-    hash table contains both a head pointer and a tail pointer
-    for each entry.
-
-    While the lists can move and entries can be moved between
-    lists on reallocation, any given Dwarf_Abbrev_list entry
-    never moves once allocated, so the pointer is safe to return.
-
-    See also dwarf_get_abbrev() in dwarf_abbrev.c.
-
-    Returns NULL on error.  */
-int
-_dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
-    Dwarf_Abbrev_List *list_out,
-    Dwarf_Error *error)
+/*  Puts entry in the hash table ht, making or
+    enlarging the table as needed. */
+static int
+abbrev_hash_insert(Dwarf_Debug dbg,
+    Dwarf_Hash_Table ht,
+    Dwarf_Abbrev_List entry)
 {
-    Dwarf_Debug dbg = cu_context->cc_dbg;
-    Dwarf_Hash_Table hash_table_base = cu_context->cc_abbrev_hash_table;
-    Dwarf_Hash_Table_Entry entry_base = 0;
-    Dwarf_Hash_Table_Entry entry_cur = 0;
-    Dwarf_Word hash_num = 0;
-    Dwarf_Unsigned abbrev_code = 0;
-    Dwarf_Unsigned abbrev_tag  = 0;
-    Dwarf_Unsigned attr_name = 0;
-    Dwarf_Unsigned attr_form = 0;
-    Dwarf_Abbrev_List hash_abbrev_entry = 0;
-    Dwarf_Abbrev_List inner_list_entry = 0;
-    Dwarf_Hash_Table_Entry inner_hash_entry = 0;
-
-    Dwarf_Byte_Ptr abbrev_ptr = 0;
-    Dwarf_Byte_Ptr end_abbrev_ptr = 0;
-    unsigned hashable_val = 0;
+    Dwarf_Hash_Table_Entry e = 0;
 
-    if (!hash_table_base->tb_entries) {
-        hash_table_base->tb_table_entry_count =  HT_MULTIPLE;
-        hash_table_base->tb_total_abbrev_count= 0;
-        hash_table_base->tb_entries =
+    if (!ht->tb_entries) {
+        ht->tb_table_entry_count =  HT_MULTIPLE;
+        ht->tb_total_abbrev_count= 0;
+        ht->tb_entries =
             (struct  Dwarf_Hash_Table_Entry_s *)_dwarf_get_alloc(dbg,
             DW_DLA_HASH_TABLE_ENTRY,
-            hash_table_base->tb_table_entry_count);
-        if (!hash_table_base->tb_entries) {
-            return DW_DLV_NO_ENTRY;
+            ht->tb_table_entry_count);
+        if (!ht->tb_entries) {
+            return DW_DLV_ERROR;
         }
-
-    } else if (hash_table_base->tb_total_abbrev_count >
-        ( hash_table_base->tb_table_entry_count * HT_MULTIPLE) ) {
+    } else if (ht->tb_total_abbrev_count >
+        ( ht->tb_table_entry_count * HT_MULTIPLE) ) {
         struct Dwarf_Hash_Table_s newht;
         /* Effectively multiplies by >= HT_MULTIPLE */
-        newht.tb_table_entry_count =  hash_table_base->tb_total_abbrev_count;
+        newht.tb_table_entry_count =  ht->tb_total_abbrev_count;
         newht.tb_total_abbrev_count = 0;
         newht.tb_entries =
             (struct  Dwarf_Hash_Table_Entry_s *)_dwarf_get_alloc(dbg,
@@ -540,60 +686,331 @@ _dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
             newht.tb_table_entry_count);
 
         if (!newht.tb_entries) {
-            return DW_DLV_NO_ENTRY;
+            return DW_DLV_ERROR;
         }
         /*  Copy the existing entries to the new table,
             rehashing each.  */
-        copy_abbrev_table_to_new_table(hash_table_base, &newht);
+        copy_abbrev_table_to_new_table(ht, &newht);
         /*  Dealloc only the entries hash table array, not the lists
             of things pointed to by a hash table entry array. */
-        dwarf_dealloc(dbg, hash_table_base->tb_entries,DW_DLA_HASH_TABLE_ENTRY);
-        hash_table_base->tb_entries = 0;
+        dwarf_dealloc(dbg, ht->tb_entries,DW_DLA_HASH_TABLE_ENTRY);
+        ht->tb_entries = 0;
         /*  Now overwrite the existing table descriptor with
             the new, newly valid, contents. */
-        *hash_table_base = newht;
+        *ht = newht;
     } /* Else is ok as is, add entry */
+    e = ht->tb_entries + (entry->abl_code % ht->tb_table_entry_count);
+    entry->abl_next = e->at_head;
+    e->at_head = entry;
+    ht->tb_total_abbrev_count++;
+    return DW_DLV_OK;
+}
 
-    hashable_val = code;
-    hash_num = hashable_val %
-        hash_table_base->tb_table_entry_count;
-    entry_base = hash_table_base->tb_entries;
-    entry_cur  = entry_base + hash_num;
-
-    /* Determine if the 'code' is the list of synonyms already. */
-    for (hash_abbrev_entry = entry_cur->at_head;
-        hash_abbrev_entry != NULL && hash_abbrev_entry->abl_code != code;
-        hash_abbrev_entry = hash_abbrev_entry->abl_next);
-    if (hash_abbrev_entry != NULL) {
-        /*  This returns a pointer to an abbrev list entry, not
-            the list itself. */
-        *list_out = hash_abbrev_entry;
+static Dwarf_Abbrev_List
+abbrev_hash_find(Dwarf_Hash_Table ht, Dwarf_Unsigned code)
+{
+    Dwarf_Abbrev_List entry = 0;
+
+    if (!ht->tb_entries) {
+        return 0;
+    }
+    entry = ht->tb_entries[code % ht->tb_table_entry_count].at_head;
+    for (; entry && entry->abl_code != code; entry = entry->abl_next) {
+    }
+    return entry;
+}
+
+/*  The smallest ab_dense allocation. */
+#define ABBREV_DENSE_MIN 64
+
+/*  Puts entry in ab_dense if its code is compact,
+    that is, not much larger than the number of
+    abbreviations, else in ab_hash.  */
+static int
+abbrev_table_insert(Dwarf_Debug dbg,
+    struct Dwarf_Abbrev_Table_s *tab,
+    Dwarf_Abbrev_List entry)
+{
+    Dwarf_Unsigned code = entry->abl_code;
+
+    tab->ab_abbrev_count++;
+    if (code >= tab->ab_dense_count &&
+        code < 2*tab->ab_abbrev_count + ABBREV_DENSE_MIN) {
+        Dwarf_Unsigned newcount = tab->ab_dense_count?
+            tab->ab_dense_count*2: ABBREV_DENSE_MIN;
+        Dwarf_Abbrev_List *newdense = 0;
+
+        if (newcount <= code) {
+            newcount = code+1;
+        }
+        newdense = (Dwarf_Abbrev_List *)realloc(tab->ab_dense,
+            newcount*sizeof(Dwarf_Abbrev_List));
+        if (!newdense) {
+            return DW_DLV_ERROR;
+        }
+        memset(newdense+tab->ab_dense_count,0,
+            (newcount - tab->ab_dense_count)*sizeof(Dwarf_Abbrev_List));
+        tab->ab_dense = newdense;
+        tab->ab_dense_count = newcount;
+    }
+    if (code < tab->ab_dense_count && !tab->ab_dense[code]) {
+        tab->ab_dense[code] = entry;
         return DW_DLV_OK;
     }
+    /*  A large code, or (in a corrupt table) a code
+        seen before: the first one stays in ab_dense
+        and is the one found. */
+    return abbrev_hash_insert(dbg,&tab->ab_hash,entry);
+}
+
+static Dwarf_Abbrev_List
+abbrev_table_find(struct Dwarf_Abbrev_Table_s *tab,
+    Dwarf_Unsigned code)
+{
+    if (code < tab->ab_dense_count && tab->ab_dense[code]) {
+        return tab->ab_dense[code];
+    }
+    return abbrev_hash_find(&tab->ab_hash,code);
+}
+
+/*  Returns the at_tables index + 1 of the table
+    for offset and endptr, or 0.
+    The slot where it is or would go is
+    returned through slot_out. */
+static Dwarf_Unsigned
+abbrev_tables_probe(struct Dwarf_Abbrev_Tables_s *tabs,
+    Dwarf_Unsigned offset,
+    Dwarf_Byte_Ptr endptr,
+    Dwarf_Unsigned *slot_out)
+{
+    Dwarf_Unsigned mask = tabs->at_slot_count - 1;
+    Dwarf_Unsigned s = (offset * 0x9e3779b1) & mask;
+
+    for (;; s = (s+1) & mask) {
+        Dwarf_Unsigned e = tabs->at_slots[s];
+
+        if (!e || (tabs->at_tables[e-1]->ab_offset == offset &&
+            tabs->at_tables[e-1]->ab_end_ptr == endptr)) {
+            *slot_out = s;
+            return e;
+        }
+    }
+}
 
-    if (cu_context->cc_last_abbrev_ptr) {
-        abbrev_ptr = cu_context->cc_last_abbrev_ptr;
-        end_abbrev_ptr = cu_context->cc_last_abbrev_endptr;
+/*  Doubles the slot array and rehashes the tables. */
+static int
+abbrev_tables_grow_slots(struct Dwarf_Abbrev_Tables_s *tabs)
+{
+    Dwarf_Unsigned newcount = tabs->at_slot_count?
+        tabs->at_slot_count*2:16;
+    Dwarf_Unsigned i = 0;
+
+    free(tabs->at_slots);
+    tabs->at_slot_count = 0;
+    tabs->at_slots = (Dwarf_Unsigned *)calloc(newcount,
+        sizeof(Dwarf_Unsigned));
+    if (!tabs->at_slots) {
+        return DW_DLV_ERROR;
+    }
+    tabs->at_slot_count = newcount;
+    for (i = 0; i < tabs->at_count; ++i) {
+        Dwarf_Unsigned s = 0;
+
+        abbrev_tables_probe(tabs,tabs->at_tables[i]->ab_offset,
+            tabs->at_tables[i]->ab_end_ptr,&s);
+        tabs->at_slots[s] = i+1;
+    }
+    return DW_DLV_OK;
+}
+
+/*  New October 2026.
+    Finds, or makes (empty, to be filled as
+    _dwarf_get_abbrev_for_code() needs), the abbreviation
+    table for cu_context.  cc_abbrev_offset and (for a DWP)
+    cc_dwp_offsets must be set.  */
+int
+_dwarf_get_abbrev_table(Dwarf_CU_Context cu_context,
+    struct Dwarf_Abbrev_Table_s **table_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = cu_context->cc_dbg;
+    struct Dwarf_Abbrev_Tables_s *tabs = dbg->de_abbrev_tables;
+    struct Dwarf_Abbrev_Table_s *tab = 0;
+    Dwarf_Unsigned offset = cu_context->cc_abbrev_offset;
+    Dwarf_Byte_Ptr endptr = 0;
+    Dwarf_Unsigned s = 0;
+    Dwarf_Unsigned e = 0;
+
+    if (cu_context->cc_dwp_offsets.pcu_type)  {
+        /*  In a DWP the abbrevs
+            for this context are known quite precisely. */
+        Dwarf_Unsigned size = 0;
+        /* Ignore the offset returned. Already in cc_abbrev_offset. */
+        _dwarf_get_dwp_extra_offset(&cu_context->cc_dwp_offsets,
+            DW_SECT_ABBREV,&size);
+        /*  ASSERT: size != 0 */
+        endptr = dbg->de_debug_abbrev.dss_data + offset + size;
     } else {
-        /*  This is ok because cc_abbrev_offset includes DWP
-            offset if appropriate. */
-        abbrev_ptr = dbg->de_debug_abbrev.dss_data +
-            cu_context->cc_abbrev_offset;
-
-        if (cu_context->cc_dwp_offsets.pcu_type)  {
-            /*  In a DWP the abbrevs
-                for this context are known quite precisely. */
-            Dwarf_Unsigned size = 0;
-            /* Ignore the offset returned. Already in cc_abbrev_offset. */
-            _dwarf_get_dwp_extra_offset(&cu_context->cc_dwp_offsets,
-                DW_SECT_ABBREV,&size);
-            /*  ASSERT: size != 0 */
-            end_abbrev_ptr = abbrev_ptr + size;
-        } else {
-            end_abbrev_ptr = dbg->de_debug_abbrev.dss_data +
-                dbg->de_debug_abbrev.dss_size;
+        endptr = dbg->de_debug_abbrev.dss_data +
+            dbg->de_debug_abbrev.dss_size;
+    }
+    if (!tabs) {
+        tabs = (struct Dwarf_Abbrev_Tables_s *)calloc(1,
+            sizeof(struct Dwarf_Abbrev_Tables_s));
+        if (!tabs) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        dbg->de_abbrev_tables = tabs;
+    }
+    /*  Keep the load factor at most 3/4. */
+    if ((tabs->at_count+1)*4 > tabs->at_slot_count*3) {
+        if (abbrev_tables_grow_slots(tabs) != DW_DLV_OK) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+    }
+    e = abbrev_tables_probe(tabs,offset,endptr,&s);
+    if (e) {
+        *table_out = tabs->at_tables[e-1];
+        return DW_DLV_OK;
+    }
+    if (tabs->at_count == tabs->at_size) {
+        Dwarf_Unsigned newsize = tabs->at_size?  tabs->at_size*2: 16;
+        struct Dwarf_Abbrev_Table_s **newtables =
+            (struct Dwarf_Abbrev_Table_s **)realloc(tabs->at_tables,
+            newsize*sizeof(struct Dwarf_Abbrev_Table_s *));
+
+        if (!newtables) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        tabs->at_tables = newtables;
+        tabs->at_size = newsize;
+    }
+    tab = (struct Dwarf_Abbrev_Table_s *)calloc(1,
+        sizeof(struct Dwarf_Abbrev_Table_s));
+    if (!tab) {
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    tab->ab_offset = offset;
+    tab->ab_end_ptr = endptr;
+    tab->ab_next_ptr = dbg->de_debug_abbrev.dss_data + offset;
+    tabs->at_tables[tabs->at_count] = tab;
+    tabs->at_count++;
+    tabs->at_slots[s] = tabs->at_count;
+    *table_out = tab;
+    return DW_DLV_OK;
+}
+
+static void
+free_abbrev_hash_table_contents(Dwarf_Debug dbg,Dwarf_Hash_Table hash_table)
+{
+    /*  A Hash Table is an array with tb_table_entry_count struct
+        Dwarf_Hash_Table_s entries in the array. */
+    unsigned hashnum = 0;
+    for (; hashnum < hash_table->tb_table_entry_count; ++hashnum) {
+        struct Dwarf_Abbrev_List_s *abbrev = 0;
+        struct Dwarf_Abbrev_List_s *nextabbrev = 0;
+        struct  Dwarf_Hash_Table_Entry_s *tb =  &hash_table->tb_entries[hashnum];
+
+        abbrev = tb->at_head;
+        for (; abbrev; abbrev = nextabbrev) {
+            nextabbrev = abbrev->abl_next;
+            abbrev->abl_next = 0;
+            dwarf_dealloc(dbg, abbrev, DW_DLA_ABBREV_LIST);
         }
+        tb->at_head = 0;
+    }
+    /* Frees all the entries at once: an array. */
+    dwarf_dealloc(dbg,hash_table->tb_entries,DW_DLA_HASH_TABLE_ENTRY);
+    hash_table->tb_entries = 0;
+}
+
+/*  Frees all the abbreviation tables and the
+    abbreviations in them.  Called by dwarf_finish(). */
+void
+_dwarf_abbrev_tables_destroy(Dwarf_Debug dbg)
+{
+    struct Dwarf_Abbrev_Tables_s *tabs = dbg->de_abbrev_tables;
+    Dwarf_Unsigned i = 0;
+
+    if (!tabs) {
+        return;
+    }
+    for (i = 0; i < tabs->at_count; ++i) {
+        struct Dwarf_Abbrev_Table_s *tab = tabs->at_tables[i];
+        Dwarf_Unsigned k = 0;
+
+        for (k = 0; k < tab->ab_dense_count; ++k) {
+            if (tab->ab_dense[k]) {
+                dwarf_dealloc(dbg, tab->ab_dense[k], DW_DLA_ABBREV_LIST);
+            }
+        }
+        free(tab->ab_dense);
+        if (tab->ab_hash.tb_entries) {
+            free_abbrev_hash_table_contents(dbg,&tab->ab_hash);
+        }
+        free(tab);
+    }
+    free(tabs->at_tables);
+    free(tabs->at_slots);
+    free(tabs);
+    dbg->de_abbrev_tables = 0;
+}
+
+/*  This function returns a pointer to a Dwarf_Abbrev_List_s
+    struct for the abbrev with the given code.
+    The abbreviations are in the abbreviation table
+    of the CU, shared by all the CUs with the same
+    .debug_abbrev offset.  It also adds all
+    the abbrev between the last abbrev added and this one to
+    the table.  In other words, the .debug_abbrev section
+    is scanned sequentially from the top for an abbrev with
+    the given code.  All intervening abbrevs are also put
+    into the table.
+
+    If the code is not yet in the table it scans the
+    .debug_abbrev section from the last byte scanned for that
+    table till either an abbrev with the given code is found,
+    or an abbrev code of 0 is read.
+
+    Any given Dwarf_Abbrev_list entry
+    never moves once allocated, so the pointer is safe to return.
+
+    See also dwarf_get_abbrev() in dwarf_abbrev.c.
+
+    Returns NULL on error.  */
+int
+_dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
+    Dwarf_Abbrev_List *list_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = cu_context->cc_dbg;
+    struct Dwarf_Abbrev_Table_s *tab = cu_context->cc_abbrev_table;
+    Dwarf_Unsigned abbrev_code = 0;
+    Dwarf_Unsigned abbrev_tag  = 0;
+    Dwarf_Unsigned attr_name = 0;
+    Dwarf_Unsigned attr_form = 0;
+    Dwarf_Abbrev_List found_entry = 0;
+    Dwarf_Abbrev_List inner_list_entry = 0;
+
+    Dwarf_Byte_Ptr abbrev_ptr = 0;
+    Dwarf_Byte_Ptr end_abbrev_ptr = 0;
+
+    found_entry = abbrev_table_find(tab,code);
+    if (found_entry) {
+        /*  This returns a pointer to an abbrev list entry, not
+            the list itself. */
+        *list_out = found_entry;
+        return DW_DLV_OK;
+    }
+    if (tab->ab_done) {
+        return DW_DLV_NO_ENTRY;
     }
+    abbrev_ptr = tab->ab_next_ptr;
+    end_abbrev_ptr = tab->ab_end_ptr;
 
     /*  End of abbrev's as we are past the end entirely.
         This can happen,though it seems wrong.
@@ -604,17 +1021,19 @@ _dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
         of data block.  But we are allowing what is possibly a bit
         more flexible end policy here. */
     if (abbrev_ptr >= end_abbrev_ptr) {
+        tab->ab_done = TRUE;
         return DW_DLV_NO_ENTRY;
     }
     /*  End of abbrev's for this cu, since abbrev code is 0. */
     if (*abbrev_ptr == 0) {
+        tab->ab_done = TRUE;
         return DW_DLV_NO_ENTRY;
     }
 
     do {
-        unsigned new_hashable_val = 0;
         Dwarf_Off  abb_goff = 0;
         Dwarf_Unsigned atcount = 0;
+        int ires = 0;
 
         abb_goff = abbrev_ptr - dbg->de_debug_abbrev.dss_data;
         DECODE_LEB128_UWORD_CK(abbrev_ptr, abbrev_code,
@@ -633,25 +1052,12 @@ _dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
             _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
             return DW_DLV_ERROR;
         }
-
-        new_hashable_val = abbrev_code;
-        hash_num = new_hashable_val %
-            hash_table_base->tb_table_entry_count;
-        inner_hash_entry = entry_base + hash_num;
-        /* Move_entry_to_new_hash */
-        inner_list_entry->abl_next = inner_hash_entry->at_head;
-        inner_hash_entry->at_head = inner_list_entry;
-
-        hash_table_base->tb_total_abbrev_count++;
-
         inner_list_entry->abl_code = abbrev_code;
         inner_list_entry->abl_tag = abbrev_tag;
         inner_list_entry->abl_has_child = *(abbrev_ptr++);
         inner_list_entry->abl_abbrev_ptr = abbrev_ptr;
         inner_list_entry->abl_goffset =  abb_goff;
 
-        hash_table_base->tb_total_abbrev_count++;
-
         /*  Cycle thru the abbrev content, ignoring the content except
             to find the end of the content. */
         do {
@@ -668,6 +1074,25 @@ _dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
         /*  We counted one too high, by counting the NUL
             byte pair at end of list. So decrement. */
         inner_list_entry->abl_count = atcount-1;
+        {
+            int dres = decode_abbrev_attrs(dbg,inner_list_entry,
+                end_abbrev_ptr,error);
+
+            if (dres != DW_DLV_OK) {
+                return dres;
+            }
+        }
+        /*  Only a complete entry goes in the table, and
+            only then is the parse position moved past it.
+            An entry abandoned on error above is freed
+            by dwarf_finish(). */
+        ires = abbrev_table_insert(dbg,tab,inner_list_entry);
+        if (ires != DW_DLV_OK) {
+            dwarf_dealloc(dbg,inner_list_entry,DW_DLA_ABBREV_LIST);
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        tab->ab_next_ptr = abbrev_ptr;
 
         /*  The abbreviations table ends with an entry with a single
             byte of zero for the abbreviation code.
@@ -681,8 +1106,9 @@ _dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context, Dwarf_Unsigned code,
     } while ((abbrev_ptr < end_abbrev_ptr) &&
         *abbrev_ptr != 0 && abbrev_code != code);
 
-    cu_context->cc_last_abbrev_ptr = abbrev_ptr;
-    cu_context->cc_last_abbrev_endptr = end_abbrev_ptr;
+    if ((abbrev_ptr >= end_abbrev_ptr) || *abbrev_ptr == 0) {
+        tab->ab_done = TRUE;
+    }
     if(abbrev_code == code) {
         *list_out = inner_list_entry;
         return DW_DLV_OK;
@@ -910,29 +1336,6 @@ _dwarf_load_debug_types(Dwarf_Debug dbg, Dwarf_Error * error)
     res = _dwarf_load_section(dbg, &dbg->de_debug_types, error);
     return res;
 }
-void
-_dwarf_free_abbrev_hash_table_contents(Dwarf_Debug dbg,Dwarf_Hash_Table hash_table)
-{
-    /*  A Hash Table is an array with tb_table_entry_count struct
-        Dwarf_Hash_Table_s entries in the array. */
-    unsigned hashnum = 0;
-    for (; hashnum < hash_table->tb_table_entry_count; ++hashnum) {
-        struct Dwarf_Abbrev_List_s *abbrev = 0;
-        struct Dwarf_Abbrev_List_s *nextabbrev = 0;
-        struct  Dwarf_Hash_Table_Entry_s *tb =  &hash_table->tb_entries[hashnum];
-
-        abbrev = tb->at_head;
-        for (; abbrev; abbrev = nextabbrev) {
-            nextabbrev = abbrev->abl_next;
-            abbrev->abl_next = 0;
-            dwarf_dealloc(dbg, abbrev, DW_DLA_ABBREV_LIST);
-        }
-        tb->at_head = 0;
-    }
-    /* Frees all the entries at once: an array. */
-    dwarf_dealloc(dbg,hash_table->tb_entries,DW_DLA_HASH_TABLE_ENTRY);
-    hash_table->tb_entries = 0;
-}
 
 /*
     If no die provided the size value returned might be wrong.
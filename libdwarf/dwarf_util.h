@@ -44,6 +44,13 @@
         Dwarf_Word lu_leblen = 0;                     \
         Dwarf_Unsigned lu_local = 0;                  \
         int lu_res = 0;                               \
+        if ((ptr) < (endptr) && !(*(ptr) & 0x80)) {   \
+            /* One byte: most abbreviation codes,     \
+               attribute numbers and forms. */        \
+            value = *(ptr);                           \
+            ptr++;                                    \
+            break;                                    \
+        }                                             \
         lu_res = _dwarf_decode_u_leb128_chk(ptr,&lu_leblen,&lu_local,endptr); \
         if (lu_res == DW_DLV_ERROR) {                 \
             _dwarf_error(dbg, errptr, DW_DLE_LEB_IMPROPER);  \
@@ -81,6 +88,16 @@
         Dwarf_Word uleblen = 0;                       \
         Dwarf_Signed local = 0;                       \
         int lu_res = 0;                               \
+        if ((ptr) < (endptr) && !(*(ptr) & 0x80)) {   \
+            /* One byte: most line advances. */       \
+            local = (Dwarf_Small)*(ptr);              \
+            if (local & 0x40) {                       \
+                local -= 0x80;                        \
+            }                                         \
+            value = local;                            \
+            ptr++;                                    \
+            break;                                    \
+        }                                             \
         lu_res = _dwarf_decode_s_leb128_chk(ptr,&uleblen,&local,endptr); \
         if (lu_res == DW_DLV_ERROR) {                 \
             _dwarf_error(dbg, errptr, DW_DLE_LEB_IMPROPER);  \
@@ -179,11 +196,39 @@
 */
 typedef Dwarf_Unsigned BIGGEST_UINT;
 
+/*  New October 2026.
+    Copies length bytes from source to dest for an object
+    in the host byte order (de_same_endian).  The usual
+    lengths get a memcpy() of constant size, which the
+    compiler turns into a single load, rather than a call
+    through de_copy_word with a variable length.
+    Where length is a constant only one case remains. */
+#define _DWARF_COPY_NATIVE(dest, source, length)   \
+    do {                                           \
+        switch (length) {                          \
+        case 1: memcpy(dest, source, 1); break;    \
+        case 2: memcpy(dest, source, 2); break;    \
+        case 4: memcpy(dest, source, 4); break;    \
+        case 8: memcpy(dest, source, 8); break;    \
+        default: memcpy(dest, source, length); break; \
+        }                                          \
+    } while (0)
+
+#define _DWARF_COPY_WORD(dbg, dest, source, length)   \
+    do {                                              \
+        if ((dbg)->de_same_endian) {                  \
+            _DWARF_COPY_NATIVE(dest, source, length); \
+        } else {                                      \
+            (dbg)->de_copy_word(dest, source, length);\
+        }                                             \
+    } while (0)
+
 #ifdef WORDS_BIGENDIAN
 #define READ_UNALIGNED(dbg,dest,desttype, source, length)                 \
     do {                                                                  \
         BIGGEST_UINT _ltmp = 0;                                           \
-        dbg->de_copy_word( (((char *)(&_ltmp)) + sizeof(_ltmp) - length), \
+        _DWARF_COPY_WORD(dbg,                                             \
+            (((char *)(&_ltmp)) + sizeof(_ltmp) - length),                \
             source, length) ;                                             \
         dest = (desttype)_ltmp;                                           \
     } while (0)
@@ -200,7 +245,8 @@ typedef Dwarf_Unsigned BIGGEST_UINT;
             _dwarf_error(dbg, error, DW_DLE_READ_LITTLEENDIAN_ERROR);     \
             return DW_DLV_ERROR;                                          \
         }                                                                 \
-        dbg->de_copy_word( (((char *)(&_ltmp)) + sizeof(_ltmp) - length), \
+        _DWARF_COPY_WORD(dbg,                                             \
+            (((char *)(&_ltmp)) + sizeof(_ltmp) - length),                \
             source, length) ;                                             \
         dest = (desttype)_ltmp;                                           \
     } while (0)
@@ -226,7 +272,7 @@ typedef Dwarf_Unsigned BIGGEST_UINT;
 #define READ_UNALIGNED(dbg,dest,desttype, source, length) \
     do  {                                                 \
         BIGGEST_UINT _ltmp = 0;                           \
-        dbg->de_copy_word( (char *)(&_ltmp) ,             \
+        _DWARF_COPY_WORD(dbg, (char *)(&_ltmp) ,          \
             source, length) ;                             \
         dest = (desttype)_ltmp;                           \
     } while (0)
@@ -240,7 +286,7 @@ typedef Dwarf_Unsigned BIGGEST_UINT;
             _dwarf_error(dbg, error, DW_DLE_READ_LITTLEENDIAN_ERROR);\
             return DW_DLV_ERROR;                          \
         }                                                 \
-        dbg->de_copy_word( (char *)(&_ltmp) ,             \
+        _DWARF_COPY_WORD(dbg, (char *)(&_ltmp) ,          \
             source, length) ;                             \
         dest = (desttype)_ltmp;                           \
     } while (0)
@@ -427,6 +473,59 @@ struct Dwarf_Hash_Table_Entry_s {
     Dwarf_Abbrev_List at_head;
 };
 
+/*  New October 2026.
+    The abbreviations of one abbreviation table, that is,
+    the abbreviations starting at one .debug_abbrev offset.
+    One is made per offset and shared, read-only once
+    parsed, by all the CUs whose headers name that offset
+    (in LTO or dwz-processed objects thousands of CUs may).
+    The table is parsed lazily: ab_next_ptr is where
+    parsing will resume.
+    Abbreviation codes are normally 1,2,3... so
+    an abbreviation is kept in ab_dense, indexed by its
+    code, unless its code is too large for that to be
+    compact, in which case it goes in ab_hash.  */
+struct Dwarf_Abbrev_Table_s {
+    /*  Section offset (including any DWP offset)
+        and the end of the data the table may occupy.
+        Together these are the key. */
+    Dwarf_Unsigned  ab_offset;
+    Dwarf_Byte_Ptr  ab_end_ptr;
+
+    Dwarf_Byte_Ptr  ab_next_ptr;
+    Dwarf_Bool      ab_done;
+    Dwarf_Unsigned  ab_abbrev_count;
+
+    /*  malloc()ed, ab_dense_count entries, zero
+        where no abbreviation has that code. */
+    Dwarf_Abbrev_List *ab_dense;
+    Dwarf_Unsigned  ab_dense_count;
+
+    /*  tb_entries is 0 until some abbreviation
+        is put here. */
+    struct Dwarf_Hash_Table_s ab_hash;
+};
+
+/*  New October 2026.
+    All the abbreviation tables of a Dwarf_Debug, in
+    order of creation in at_tables, with at_slots an
+    open addressing hash table (size a power of two)
+    on the offset.  A slot is zero if empty, else one more
+    than the at_tables index.  */
+struct Dwarf_Abbrev_Tables_s {
+    struct Dwarf_Abbrev_Table_s **at_tables;
+    Dwarf_Unsigned  at_count;
+    Dwarf_Unsigned  at_size;
+
+    Dwarf_Unsigned *at_slots;
+    Dwarf_Unsigned  at_slot_count;
+};
+
+int _dwarf_get_abbrev_table(Dwarf_CU_Context cu_context,
+    struct Dwarf_Abbrev_Table_s **table_out,
+    Dwarf_Error *error);
+void _dwarf_abbrev_tables_destroy(Dwarf_Debug dbg);
+
 
 
 int _dwarf_get_abbrev_for_code(Dwarf_CU_Context cu_context,
@@ -450,8 +549,6 @@ Dwarf_Unsigned _dwarf_length_of_cu_header_simple(Dwarf_Debug,Dwarf_Bool dinfo);
 
 int  _dwarf_load_debug_info(Dwarf_Debug dbg, Dwarf_Error *error);
 int  _dwarf_load_debug_types(Dwarf_Debug dbg, Dwarf_Error *error);
-void _dwarf_free_abbrev_hash_table_contents(Dwarf_Debug dbg,
-    struct Dwarf_Hash_Table_s* hash_table);
 int _dwarf_get_address_size(Dwarf_Debug dbg, Dwarf_Die die);
 int _dwarf_reference_outside_section(Dwarf_Die die,
     Dwarf_Small * startaddr,
@@ -412,8 +412,177 @@ _dwarf_search_fission_for_key(UNUSEDARG Dwarf_Debug dbg,
     return DW_DLV_NO_ENTRY;
 }
 
-/* Slow. Consider tsearch. */
-/* For type units and for CUs. */
+/*  Returns the column (0 to L-1) of the section
+    numbered dfp_sect_num (DW_SECT_INFO etc). */
+static int
+_dwarf_xu_column_for_sect(Dwarf_Xu_Index_Header xuhdr,
+    Dwarf_Unsigned dfp_sect_num,
+    Dwarf_Unsigned *column_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned i = 0;
+
+    for ( i = 0; i< xuhdr->gx_column_count_sections; i++) {
+        const char *name = 0;
+        Dwarf_Unsigned num = 0;
+        int res = dwarf_get_xu_section_names(xuhdr,i,&num,&name,error);
+
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_OK && num == dfp_sect_num) {
+            *column_out = i;
+            return DW_DLV_OK;
+        }
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
+static int
+xu_offset_entry_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Xu_Offset_Entry_s *lp = l;
+    const struct Dwarf_Xu_Offset_Entry_s *rp = r;
+
+    if (lp->xo_offset < rp->xo_offset) {
+        return -1;
+    }
+    if (lp->xo_offset > rp->xo_offset) {
+        return 1;
+    }
+    /*  Equal offsets should not happen. If they do
+        the lowest slot is the one a scan of the hash
+        table would find first. */
+    if (lp->xo_slot < rp->xo_slot) {
+        return -1;
+    }
+    if (lp->xo_slot > rp->xo_slot) {
+        return 1;
+    }
+    return 0;
+}
+
+/*  Builds gx_offset_index: one pass over the hash table
+    and a sort, instead of a pass over the hash table for
+    every offset looked up.  */
+static int
+_dwarf_build_xu_offset_index(Dwarf_Xu_Index_Header xuhdr,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = xuhdr->gx_dbg;
+    struct Dwarf_Xu_Offset_Entry_s *entries = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned column = 0;
+    Dwarf_Unsigned sect = DW_SECT_INFO;
+    Dwarf_Unsigned m = 0;
+    int res = 0;
+
+    res = _dwarf_xu_column_for_sect(xuhdr,DW_SECT_INFO,&column,error);
+    if (res == DW_DLV_NO_ENTRY) {
+        sect = DW_SECT_TYPES;
+        res = _dwarf_xu_column_for_sect(xuhdr,DW_SECT_TYPES,
+            &column,error);
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        sect = 0;
+    }
+    if (xuhdr->gx_slots_in_hash) {
+        entries = (struct Dwarf_Xu_Offset_Entry_s *)
+            malloc(xuhdr->gx_slots_in_hash *
+            sizeof(struct Dwarf_Xu_Offset_Entry_s));
+        if (!entries) {
+            _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+    }
+    for ( m = 0; m < xuhdr->gx_slots_in_hash; ++m) {
+        Dwarf_Sig8 hash;
+        Dwarf_Unsigned indexn = 0;
+        Dwarf_Unsigned sec_offset = 0;
+        Dwarf_Unsigned sec_size = 0;
+
+        res = dwarf_get_xu_hash_entry(xuhdr,m,&hash,&indexn,error);
+        if (res != DW_DLV_OK) {
+            free(entries);
+            return res;
+        }
+        if (indexn == 0 &&
+            !memcmp(&hash,&zerohashkey,sizeof(Dwarf_Sig8))) {
+            /* Empty slot. */
+            continue;
+        }
+        if (sect) {
+            res = dwarf_get_xu_section_offset(xuhdr,
+                indexn,column,&sec_offset,&sec_size,error);
+            if (res != DW_DLV_OK) {
+                free(entries);
+                return res;
+            }
+        }
+        entries[count].xo_offset = sec_offset;
+        entries[count].xo_percu_index = indexn;
+        entries[count].xo_slot = m;
+        entries[count].xo_hash = hash;
+        count++;
+    }
+    if (count > 1) {
+        qsort(entries,count,sizeof(struct Dwarf_Xu_Offset_Entry_s),
+            xu_offset_entry_compare);
+    }
+    xuhdr->gx_offset_index = entries;
+    xuhdr->gx_offset_index_count = count;
+    xuhdr->gx_offset_index_sect = sect;
+    xuhdr->gx_offset_index_built = TRUE;
+    return DW_DLV_OK;
+}
+
+void
+_dwarf_xu_index_destructor(void *m)
+{
+    Dwarf_Xu_Index_Header xuhdr = (Dwarf_Xu_Index_Header)m;
+
+    free(xuhdr->gx_offset_index);
+    xuhdr->gx_offset_index = 0;
+    xuhdr->gx_offset_index_count = 0;
+    xuhdr->gx_offset_index_built = FALSE;
+}
+
+/*  Binary search of gx_offset_index. */
+static int
+_dwarf_search_xu_offset_index(Dwarf_Xu_Index_Header xuhdr,
+    Dwarf_Unsigned offset,
+    Dwarf_Unsigned * percu_index_out,
+    Dwarf_Sig8 * key_out)
+{
+    struct Dwarf_Xu_Offset_Entry_s *entries = xuhdr->gx_offset_index;
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = xuhdr->gx_offset_index_count;
+
+    /*  Find the first entry with xo_offset >= offset. */
+    while (low < high) {
+        Dwarf_Unsigned mid = low + (high - low)/2;
+
+        if (entries[mid].xo_offset < offset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low >= xuhdr->gx_offset_index_count ||
+        entries[low].xo_offset != offset) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *percu_index_out = entries[low].xo_percu_index;
+    *key_out = entries[low].xo_hash;
+    return DW_DLV_OK;
+}
+
+/*  For type units and for CUs.
+    Uses the sorted offset index when there is one
+    for dfp_sect_num, else scans the hash table.  */
 static int
 _dwarf_search_fission_for_offset(Dwarf_Debug dbg,
     Dwarf_Xu_Index_Header xuhdr,
@@ -428,6 +597,12 @@ _dwarf_search_fission_for_offset(Dwarf_Debug dbg,
     int secnum_index = -1;  /* L index */
     int res = 0;
 
+    if (xuhdr->gx_offset_index_built &&
+        xuhdr->gx_offset_index_sect &&
+        xuhdr->gx_offset_index_sect == dfp_sect_num) {
+        return _dwarf_search_xu_offset_index(xuhdr,offset,
+            percu_index_out,key_out);
+    }
     for ( i = 0; i< xuhdr->gx_column_count_sections; i++) {
         /*  We could put the secnums array into xuhdr
             if looping here is too slow. */
@@ -497,8 +672,19 @@ _dwarf_get_xuhdr(Dwarf_Debug dbg,
         _dwarf_error(dbg,error,DW_DLE_SIG_TYPE_WRONG_STRING);
         return DW_DLV_ERROR;
     }
-    return DW_DLV_OK;
+    if (!(*xuout)->gx_offset_index_built) {
+        Dwarf_Error ierr = 0;
+        int res = _dwarf_build_xu_offset_index(*xuout,&ierr);
 
+        if (res == DW_DLV_ERROR) {
+            /*  The index is an optimization. Without it
+                lookups scan the hash table (and report
+                whatever is wrong with it) as they always did. */
+            dwarf_dealloc(dbg,ierr,DW_DLA_ERROR);
+            (*xuout)->gx_offset_index_built = TRUE;
+        }
+    }
+    return DW_DLV_OK;
 }
 
 static int
@@ -515,6 +701,11 @@ transform_xu_to_dfp(Dwarf_Xu_Index_Header xuhdr,
     unsigned max_cols = xuhdr->gx_column_count_sections;  /* L */
     unsigned secnums[DW_FISSION_SECT_COUNT];
     int res;
+
+    if (max_cols > DW_FISSION_SECT_COUNT) {
+        _dwarf_error(xuhdr->gx_dbg, error, DW_DLE_XU_NAME_COL_ERROR);
+        return DW_DLV_ERROR;
+    }
     for ( i = 0; i< max_cols; i++) {
         /*  We could put the secnums array into xuhdr
             if recreating it is too slow. */
@@ -615,6 +806,60 @@ dwarf_get_debugfission_for_key(Dwarf_Debug dbg,
     return sres;
 }
 
+/*  Fills percu_array with the per-unit data of every unit
+    of the "cu" or "tu" package index, in increasing order
+    of the unit's .debug_info (or .debug_types) offset.
+    At most array_count records are filled in,
+    *unit_count_out is set to the number of units, so a first
+    call with array_count zero gets the size to allocate. */
+int
+dwarf_get_debugfission_all(Dwarf_Debug dbg,
+    const char * key_type  /*  "cu" or "tu" */,
+    Dwarf_Debug_Fission_Per_CU *  percu_array,
+    Dwarf_Unsigned array_count,
+    Dwarf_Unsigned * unit_count_out,
+    Dwarf_Error *  error )
+{
+    Dwarf_Xu_Index_Header xuhdr = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Unsigned fill_count = 0;
+    int sres = 0;
+
+    if (!dbg) {
+        _dwarf_error(NULL, error, DW_DLE_DBG_NULL);
+        return DW_DLV_ERROR;
+    }
+    sres = _dwarf_get_xuhdr(dbg,key_type, &xuhdr,error);
+    if (sres != DW_DLV_OK) {
+        return sres;
+    }
+    if (!xuhdr->gx_offset_index && xuhdr->gx_slots_in_hash) {
+        /*  Building the index failed. Try again to
+            report why. */
+        sres = _dwarf_build_xu_offset_index(xuhdr,error);
+        if (sres != DW_DLV_OK) {
+            return sres;
+        }
+    }
+    fill_count = xuhdr->gx_offset_index_count;
+    if (fill_count > array_count) {
+        fill_count = array_count;
+    }
+    for (i = 0; i < fill_count; ++i) {
+        struct Dwarf_Xu_Offset_Entry_s *entry =
+            xuhdr->gx_offset_index + i;
+
+        memset(percu_array+i,0,sizeof(Dwarf_Debug_Fission_Per_CU));
+        sres = transform_xu_to_dfp(xuhdr,entry->xo_percu_index,
+            &entry->xo_hash,xuhdr->gx_type,percu_array+i,error);
+        if (sres != DW_DLV_OK) {
+            return sres;
+        }
+    }
+    *unit_count_out = xuhdr->gx_offset_index_count;
+    return DW_DLV_OK;
+}
+
 void
 dwarf_xu_header_free(Dwarf_Xu_Index_Header indexptr)
 {
@@ -36,6 +36,18 @@
 */
 
 
+/*  One unit of a package index, see gx_offset_index. */
+struct Dwarf_Xu_Offset_Entry_s {
+    /*  Offset of the unit's contribution to the
+        section gx_offset_index_sect. */
+    Dwarf_Unsigned   xo_offset;
+    /*  Row (1 to N) of the offset and size tables. */
+    Dwarf_Unsigned   xo_percu_index;
+    /*  Hash table slot (0 to M-1) and its signature. */
+    Dwarf_Unsigned   xo_slot;
+    Dwarf_Sig8       xo_hash;
+};
+
 struct Dwarf_Xu_Index_Header_s {
     Dwarf_Debug      gx_dbg;
     Dwarf_Small    * gx_section_data;
@@ -55,8 +67,25 @@ struct Dwarf_Xu_Index_Header_s {
 
     /* Do not free gx_section_name. */
     const char     * gx_section_name;
+
+    /*  Every unit in the hash table, sorted by the
+        offset of its DW_SECT_INFO (or, lacking that,
+        DW_SECT_TYPES) contribution so a section offset
+        is mapped to its unit by binary search.
+        Built on first use by _dwarf_get_xuhdr().
+        gx_offset_index_sect is the DW_SECT_* number of
+        the offsets, zero if neither column exists
+        (the entries are then in hash slot order).
+        A malloc-ed array, freed by the DW_DLA_XU_INDEX
+        destructor. */
+    struct Dwarf_Xu_Offset_Entry_s *gx_offset_index;
+    Dwarf_Unsigned   gx_offset_index_count;
+    Dwarf_Unsigned   gx_offset_index_sect;
+    Dwarf_Bool       gx_offset_index_built;
 };
 
+void _dwarf_xu_index_destructor(void *m);
+
 #endif  /* DWARF_XU_INDEX_H */
 
 
@@ -8,7 +8,7 @@
 .nr Hb 5
 \." ==============================================
 \." Put current date in the following at each rev
-.ds vE rev 2.52, September 8, 2016
+.ds vE rev 2.53, October 17, 2026
 \." ==============================================
 \." ==============================================
 .ds | |
@@ -203,6 +203,27 @@ the libdwarf draft for DWARF Version 1 and recent changes.
 
 .H 2 "Items Changed"
 .P
+Added dwarf_set_alloc_arena() and dwarf_get_alloc_stats().
+Added dwarf_preload_cu_headers().
+Added dwarf_set_frame_row_cache_size().
+Added dwarf_get_fde_at_pc_eh_hdr().
+Added the DIE cursor functions dwarf_die_cursor_open(),
+dwarf_next_die() and related functions.
+Added dwarf_init_mmap() and dwarf_finish_mmap().
+Added dwarf_addr_line_lookup() and related functions.
+Added dwarf_get_debugfission_all().
+dwarf_die_from_hash_signature() now works without a package file index.
+Added dwarf_decompress_sections() and dwarf_set_decompress_cache_dir().
+Added dwarf_set_index_cache_dir().
+Added dwarf_addr_cu_lookup() and related functions.
+Added dwarf_name_lookup() and related functions
+and dwarf_gdbindex_symboltable_lookup().
+Added dwarf_srclines_rows().
+Added dwarf_get_attrs().
+Added dwarf_set_stringcheck_b(), dwarf_set_reloc_application_b()
+and dwarf_set_concurrent_reads().
+(October 17, 2026)
+.P
 Adding support for DWARF5 .debug_loc.dwo
 and split dwarf range tables.
 Added dwarf_get_offset_size().
@@ -1769,6 +1790,54 @@ descriptor, an app should use \f(CWdwarf_get_elf\fP
 and should call \f(CWelf_end\fP with the pointer returned
 through the \f(CWElf**\fP handle created by \f(CWint dwarf_init()\fP.
 
+.H 3 "dwarf_init_mmap()"
+.DS
+\f(CWint dwarf_init_mmap(
+        int fd,
+        Dwarf_Unsigned access,
+        Dwarf_Handler errhand,
+        Dwarf_Ptr errarg,
+        Dwarf_Debug * dbg,
+        Dwarf_Error *error)\fP
+.DE
+The function
+\f(CWdwarf_init_mmap()\fP is like \f(CWdwarf_init()\fP
+(with the same arguments)
+but does not use libelf at all.
+It maps the whole ELF file into memory with \f(CWmmap()\fP
+and reads the ELF header and section headers itself.
+Section data is used directly from the mapping,
+so nothing is copied or read until it is used
+and opening even a very large object is fast and
+takes little memory.
+In a relocatable object the DWARF sections that have
+relocations get just their pages made
+writable (copy-on-write), so only the pages
+actually relocated are copied.
+.P
+It returns \f(CWDW_DLV_NO_ENTRY\fP
+if the file is not an ELF file or has no sections.
+The caller may close \f(CWfd\fP as soon as
+\f(CWdwarf_init_mmap()\fP returns.
+Where \f(CWmmap()\fP is not available
+it always returns \f(CWDW_DLV_ERROR\fP.
+.P
+Use \f(CWdwarf_finish_mmap()\fP,
+not \f(CWdwarf_finish()\fP,
+when done with the \f(CWDwarf_Debug\fP.
+
+.H 3 "dwarf_finish_mmap()"
+.DS
+\f(CWint dwarf_finish_mmap(
+        Dwarf_Debug dbg,
+        Dwarf_Error *error)\fP
+.DE
+The function
+\f(CWdwarf_finish_mmap()\fP releases all \fILibdwarf\fP
+resources of a \f(CWdbg\fP created by
+\f(CWdwarf_init_mmap()\fP, including the mapping
+of the file, and invalidates \f(CWdbg\fP.
+
 .H 3 "dwarf_set_stringcheck()"
 .DS
 \f(CWint dwarf_set_stringcheck(
@@ -1813,6 +1882,107 @@ or recorded.
 
 It seems unlikely anyone will need to call this function.
 
+.H 3 "dwarf_set_stringcheck_b()"
+.DS
+\f(CWint dwarf_set_stringcheck_b(
+        Dwarf_Debug dbg,
+        int stringcheck)\fP
+.DE
+The function
+\f(CWint dwarf_set_stringcheck_b()\fP
+is new in October 2026.
+It is like \f(CWdwarf_set_stringcheck()\fP
+but sets the flag of \f(CWdbg\fP alone
+and returns the previous value for \f(CWdbg\fP.
+A \f(CWdbg\fP starts with the value of the
+global flag when it is opened.
+
+.H 3 "dwarf_set_reloc_application_b()"
+.DS
+\f(CWint dwarf_set_reloc_application_b(
+        Dwarf_Debug dbg,
+        int apply)\fP
+.DE
+The function
+\f(CWint dwarf_set_reloc_application_b()\fP
+is new in October 2026.
+It is like \f(CWdwarf_set_reloc_application()\fP
+but applies to \f(CWdbg\fP alone, overriding
+the global flag.
+It returns the value that applied to \f(CWdbg\fP
+before the call.
+Relocations are applied as a section is loaded,
+so call it before reading anything from \f(CWdbg\fP.
+
+.H 3 "dwarf_set_concurrent_reads()"
+.DS
+\f(CWint dwarf_set_concurrent_reads(
+        Dwarf_Debug dbg,
+        int on,
+        Dwarf_Error *error)\fP
+.DE
+The function
+\f(CWint dwarf_set_concurrent_reads()\fP
+is new in October 2026.
+With \f(CWon\fP non-zero it lets several threads
+read from the one \f(CWdbg\fP at the same time.
+Call it after the \f(CWdbg\fP is opened and before
+any other thread uses it.
+It loads (and if need be decompresses) every
+section, reads every CU header of .debug_info and
+.debug_types and parses every abbreviation table,
+so that most later reads change nothing shared.
+What is still done on first use (loading a section
+a tied file or index needs, building the indexes of
+\f(CWdwarf_addr_line_lookup()\fP,
+\f(CWdwarf_addr_cu_lookup()\fP and
+\f(CWdwarf_name_lookup()\fP, the signature tables,
+a CU's DW_AT_str_offsets_base)
+is serialized by a lock in \f(CWdbg\fP,
+and a second short lock guards the records libdwarf
+keeps of what it has allocated.
+With \f(CWon\fP zero it ends the mode;
+only do that (or call \f(CWdwarf_finish()\fP) once
+the other threads are done with \f(CWdbg\fP.
+It returns \f(CWDW_DLV_OK\fP,
+\f(CWDW_DLV_ERROR\fP if the up-front reading fails,
+or \f(CWDW_DLV_NO_ENTRY\fP if libdwarf was built
+without thread support.
+
+Covered are the calls that start from a DIE offset
+or a DIE: \f(CWdwarf_offdie_b()\fP,
+\f(CWdwarf_child()\fP,
+\f(CWdwarf_siblingof_b()\fP with a non-null die,
+the DIE cursor functions,
+the attribute and form queries,
+\f(CWdwarf_get_attrs()\fP,
+the line table functions including
+\f(CWdwarf_srclines_rows()\fP,
+the lookup functions named above,
+and \f(CWdwarf_dealloc()\fP of what each thread got.
+Each thread must use its own \f(CWDwarf_Die\fP,
+\f(CWDwarf_Attribute\fP and other records:
+only the \f(CWdbg\fP is shared.
+
+Not covered, and to be called by one thread at a time:
+the CU header iterators
+(\f(CWdwarf_next_cu_header_d()\fP and
+\f(CWdwarf_siblingof_b()\fP with a null die
+keep the current CU in \f(CWdbg\fP),
+the frame functions,
+the printing functions,
+\f(CWdwarf_loclist_from_expr_a()\fP
+and the calls changing settings, such as
+\f(CWdwarf_set_alloc_arena()\fP and
+\f(CWdwarf_set_harmless_error_list_size()\fP.
+Make any such settings before turning the mode on.
+Sibling-skip hints are not recorded in this mode,
+so \f(CWdwarf_siblingof_b()\fP may walk a few
+more DIEs than it otherwise would.
+A tied file (see \f(CWdwarf_set_tied_dbg()\fP)
+is a separate \f(CWdbg\fP and needs
+the mode turned on too.
+
 .H 3 "dwarf_record_cmdline_options()"
 .DS
 \f(CWint dwarf_record_cmdline_options(
@@ -1833,6 +2003,81 @@ certain errors are detected.
 The default for this value is FALSE (0) so the extra messages
 are off by default.
 
+.H 3 "dwarf_set_alloc_arena()"
+.DS
+\f(CWint dwarf_set_alloc_arena(
+        Dwarf_Debug dbg,
+        int arena_on)\fP
+.DE
+The function
+\f(CWdwarf_set_alloc_arena()\fP
+turns arena allocation on (if
+\f(CWarena_on\fP is non-zero)
+or off for
+\f(CWdbg\fP
+and returns the previous setting.
+Arena allocation is off by default.
+.P
+With arena allocation on, the
+\f(CWDW_DLA_DIE\fP,
+\f(CWDW_DLA_ATTR\fP,
+\f(CWDW_DLA_LINE\fP,
+\f(CWDW_DLA_LIST\fP
+and chain records libdwarf creates
+are carved from large blocks of memory
+instead of being individually allocated and
+recorded for cleanup.
+A \f(CWdwarf_dealloc()\fP
+of such a record is very cheap
+(the record is kept for reuse) and all the blocks are
+freed at once by \f(CWdwarf_finish()\fP.
+Code that walks every DIE of a large object
+runs noticeably faster with arena allocation on.
+Memory use only shrinks at \f(CWdwarf_finish()\fP
+so turning the arena on is not appropriate
+for long-lived
+\f(CWDwarf_Debug\fP
+instances that read a great deal of data.
+.P
+Call it right after
+\f(CWdwarf_init()\fP
+(or similar).
+Records allocated before the call are unaffected.
+
+.H 3 "dwarf_get_alloc_stats()"
+.DS
+\f(CWint dwarf_get_alloc_stats(
+        Dwarf_Debug dbg,
+        Dwarf_Unsigned alloc_type,
+        Dwarf_Unsigned *alloc_count_out,
+        Dwarf_Unsigned *dealloc_count_out,
+        Dwarf_Unsigned *arena_bytes_out,
+        Dwarf_Error *error)\fP
+.DE
+The function
+\f(CWdwarf_get_alloc_stats()\fP
+returns through
+\f(CW*alloc_count_out\fP
+the number of records of type
+\f(CWalloc_type\fP
+(a \f(CWDW_DLA_*\fP value) libdwarf has allocated on
+\f(CWdbg\fP and through
+\f(CW*dealloc_count_out\fP
+the number passed to \f(CWdwarf_dealloc()\fP.
+An
+\f(CWalloc_type\fP
+of zero returns the totals for all types.
+If
+\f(CWarena_bytes_out\fP
+is non-null
+\f(CW*arena_bytes_out\fP
+is set to the number of bytes held in arena blocks
+(see \f(CWdwarf_set_alloc_arena()\fP).
+.P
+It returns
+\f(CWDW_DLV_NO_ENTRY\fP if
+\f(CWalloc_type\fP is not a valid type.
+
 .H 2 "Section size operations"
 .P
 These operations are informative but not normally needed.
@@ -2496,6 +2741,187 @@ The function \f(CWdwarf_offdie()\fP is obsolete, use
 The function is still supported in the library, but only
 references the .debug_info section.
 
+.H 3 "dwarf_preload_cu_headers()"
+.DS
+\f(CWint dwarf_preload_cu_headers(
+        Dwarf_Debug dbg,
+        Dwarf_Bool is_info,
+        Dwarf_Unsigned *cu_count_out,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_preload_cu_headers()\fP
+reads every compilation unit header of
+the .debug_info section (if \f(CWis_info\fP is non-zero)
+or the .debug_types section (if \f(CWis_info\fP is zero)
+in a single pass and records them in libdwarf's
+offset-sorted table of compilation units.
+On success it returns \f(CWDW_DLV_OK\fP and sets
+\f(CW*cu_count_out\fP to the number of compilation units.
+.P
+It is never required.
+\f(CWdwarf_offdie_b()\fP and the other
+offset-based functions read compilation unit headers as needed,
+but calling this first means an application
+following references all over a large object
+never pays for header reading during those calls,
+each of which then finds its compilation unit by
+a binary search.
+The position used by \f(CWdwarf_next_cu_header_d()\fP
+is not changed.
+
+.H 3 "dwarf_die_cursor_open()"
+.DS
+\f(CWint dwarf_die_cursor_open(
+        Dwarf_Die die,
+        Dwarf_Die_Cursor *cursor_out,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_die_cursor_open()\fP
+creates a cursor that walks \f(CWdie\fP and
+all its descendants in section order.
+Passing a compilation unit DIE walks the
+whole compilation unit.
+On success it returns \f(CWDW_DLV_OK\fP and sets
+\f(CW*cursor_out\fP.
+.P
+Walking with \f(CWdwarf_child()\fP and
+\f(CWdwarf_siblingof_b()\fP allocates a
+\f(CWDwarf_Die\fP for every DIE and
+\f(CWdwarf_attrlist()\fP allocates a
+\f(CWDwarf_Attribute\fP for every attribute.
+The cursor allocates nothing per DIE,
+so an application scanning every DIE
+(an indexer, for example) runs much faster with it.
+.P
+When done with the cursor call
+\f(CWdwarf_dealloc(dbg,cursor,DW_DLA_DIE_CURSOR)\fP.
+
+.H 3 "dwarf_die_cursor_reset()"
+.DS
+\f(CWint dwarf_die_cursor_reset(
+        Dwarf_Die_Cursor cursor,
+        Dwarf_Die die,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_die_cursor_reset()\fP
+restarts an existing cursor on \f(CWdie\fP,
+exactly as if it had been created by
+\f(CWdwarf_die_cursor_open()\fP,
+so one cursor can be used for every
+compilation unit of an object.
+
+.H 3 "dwarf_next_die()"
+.DS
+\f(CWint dwarf_next_die(
+        Dwarf_Die_Cursor cursor,
+        Dwarf_Half *tag_out,
+        Dwarf_Signed *depth_out,
+        Dwarf_Unsigned *abbrev_code_out,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_next_die()\fP
+moves the cursor to the next DIE and
+returns \f(CWDW_DLV_OK\fP, setting
+the DIE tag through \f(CW*tag_out\fP,
+its depth through \f(CW*depth_out\fP
+and its abbreviation code through
+\f(CW*abbrev_code_out\fP.
+The first call returns the DIE the cursor
+was started on, at depth zero.
+Its children have depth one, their children
+depth two, and so on.
+.P
+It returns \f(CWDW_DLV_NO_ENTRY\fP
+once the starting DIE and all its descendants
+have been returned.
+Null DIEs are not returned.
+
+.H 3 "dwarf_die_cursor_attrs()"
+.DS
+\f(CWint dwarf_die_cursor_attrs(
+        Dwarf_Die_Cursor cursor,
+        Dwarf_Attr_View *views,
+        Dwarf_Unsigned view_count,
+        Dwarf_Unsigned *attr_count_out,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_die_cursor_attrs()\fP
+fills in \f(CWviews[0]\fP through
+\f(CWviews[view_count-1]\fP with the attributes
+of the current DIE of the cursor, in the order
+of the abbreviation,
+and sets \f(CW*attr_count_out\fP to the number
+of attributes the DIE has.
+If that is more than \f(CWview_count\fP
+only the first \f(CWview_count\fP
+are filled in.
+The \f(CWviews\fP array belongs to the caller
+(normally it is a local array)
+and nothing is allocated.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if there
+is no current DIE.
+.P
+A \f(CWDwarf_Attr_View\fP has the following fields.
+\f(CWav_attr\fP is the attribute number.
+\f(CWav_form\fP is the form (if the abbreviation
+says \f(CWDW_FORM_indirect\fP this is the
+form actually used).
+\f(CWav_value\fP is the value for
+address, constant, flag, reference, section offset and
+string or address index forms.
+References of forms \f(CWDW_FORM_ref1\fP
+through \f(CWDW_FORM_ref_udata\fP are
+CU-relative offsets.
+A \f(CWDW_FORM_sdata\fP value should be cast to
+\f(CWDwarf_Signed\fP.
+For block and exprloc forms \f(CWav_value\fP
+is the block length.
+\f(CWav_data\fP points to the value in the section
+(to the block contents for block and exprloc forms,
+to the string for \f(CWDW_FORM_string\fP).
+\f(CWav_length\fP is the number of bytes the value
+occupies in the section.
+No relocation or string lookup is done:
+for \f(CWDW_FORM_strp\fP use \f(CWdwarf_get_str()\fP
+on \f(CWav_value\fP.
+
+.H 3 "dwarf_die_cursor_offset()"
+.DS
+\f(CWint dwarf_die_cursor_offset(
+        Dwarf_Die_Cursor cursor,
+        Dwarf_Off *global_offset_out,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_die_cursor_offset()\fP
+sets \f(CW*global_offset_out\fP to the
+section-global offset of the current DIE of the cursor.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if there
+is no current DIE.
+
+.H 3 "dwarf_die_cursor_die()"
+.DS
+\f(CWint dwarf_die_cursor_die(
+        Dwarf_Die_Cursor cursor,
+        Dwarf_Die *die_out,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_die_cursor_die()\fP
+creates an ordinary \f(CWDwarf_Die\fP for
+the current DIE of the cursor, for use
+with all the other DIE functions.
+The caller should
+\f(CWdwarf_dealloc(dbg,die,DW_DLA_DIE)\fP
+it when done with it.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if there
+is no current DIE.
+
 
 .H 3 "dwarf_validate_die_sibling()"
 .DS
@@ -2977,6 +3403,38 @@ It returns \f(CWDW_DLV_NO_ENTRY\fP if \f(CWattr\fP is not contained
 in \f(CWdie\fP. 
 It returns \f(CWDW_DLV_ERROR\fP if an error occurred.
 
+.H 3 "dwarf_get_attrs()"
+.DS
+\f(CWint dwarf_get_attrs(
+        Dwarf_Die die,
+        const Dwarf_Half *attr_list,
+        Dwarf_Unsigned attr_count,
+        Dwarf_Attr_View *values,
+        Dwarf_Unsigned *found_count,
+        Dwarf_Error *error)\fP
+.DE
+.P
+New October 2026.
+The function \f(CWdwarf_get_attrs()\fP
+fetches the values of the \f(CWattr_count\fP
+attributes in \f(CWattr_list\fP
+in a single pass over the attributes of \f(CWdie\fP.
+It is cheaper than calling \f(CWdwarf_attr()\fP once per
+attribute, and nothing is allocated.
+\f(CWvalues\fP must have \f(CWattr_count\fP entries.
+\f(CWvalues[i]\fP is filled in for \f(CWattr_list[i]\fP
+just as \f(CWdwarf_die_cursor_attrs()\fP fills in
+a \f(CWDwarf_Attr_View\fP.
+If \f(CWdie\fP does not have that attribute
+every field of \f(CWvalues[i]\fP is zero except \f(CWav_attr\fP.
+.P
+When it returns \f(CWDW_DLV_OK\fP
+\f(CW*found_count\fP is the number of
+the attributes that \f(CWdie\fP has.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if \f(CWdie\fP
+has none of them
+and \f(CWDW_DLV_ERROR\fP if an error occurred.
+
 
 .H 3 "dwarf_lowpc()"
 .DS
@@ -5063,6 +5521,76 @@ void examplec(Dwarf_Die cu_die)
 .DE
 .in -2
 
+.H 3 "dwarf_srclines_rows()"
+.DS
+\f(CWint dwarf_srclines_rows(
+        Dwarf_Die die,
+        Dwarf_Line_Row_Callback callback,
+        void *user_data,
+        Dwarf_Error *error)\fP
+.DE
+The function \f(CWdwarf_srclines_rows()\fP
+runs the line table program of the compilation unit
+of \f(CWdie\fP and calls
+\f(CWcallback\fP once for each row, in table order.
+No \f(CWDwarf_Line\fP is created: each row is handed
+to the callback by value, so reading a line table of any
+size takes the same small amount of memory
+(the header, file names and directory names
+are read into a line context as usual).
+For a two-level line table all the logicals rows
+are passed and then all the actuals rows.
+As actuals and later logicals refer back to logicals rows
+by number, the logicals rows of a two-level table
+are kept (by value, in one array) while the table is read.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if there is
+no line table,
+\f(CWDW_DLV_ERROR\fP on error,
+else \f(CWDW_DLV_OK\fP.
+.DS
+\f(CWtypedef int (*Dwarf_Line_Row_Callback)(
+    Dwarf_Line_Context line_context,
+    Dwarf_Line_Row *   row,
+    void *             user_data);\fP
+.DE
+The callback returns \f(CWDW_DLV_OK\fP to be called for the
+next row, anything else to stop the reading
+(\f(CWdwarf_srclines_rows()\fP then returns
+\f(CWDW_DLV_OK\fP).
+\f(CWline_context\fP may be passed to the
+line context functions below, for example to get a file name
+with \f(CWdwarf_srclines_files_data()\fP,
+but only during the callback: it is freed before
+\f(CWdwarf_srclines_rows()\fP returns.
+.DS
+\f(CWtypedef struct {
+    Dwarf_Unsigned  rw_row;
+    Dwarf_Addr      rw_address;
+    Dwarf_Unsigned  rw_file;
+    Dwarf_Unsigned  rw_line;
+    Dwarf_Unsigned  rw_column;
+    Dwarf_Unsigned  rw_discriminator;
+    Dwarf_Unsigned  rw_call_context;
+    Dwarf_Unsigned  rw_subprogram;
+    Dwarf_Small     rw_isa;
+    Dwarf_Bool      rw_is_stmt;
+    Dwarf_Bool      rw_basic_block;
+    Dwarf_Bool      rw_end_sequence;
+    Dwarf_Bool      rw_prologue_end;
+    Dwarf_Bool      rw_epilogue_begin;
+    Dwarf_Bool      rw_is_addr_set;
+    Dwarf_Bool      rw_is_actuals;
+} Dwarf_Line_Row;\fP
+.DE
+The fields are the line table registers at the row.
+\f(CWrw_row\fP is the row number within its table,
+starting at one.
+\f(CWrw_is_addr_set\fP is non-zero if a
+\f(CWDW_LNE_set_address\fP preceded the row.
+\f(CWrw_is_actuals\fP is non-zero for
+a row of the actuals table of a two-level table.
+This function is new in October 2026.
+
 .H 2 "Line Context Details (DWARF5 style)"
 New in October 2015.
 When a 
@@ -5672,6 +6200,147 @@ It never returns \f(CWDW_DLV_NO_ENTRY\fP.
 
 This function is new in December 2011.
 
+.H 2 "Address To Line Lookup"
+.P
+Finding the source line of a pc with the functions above
+means finding the right compilation unit, calling
+\f(CWdwarf_srclines_b()\fP on it and searching the
+lines returned.
+The functions here read the line tables of
+all the compilation units of .debug_info once,
+keeping only the address, line, column and file of
+each row in an index sorted by address, and then
+look up any number of pc values in that index.
+
+.H 3 "dwarf_addr_line_index_build()"
+.DS
+\f(CWint dwarf_addr_line_index_build(
+        Dwarf_Debug dbg,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_addr_line_index_build()\fP
+builds the address to line index of \f(CWdbg\fP
+if it is not built already, returning
+\f(CWDW_DLV_OK\fP.
+It returns \f(CWDW_DLV_ERROR\fP if
+reading some line table fails.
+.P
+Calling it is optional,
+\f(CWdwarf_addr_line_lookup()\fP
+builds the index when first called.
+The position used by \f(CWdwarf_next_cu_header_d()\fP
+is not changed.
+Each source file name is kept once
+however many compilation units name it.
+
+.H 3 "dwarf_addr_line_lookup()"
+.DS
+\f(CWint dwarf_addr_line_lookup(
+        Dwarf_Debug dbg,
+        Dwarf_Unsigned pc_count,
+        Dwarf_Addr *pcs,
+        Dwarf_Addr_Line *results,
+        Dwarf_Error *error)\fP
+.DE
+.P
+The function \f(CWdwarf_addr_line_lookup()\fP
+looks up each of the \f(CWpc_count\fP
+values in \f(CWpcs\fP, setting
+\f(CWresults[i]\fP for \f(CWpcs[i]\fP,
+and returns \f(CWDW_DLV_OK\fP.
+It returns \f(CWDW_DLV_ERROR\fP only if
+the index could not be built.
+.P
+The row found for a pc is the last row,
+of the line table sequence containing the pc,
+whose address is less than or equal to the pc.
+If no sequence contains the pc
+\f(CWal_found\fP is set zero.
+\f(CWal_filename\fP belongs to the \f(CWDwarf_Debug\fP
+and is valid until \f(CWdwarf_addr_line_index_free()\fP
+or \f(CWdwarf_finish()\fP.
+It is NULL if the line table does not give a file name.
+.DS
+\f(CWtypedef struct {
+    Dwarf_Bool      al_found;
+    Dwarf_Addr      al_addr;
+    Dwarf_Unsigned  al_line;
+    Dwarf_Unsigned  al_column;
+    char *          al_filename;
+    Dwarf_Off       al_cu_die_offset;
+} Dwarf_Addr_Line;\fP
+.DE
+.P
+When \f(CWpcs\fP is sorted in increasing order
+the whole batch is looked up in one forward pass over
+the index, so symbolizing the many pc values of a
+stack trace costs little more than symbolizing one.
+Unsorted \f(CWpcs\fP give the same results,
+more slowly.
+.P
+In a relocatable object (a .o file) the line table
+sequences of the functions usually all start at address
+zero, so a pc does not identify one source line.
+The sequence with the greatest starting address
+containing the pc is used.
+
+.H 3 "dwarf_addr_line_index_free()"
+.DS
+\f(CWvoid dwarf_addr_line_index_free(
+        Dwarf_Debug dbg)\fP
+.DE
+.P
+The function \f(CWdwarf_addr_line_index_free()\fP
+frees the index and the file names
+returned by \f(CWdwarf_addr_line_lookup()\fP.
+\f(CWdwarf_finish()\fP frees them if
+this is not called.
+
+.H 3 "dwarf_set_index_cache_dir()"
+.DS
+\f(CWint dwarf_set_index_cache_dir(
+        Dwarf_Debug dbg,
+        const char *cache_dir,
+        Dwarf_Error *error)\fP
+.DE
+The function \f(CWdwarf_set_index_cache_dir()\fP
+names a directory (which must exist)
+where libdwarf keeps a copy of the
+address-to-line index each time
+\f(CWdwarf_addr_line_index_build()\fP builds one.
+Building the index for an object that
+has a file there (from this or an earlier process)
+maps the file into memory instead,
+which takes a small fraction of the time of
+reading the line tables.
+Passing \f(CWcache_dir\fP NULL
+turns the cache off.
+.P
+A cached file name is made of the object's
+\f(CW.note.gnu.build-id\fP and the sizes of its
+\f(CW.debug_info\fP and \f(CW.debug_line\fP
+sections or, with no build id, a hash of
+the contents of those sections.
+The file records that identity, the libdwarf
+file format version and the record layout,
+and a hash of its contents.
+A file that does not match in every respect,
+or does not describe a consistent index,
+is ignored and the index is built (and the file
+replaced) as if there were no file.
+Failure to read or write the cache is silent.
+The file is only usable by a libdwarf built
+for the same byte order and type sizes.
+.P
+It returns \f(CWDW_DLV_OK\fP on success,
+\f(CWDW_DLV_NO_ENTRY\fP if this libdwarf
+was built without \f(CWmmap()\fP,
+and \f(CWDW_DLV_ERROR\fP if \f(CWdbg\fP is NULL
+or memory is exhausted.
+.P
+This function is new in October 2026.
+
 
 .H 2 "Global Name Space Operations" 
 These operations operate on the .debug_pubnames section of the debugging 
@@ -5903,6 +6572,93 @@ pointed to by \f(CWreturn_name\fP
 should be freed using \f(CWdwarf_dealloc()\fP, 
 with the allocation type \f(CWDW_DLA_STRING\fP when no longer of interest.
 
+.H 3 "Name Lookup Operations"
+These find the DIEs with a given name without
+reading all of .debug_pubnames into
+\f(CWDwarf_Global\fP records (or all of .gdb_index)
+for every lookup.
+They are new in October 2026.
+
+.H 4 "dwarf_name_index_build()"
+.DS
+\f(CWint dwarf_name_index_build(
+        Dwarf_Debug dbg,
+        Dwarf_Error *error)\fP
+.DE
+The function \f(CWdwarf_name_index_build()\fP
+prepares the name index of \f(CWdbg\fP
+if that has not already been done.
+If the object has a .gdb_index section of version 4 or later
+its symbol hash table is used as the index.
+Otherwise the .debug_pubnames and .debug_pubtypes
+entries are read once into a hash table.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if the object has
+none of these sections,
+\f(CWDW_DLV_ERROR\fP on error,
+else \f(CWDW_DLV_OK\fP.
+.P
+There is no need to call it, \f(CWdwarf_name_lookup()\fP
+builds the index on first use.
+
+.H 4 "dwarf_name_lookup()"
+.DS
+\f(CWint dwarf_name_lookup(
+        Dwarf_Debug dbg,
+        const char *name,
+        Dwarf_Name_Result *results,
+        Dwarf_Unsigned result_max,
+        Dwarf_Unsigned *result_count,
+        Dwarf_Error *error)\fP
+.DE
+The function \f(CWdwarf_name_lookup()\fP
+looks up \f(CWname\fP exactly as the index records it
+(a .gdb_index or pubnames name is qualified,
+for example \f(CWns::Widget\fP).
+It sets \f(CW*result_count\fP to the number of DIEs found,
+fills in the first \f(CWresult_max\fP of them
+(or all, if fewer) and returns \f(CWDW_DLV_OK\fP.
+It returns \f(CWDW_DLV_NO_ENTRY\fP if nothing
+has the name or there is no index.
+.DS
+\f(CWtypedef struct {
+    Dwarf_Off       nr_die_offset;
+    Dwarf_Off       nr_cu_die_offset;
+    Dwarf_Bool      nr_is_info;
+    Dwarf_Small     nr_kind;
+    Dwarf_Bool      nr_is_static;
+} Dwarf_Name_Result;\fP
+.DE
+.P
+.gdb_index records only the compilation unit (or type unit)
+of a name, so for .gdb_index results
+the DIE is found by reading the DIEs of the unit
+for one whose \f(CWDW_AT_name\fP, qualified by the names
+of the namespaces, classes, structures and unions
+enclosing it, is the name.
+Members, parameters and anything within a function
+are not considered, nor (when \f(CWnr_kind\fP is
+not \f(CWDW_NAME_KIND_NONE\fP) DIEs of another kind.
+A definition is preferred to a declaration,
+and a DIE whose \f(CWDW_AT_specification\fP refers to
+the matching declaration counts as its definition.
+\f(CWnr_die_offset\fP is zero if there is none.
+\f(CWnr_is_info\fP is zero if the unit is in .debug_types.
+\f(CWnr_kind\fP (one of the \f(CWDW_NAME_KIND\fP values)
+and \f(CWnr_is_static\fP are as .gdb_index version 7
+records them;
+.debug_pubnames results have kind \f(CWDW_NAME_KIND_NONE\fP
+and .debug_pubtypes results \f(CWDW_NAME_KIND_TYPE\fP.
+
+.H 4 "dwarf_name_index_free()"
+.DS
+\f(CWvoid dwarf_name_index_free(
+        Dwarf_Debug dbg)\fP
+.DE
+The function \f(CWdwarf_name_index_free()\fP
+frees the name index.
+\f(CWdwarf_finish()\fP frees it if
+this is not called.
+
 
 .H 2 "DWARF3 Type Names Operations"
 Section ".debug_pubtypes" is new in DWARF3.
@@ -8533,6 +9289,42 @@ The function returns
 the previous value of the pseudo-register  (taken from the
 \f(CWdbg\fP structure).
 
+.H 3 "dwarf_set_frame_row_cache_size()"
+.DS
+\f(CWDwarf_Unsigned
+dwarf_set_frame_row_cache_size(Dwarf_Debug dbg,
+         Dwarf_Unsigned max_bytes);\fP
+.DE
+\f(CWdwarf_set_frame_row_cache_size()\fP sets
+the maximum number of bytes libdwarf may use to keep
+compiled row tables for frame description entries
+and returns the previous maximum.
+The default is zero, meaning no row tables are kept
+and every pc query runs the CIE and FDE instructions
+from the start.
+.P
+With a non-zero maximum the first query for a pc in
+an FDE
+(\f(CWdwarf_get_fde_info_for_all_regs3()\fP,
+\f(CWdwarf_get_fde_info_for_reg3()\fP,
+\f(CWdwarf_get_fde_info_for_cfa_reg3_b()\fP
+and the like)
+evaluates all the rows of that FDE once, recording
+for each row only the register rules that changed.
+Later queries on that FDE find the row
+by a binary search.
+This is worthwhile for an application (such as an unwinder
+or profiler) that asks about many pc values.
+When the limit is reached the row tables of the least
+recently used FDEs are freed.
+An FDE whose row table would not fit at all
+is simply evaluated the old way.
+The answers are identical either way.
+.P
+Calling any of the \f(CWdwarf_set_frame_*()\fP functions
+frees all the row tables, as does
+setting the maximum to zero.
+
 .H 3 "dwarf_set_default_address_size()"
 This allows consumers to set a default address size.
 When one has an object where the
@@ -8893,6 +9685,49 @@ This function cannot be used unless
 the block of \f(CWDwarf_Fde\fP descriptors has been created by a call to
 \f(CWdwarf_get_fde_list()\fP.
 
+.H 3 "dwarf_get_fde_at_pc_eh_hdr()"
+.DS
+\f(CWint   dwarf_get_fde_at_pc_eh_hdr(
+        Dwarf_Debug dbg,
+        Dwarf_Addr pc_of_interest,
+        Dwarf_Fde *returned_fde,
+        Dwarf_Addr *lopc,
+        Dwarf_Addr *hipc,
+        Dwarf_Error *error)\fP
+.DE
+\f(CWdwarf_get_fde_at_pc_eh_hdr()\fP is like
+\f(CWdwarf_get_fde_at_pc()\fP for GNU .eh_frame
+but needs no prior call to \f(CWdwarf_get_fde_list_eh()\fP.
+It uses the binary search table in the
+.eh_frame_hdr section to find the one FDE
+covering \f(CWpc_of_interest\fP and creates
+only that FDE and its CIE,
+so the cost of a lookup does not depend on the number
+of FDEs in the object.
+On success it returns \f(CWDW_DLV_OK\fP,
+sets \f(CW*returned_fde\fP and sets
+\f(CW*lopc\fP and \f(CW*hipc\fP (if non-null)
+to the low and high address covered by the FDE.
+.P
+The returned FDE is not part of any FDE list:
+do not pass it to \f(CWdwarf_get_fde_n()\fP
+or \f(CWdwarf_fde_cie_list_dealloc()\fP.
+Free it with \f(CWdwarf_dealloc(dbg,fde,DW_DLA_FDE)\fP.
+Its CIE is kept by libdwarf, shared with later calls,
+and freed by \f(CWdwarf_finish()\fP.
+.P
+It returns \f(CWDW_DLV_NO_ENTRY\fP if there is no
+.eh_frame_hdr section, if the search table
+is absent or uses an encoding not handled
+(the table must have fixed-size entries
+which are absolute, pc-relative or relative to .eh_frame_hdr,
+as all GNU linkers create),
+or if no FDE covers \f(CWpc_of_interest\fP.
+A caller getting \f(CWDW_DLV_NO_ENTRY\fP
+may fall back to \f(CWdwarf_get_fde_list_eh()\fP
+and \f(CWdwarf_get_fde_at_pc()\fP.
+It returns \f(CWDW_DLV_ERROR\fP on error.
+
 .H 3 "dwarf_expand_frame_instructions()"
 .DS
 \f(CWint dwarf_expand_frame_instructions(
@@ -9350,6 +10185,84 @@ the descriptor.
 It returns \f(CWDW_DLV_ERROR\fP on error.
 It returns \f(CWDW_DLV_NO_ENTRY\fP if there is no .debug_aranges
 entry covering that address.
+.P
+The block is searched from the start for every call.
+To look up many addresses use
+\f(CWdwarf_addr_cu_lookup()\fP.
+
+.H 3 "dwarf_addr_cu_map_build()"
+.DS
+\f(CWint dwarf_addr_cu_map_build(
+        Dwarf_Debug dbg,
+        Dwarf_Error *error)\fP
+.DE
+The function \f(CWdwarf_addr_cu_map_build()\fP
+builds the address-to-CU map of \f(CWdbg\fP
+if it has not already been built.
+The map is made from the .debug_aranges entries
+and, for every CU that .debug_aranges does not mention
+(every CU if there is no .debug_aranges section),
+from the \f(CWDW_AT_ranges\fP or
+\f(CWDW_AT_low_pc\fP and \f(CWDW_AT_high_pc\fP
+of the CU DIE.
+The ranges are sorted by address.
+Where ranges overlap, the overlapped addresses
+belong to the one starting lower (or, starting at the same
+address, to the one read first, and .debug_aranges is
+read first).
+Touching ranges of the same CU are merged.
+A .debug_aranges section that cannot be read
+is treated as missing.
+It returns \f(CWDW_DLV_OK\fP
+or \f(CWDW_DLV_ERROR\fP.
+.P
+There is no need to call it, \f(CWdwarf_addr_cu_lookup()\fP
+builds the map on first use.
+This function is new in October 2026.
+
+.H 3 "dwarf_addr_cu_lookup()"
+.DS
+\f(CWint dwarf_addr_cu_lookup(
+        Dwarf_Debug dbg,
+        Dwarf_Unsigned pc_count,
+        Dwarf_Addr *pcs,
+        Dwarf_Addr_CU *results,
+        Dwarf_Error *error)\fP
+.DE
+The function \f(CWdwarf_addr_cu_lookup()\fP
+looks up the \f(CWpc_count\fP addresses
+in \f(CWpcs\fP, setting \f(CWresults[i]\fP
+for \f(CWpcs[i]\fP, and returns \f(CWDW_DLV_OK\fP.
+It returns \f(CWDW_DLV_ERROR\fP only if
+the map could not be built.
+Each lookup is a binary search of the map.
+When \f(CWpcs\fP is sorted in increasing order
+the whole batch is looked up in one forward pass
+over the map.
+.DS
+\f(CWtypedef struct {
+    Dwarf_Bool      ac_found;
+    Dwarf_Addr      ac_lowpc;
+    Dwarf_Addr      ac_highpc;
+    Dwarf_Off       ac_cu_die_offset;
+    Dwarf_Off       ac_cu_header_offset;
+} Dwarf_Addr_CU;\fP
+.DE
+\f(CWac_found\fP is zero (as are the other fields)
+if no CU covers the pc.
+\f(CWac_lowpc\fP and \f(CWac_highpc\fP
+(one past the end) are the map entry containing the pc.
+This function is new in October 2026.
+
+.H 3 "dwarf_addr_cu_map_free()"
+.DS
+\f(CWvoid dwarf_addr_cu_map_free(
+        Dwarf_Debug dbg)\fP
+.DE
+The function \f(CWdwarf_addr_cu_map_free()\fP
+frees the map.
+\f(CWdwarf_finish()\fP frees it if
+this is not called.
 
 
 
@@ -10090,6 +11003,28 @@ The \f(CWstring_offset\fP
 and \f(CWcu_vector_offset\fP through the pointers.
 See the example above which uses this function.
 
+.H 3 "dwarf_gdbindex_symboltable_lookup()"
+.DS
+int dwarf_gdbindex_symboltable_lookup(
+    Dwarf_Gdbindex   gdbindexptr,
+    const char     * name,
+    Dwarf_Unsigned * entryindex,
+    Dwarf_Error    * error);
+.DE
+.P
+The function \f(CWdwarf_gdbindex_symboltable_lookup()\fP
+searches the symbol table hash for \f(CWname\fP
+the way gdb does
+and, if it is there, returns DW_DLV_OK and
+sets \f(CW*entryindex\fP to the index of its
+symbol table entry for
+\f(CWdwarf_gdbindex_symboltable_entry()\fP.
+It returns DW_DLV_NO_ENTRY if the name is not there
+and DW_DLV_ERROR if the section is older than version 4
+(whose hash function differs) or the symbol table
+size is not a power of two.
+This function is new in October 2026.
+
 
 .H 3 "dwarf_gdbindex_cuvector_length()"
 .DS
@@ -10339,14 +11274,24 @@ or
 a 
 \f(CWDW_AT_dwo_id\fP (form 
 \f(CWDW_FORM_data8\fP)
-to a DIE from a .dwp package file
-or a .dwo object file ( .dwo access
-not supported yet).
+to a DIE from a .dwp package file,
+a .dwo object file, or any object
+with type units.
 .P
 The caller passes in
 \f(CWdbg\fP which should be
 \f(CWDwarf_Debug\fP open/initialized
-on a .dwp package file (or a .dwo object file).
+on a .dwp package file, a .dwo object file
+or an object or executable with
+type units in .debug_types (DWARF4)
+or .debug_info (DWARF5).
+Without a package file index
+the first call reads the unit headers
+once into a signature index
+(and for "cu" reads each compilation
+unit DIE for its \f(CWDW_AT_dwo_id\fP),
+so every later call costs about the same
+however many type units there are.
 .P
 The caller also  passes in
 \f(CWhash_sig\fP, a pointer to the
@@ -10379,11 +11324,10 @@ by a call something like
     dwarf_dealloc(dbg,die,DW_DLA_DIE);
 .DE
 .P
-If there is no DWP Package File section
-or the hash cannot be found 
+If the hash cannot be found 
 the function returns
 \f(CWDW_DLV_NO_ENTRY\fP and leaves \f(CWreturned_die\fP
-untouched.  Only .dwo objects and .dwp package files
+untouched.  Only .dwp package files
 have the package file index sections.
 .P
 If there is an error of some sort
@@ -10455,6 +11399,49 @@ the function returns
 untouched, and sets \f(CW*error\fP to indicate
 the precise error encountered.
 
+.H 3 "dwarf_get_debugfission_all()" 
+.DS
+int dwarf_get_debugfission_all(Dwarf_Debug dbg,
+    const char *                 key_type,
+    Dwarf_Debug_Fission_Per_CU * percu_array,
+    Dwarf_Unsigned               array_count,
+    Dwarf_Unsigned *             unit_count_out,
+    Dwarf_Error *                error);
+.DE
+
+The function
+\f(CWdwarf_get_debugfission_all()\fP
+returns the debug fission data of every unit
+of the package file index named by \f(CWkey_type\fP
+(\f(CW"cu"\fP or \f(CW"tu"\fP)
+in one call, in increasing order of the offset
+of each unit in .debug_info.dwo
+(or .debug_types.dwo).
+It is much faster than calling
+\f(CWdwarf_get_debugfission_for_key()\fP
+for each hash table entry.
+.P
+Up to \f(CWarray_count\fP records of
+\f(CWpercu_array\fP are zeroed and filled in
+and \f(CW*unit_count_out\fP is set to the number
+of units, which may be larger than \f(CWarray_count\fP.
+So calling first with \f(CWarray_count\fP zero
+gives the number of records to allocate.
+.P
+If there is no such package file index section
+the function returns
+\f(CWDW_DLV_NO_ENTRY\fP.
+If there is an error of some sort
+the function returns
+\f(CWDW_DLV_ERROR\fP and sets \f(CW*error\fP.
+.P
+Internally libdwarf sorts the units by offset the
+first time the index is used, so mapping a
+.debug_info.dwo offset to its unit (done for every
+compilation unit read from a package file)
+is a binary search rather than a scan of the
+whole index.
+
 .H 3 "dwarf_get_xu_index_header()"
 .DS
 int dwarf_get_xu_index_header(Dwarf_Debug dbg,
@@ -10977,6 +11964,75 @@ to open-source it.
 Returns a count of the number of object sections found.
 
 
+.H 3 "dwarf_decompress_sections()"
+.DS
+\f(CWint dwarf_decompress_sections(
+   Dwarf_Debug dbg,
+   unsigned thread_count,
+   Dwarf_Error *error)\fP
+.DE 
+The function \f(CWdwarf_decompress_sections()\fP
+loads every zlib-compressed DWARF section
+(\f(CWSHF_COMPRESSED\fP or \f(CW.zdebug\fP)
+of \f(CWdbg\fP that is not yet loaded,
+inflating the sections in parallel on up to
+\f(CWthread_count\fP threads.
+A \f(CWthread_count\fP of zero means one thread
+per online processor.
+Without the call each compressed section is
+inflated, by the calling thread, when it is first used.
+Each section is inflated by one thread, so
+a single large section gains nothing.
+.P
+A section that cannot be decompressed is left unloaded
+and the error is reported when the section is
+used, just as without the call.
+.P
+It returns \f(CWDW_DLV_OK\fP when done,
+\f(CWDW_DLV_NO_ENTRY\fP if there are no compressed
+sections waiting to be loaded,
+and \f(CWDW_DLV_ERROR\fP if \f(CWdbg\fP is NULL
+or (in a libdwarf built without zlib) the sections
+cannot be decompressed at all.
+.P
+This function is new in October 2026.
+
+.H 3 "dwarf_set_decompress_cache_dir()"
+.DS
+\f(CWint dwarf_set_decompress_cache_dir(
+   Dwarf_Debug dbg,
+   const char *cache_dir,
+   Dwarf_Error *error)\fP
+.DE 
+The function \f(CWdwarf_set_decompress_cache_dir()\fP
+names a directory (which must exist)
+where libdwarf keeps a copy
+of each compressed section it inflates.
+When the same section is needed again,
+by this or a later process,
+the copy is mapped into memory instead
+of inflating the section again.
+Passing \f(CWcache_dir\fP NULL
+turns the cache off.
+.P
+A cached file name is made of the object's
+\f(CW.note.gnu.build-id\fP (if any), a hash of the
+compressed bytes and the inflated length, so
+a changed object does not find stale data.
+Failure to read or write the cache is silent:
+the section is simply inflated.
+Call it before any compressed section is loaded,
+for example right after \f(CWdwarf_init()\fP.
+.P
+It returns \f(CWDW_DLV_OK\fP on success,
+\f(CWDW_DLV_NO_ENTRY\fP if this libdwarf
+was built without zlib or without \f(CWmmap()\fP,
+and \f(CWDW_DLV_ERROR\fP if \f(CWdbg\fP is NULL
+or memory is exhausted.
+.P
+This function is new in October 2026.
+
+
 
 .H 3 "dwarf_get_section_info_by_name()"
 .DS
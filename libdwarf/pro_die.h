@@ -42,6 +42,10 @@ struct Dwarf_P_Abbrev_s {
     Dwarf_ufixed *abb_forms;  /* forms of attributes */
     int abb_n_attr;           /* num of attrs = # of forms */
     Dwarf_P_Abbrev abb_next;
+
+    /*  For the abbrev hash table in pro_section.c */
+    Dwarf_Unsigned abb_hash;
+    Dwarf_P_Abbrev abb_hash_next;
 };
 
 /* used in pro_section.c */
@@ -146,7 +146,20 @@ static int _dwarf_pro_generate_debugframe(Dwarf_P_Debug dbg,
     Dwarf_Signed *nbufs, Dwarf_Error * error);
 static int _dwarf_pro_generate_debuginfo(Dwarf_P_Debug dbg,
     Dwarf_Signed *nbufs, Dwarf_Error * error);
-static Dwarf_P_Abbrev _dwarf_pro_getabbrev(Dwarf_P_Die, Dwarf_P_Abbrev);
+
+/*  Hash table of the abbreviations created so far, so
+    finding the abbreviation for a die does not mean
+    comparing it with every earlier abbreviation.
+    Chained through abb_hash_next. */
+struct Dwarf_P_Abbrev_Hash_s {
+    Dwarf_P_Abbrev *ah_buckets;
+    Dwarf_Unsigned  ah_bucket_count; /* A power of 2. */
+    Dwarf_Unsigned  ah_entry_count;
+};
+#define ABBREV_HASH_INITIAL_BUCKETS 256
+
+static Dwarf_P_Abbrev _dwarf_pro_getabbrev(Dwarf_P_Die,
+    struct Dwarf_P_Abbrev_Hash_s *);
 static int _dwarf_pro_match_attr
     (Dwarf_P_Attribute, Dwarf_P_Abbrev, int no_attr);
 
@@ -1718,6 +1731,7 @@ _dwarf_pro_generate_debuginfo(Dwarf_P_Debug dbg,
     Dwarf_P_Abbrev curabbrev = 0;
     Dwarf_P_Abbrev abbrev_head = 0;
     Dwarf_P_Abbrev abbrev_tail = 0;
+    struct Dwarf_P_Abbrev_Hash_s abbrev_hash;
     Dwarf_P_Die curdie = 0;
     Dwarf_P_Die first_child = 0;
     Dwarf_Word dw = 0;
@@ -1739,6 +1753,14 @@ _dwarf_pro_generate_debuginfo(Dwarf_P_Debug dbg,
 
     abbrev_head = abbrev_tail = NULL;
     elfsectno_of_debug_info = dbg->de_elf_sects[DEBUG_INFO];
+    abbrev_hash.ah_bucket_count = ABBREV_HASH_INITIAL_BUCKETS;
+    abbrev_hash.ah_entry_count = 0;
+    abbrev_hash.ah_buckets = (Dwarf_P_Abbrev *)
+        _dwarf_p_get_alloc(dbg,
+            sizeof(Dwarf_P_Abbrev) * abbrev_hash.ah_bucket_count);
+    if (abbrev_hash.ah_buckets == NULL) {
+        DWARF_P_DBG_ERROR(dbg, DW_DLE_ABBREV_ALLOC, DW_DLV_ERROR);
+    }
 
     /* write cu header */
     cu_header_size = BEGIN_LEN_SIZE +
@@ -1845,7 +1867,7 @@ _dwarf_pro_generate_debuginfo(Dwarf_P_Debug dbg,
         if (curdie->di_marker != 0)
             marker_count++;
 
-        curabbrev = _dwarf_pro_getabbrev(curdie, abbrev_head);
+        curabbrev = _dwarf_pro_getabbrev(curdie, &abbrev_hash);
         if (curabbrev == NULL) {
             DWARF_P_DBG_ERROR(dbg, DW_DLE_ABBREV_ALLOC, DW_DLV_ERROR);
         }
@@ -2196,6 +2218,7 @@ _dwarf_pro_generate_debuginfo(Dwarf_P_Debug dbg,
     /* one zero, for end of cu, see dwarf2 sec 7.5.3 */
     GET_CHUNK_ERR(dbg, abbrevsectno, data, 1, error);
     *data = 0;
+    _dwarf_p_dealloc(dbg,(Dwarf_Small *)abbrev_hash.ah_buckets);
     *nbufs =  dbg->de_n_debug_sect;
     return DW_DLV_OK;
 }
@@ -2408,14 +2431,79 @@ _dwarf_pro_get_opc(Dwarf_P_Debug dbg,Dwarf_Unsigned addr_adv, int line_adv)
     return LINE_OUT_OF_RANGE;
 }
 
-/*  Handles abbreviations. It takes a die, searches through
-    current list of abbreviations for matching one. If it
+/*  The hash depends on the tag, whether there are children
+    and the set of attribute/form pairs, but not on the
+    order of the attributes, as _dwarf_pro_match_attr()
+    does not care about order either. */
+static Dwarf_Unsigned
+_dwarf_pro_abbrev_hash(Dwarf_P_Die die)
+{
+    Dwarf_Unsigned h = die->di_tag;
+    Dwarf_Unsigned attrsum = 0;
+    Dwarf_P_Attribute curattr = die->di_attrs;
+
+    for ( ; curattr; curattr = curattr->ar_next) {
+        Dwarf_Unsigned v =
+            ((Dwarf_Unsigned)curattr->ar_attribute << 16) ^
+            curattr->ar_attribute_form;
+
+        /*  Mix each pair so that a plain sum of them
+            spreads well. */
+        v *= 2654435761u;
+        v ^= v >> 15;
+        v *= 2246822519u;
+        v ^= v >> 13;
+        attrsum += v;
+    }
+    h = h*31 + (die->di_child? 1: 0);
+    h = h*31 + die->di_n_attr;
+    h ^= attrsum;
+    h ^= h >> 17;
+    return h;
+}
+
+/*  Doubles the number of buckets. If there is no space
+    we just carry on with the chains getting longer. */
+static void
+_dwarf_pro_abbrev_hash_grow(Dwarf_P_Debug dbg,
+    struct Dwarf_P_Abbrev_Hash_s *htab)
+{
+    Dwarf_Unsigned newcount = htab->ah_bucket_count * 2;
+    Dwarf_P_Abbrev *newbuckets = 0;
+    Dwarf_Unsigned i = 0;
+
+    newbuckets = (Dwarf_P_Abbrev *)_dwarf_p_get_alloc(dbg,
+        sizeof(Dwarf_P_Abbrev) * newcount);
+    if (newbuckets == NULL) {
+        return;
+    }
+    for (i = 0; i < htab->ah_bucket_count; ++i) {
+        Dwarf_P_Abbrev cur = htab->ah_buckets[i];
+
+        while (cur) {
+            Dwarf_P_Abbrev next = cur->abb_hash_next;
+            Dwarf_Unsigned b = cur->abb_hash & (newcount - 1);
+
+            cur->abb_hash_next = newbuckets[b];
+            newbuckets[b] = cur;
+            cur = next;
+        }
+    }
+    _dwarf_p_dealloc(dbg,(Dwarf_Small *)htab->ah_buckets);
+    htab->ah_buckets = newbuckets;
+    htab->ah_bucket_count = newcount;
+}
+
+/*  Handles abbreviations. It takes a die, searches the
+    hash table of current abbreviations for a matching one. If it
     finds one, it returns a pointer to the abbrev, and if it does not,
-    it returns a new abbrev. It is up to the user of this function to
+    it returns a new abbrev (already entered in the hash table).
+    It is up to the user of this function to
     link it up to the abbreviation head. If it is a new abbrev
     abb_idx has 0. */
 static Dwarf_P_Abbrev
-_dwarf_pro_getabbrev(Dwarf_P_Die die, Dwarf_P_Abbrev head)
+_dwarf_pro_getabbrev(Dwarf_P_Die die,
+    struct Dwarf_P_Abbrev_Hash_s *htab)
 {
     Dwarf_P_Abbrev curabbrev;
     Dwarf_P_Attribute curattr;
@@ -2424,10 +2512,13 @@ _dwarf_pro_getabbrev(Dwarf_P_Die die, Dwarf_P_Abbrev head)
     int match;
     Dwarf_ufixed *forms = 0;
     Dwarf_ufixed *attrs = 0;
+    Dwarf_Unsigned hash = _dwarf_pro_abbrev_hash(die);
+    Dwarf_Unsigned bucket = hash & (htab->ah_bucket_count - 1);
 
-    curabbrev = head;
+    curabbrev = htab->ah_buckets[bucket];
     while (curabbrev) {
-        if ((die->di_tag == curabbrev->abb_tag) &&
+        if ((curabbrev->abb_hash == hash) &&
+            (die->di_tag == curabbrev->abb_tag) &&
             ((die->di_child != NULL &&
             curabbrev->abb_children == DW_CHILDREN_yes) ||
             (die->di_child == NULL &&
@@ -2450,7 +2541,7 @@ _dwarf_pro_getabbrev(Dwarf_P_Die die, Dwarf_P_Abbrev head)
                 return curabbrev;
             }
         }
-        curabbrev = curabbrev->abb_next;
+        curabbrev = curabbrev->abb_hash_next;
     }
 
     /* no match, create new abbreviation */
@@ -2493,7 +2584,13 @@ _dwarf_pro_getabbrev(Dwarf_P_Die die, Dwarf_P_Abbrev head)
     curabbrev->abb_n_attr = die->di_n_attr;
     curabbrev->abb_idx = 0;
     curabbrev->abb_next = NULL;
-
+    curabbrev->abb_hash = hash;
+    curabbrev->abb_hash_next = htab->ah_buckets[bucket];
+    htab->ah_buckets[bucket] = curabbrev;
+    htab->ah_entry_count++;
+    if (htab->ah_entry_count > 2*htab->ah_bucket_count) {
+        _dwarf_pro_abbrev_hash_grow(die->di_dbg,htab);
+    }
     return curabbrev;
 }
 
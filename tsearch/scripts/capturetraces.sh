@@ -0,0 +1,44 @@
+#!/bin/sh
+# Runs a dwarfdump built with tsearch_trace.o (make tracedwarfdump)
+# over some object files with a few option sets and splits
+# what it records into per-site tsearch_bench traces.
+#
+#   sh capturetraces.sh dwarfdump-trace outdir object ...
+#
+# The option sets are picked to exercise the sites RUNBENCH
+# reports on:
+#   i    -i       the DIE tree; helpertree for constant forms
+#   ka   -ka      all checks; heaviest de_alloc_tree churn
+#   F    -F       .eh_frame; addrmap of subprogram low_pc
+#   f    -f       .debug_frame; addrmap too
+# David Anderson October 2026.
+
+if [ $# -lt 3 ]
+then
+  echo "Usage: sh capturetraces.sh dwarfdump-trace outdir object ..." >&2
+  exit 1
+fi
+dd=$1
+outdir=$2
+shift
+shift
+here=`dirname $0`
+raw=/tmp/capturetraces.$$
+for obj in "$@"
+do
+  ob=`basename $obj | tr -- '-' '_'`
+  for o in "i -i" "ka -ka" "F -F" "f -f"
+  do
+    set -- $o
+    name=$1
+    opt=$2
+    rm -f $raw
+    TSEARCH_TRACE=$raw $dd $opt $obj >/dev/null 2>&1
+    if [ -s $raw ]
+    then
+      sh $here/splittrace.sh $dd $raw $outdir $ob.$name || exit 1
+    fi
+  done
+done
+rm -f $raw
+exit 0
@@ -0,0 +1,76 @@
+#!/bin/sh
+# Splits a raw trace written by tsearch_trace.c into one
+# tsearch_bench input file per use site.
+#
+#   sh splittrace.sh program rawtrace outdir testcase
+#
+# program is the traced executable (not stripped), used with nm
+# to name each comparison function.  The output files are
+#   outdir/SITE-testcase.trace
+# where SITE is one of
+#   alloc       libdwarf dwarf_alloc.c de_alloc_tree
+#   helpertree  dwarfdump helpertree.c
+#   addrmap     dwarfdump addrmap.c
+# Calls made with any other comparison function are
+# counted on stderr and dropped: their keys are not
+# something the first 8 bytes describe.
+# The alloc keys are the pointers themselves, the others are
+# the 8 bytes the key pointed to.  Each distinct root pointer
+# of a site becomes a tree number, in order of first use.
+# David Anderson October 2026.
+
+if [ $# -ne 4 ]
+then
+  echo "Usage: sh splittrace.sh program rawtrace outdir testcase" >&2
+  exit 1
+fi
+prog=$1
+raw=$2
+outdir=$3
+tc=$4
+mkdir -p $outdir || exit 1
+nm $prog >/tmp/splittrace.$$ || exit 1
+awk -v outdir=$outdir -v tc=$tc '
+BEGIN {
+  sitename["simple_compare_function"] = "alloc"
+  sitename["helpertree_map_compare_func"] = "helpertree"
+  sitename["addr_map_compare_func"] = "addrmap"
+}
+# First file: the nm output.
+FNR == NR {
+  if (NF == 3 && ($3 in sitename)) {
+    a = $1
+    sub(/^0+/,"",a)
+    if (a == "") {
+      a = "0"
+    }
+    site[a] = sitename[$3]
+  }
+  next
+}
+{
+  if (!($1 in site)) {
+    dropped[$1]++
+    next
+  }
+  s = site[$1]
+  tk = s " " $2
+  if (!(tk in tree)) {
+    tree[tk] = ntrees[s]++
+  }
+  if (s == "alloc") {
+    k = $4
+  } else {
+    k = $5
+  }
+  print $3 " 0x" k " " tree[tk] > (outdir "/" s "-" tc ".trace")
+}
+END {
+  for (d in dropped) {
+    printf("splittrace: dropped %d calls with compar %s\n",
+      dropped[d],d) > "/dev/stderr"
+  }
+}' /tmp/splittrace.$$ $raw
+r=$?
+rm -f /tmp/splittrace.$$
+exit $r
@@ -0,0 +1,433 @@
+/* Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+/*  Replays tsearch call traces against one tsearch
+    implementation and reports the cost.
+
+    tsearch_bench [-h] [-r repeats] tracefile ...
+
+    Each trace line is
+        a <key> [tree]     dwarf_tsearch()
+        f <key> [tree]     dwarf_tfind()
+        d <key> [tree]     dwarf_tdelete()
+        x 0 [tree]         dwarf_tdestroy() then start afresh
+    with # lines ignored, so the older testcases/ files
+    (only a and d lines) replay too.  tree is a small
+    integer naming one of several trees the use site
+    had live at once.  scripts/splittrace.sh writes files
+    in this form from what tsearch_trace.c captures.
+
+    For each file one CSV line is printed:
+        lib,site,testcase,ops,nsperop,p50ns,p99ns,p999ns,maxns,
+            peakrsskb,treersskb
+    nsperop is the best of 'repeats' untimed-per-op runs.
+    The percentiles come from one further run timing every
+    call, less the measured cost of reading the clock.
+    peakrsskb is getrusage() ru_maxrss after the runs and
+    treersskb is the growth in it caused by the runs (so it
+    excludes the trace itself). For the RSS numbers to mean
+    anything give just one file per run, as RUNBENCH does.
+    -h prints the CSV header line first.
+
+    The file name gives the site and testcase: a file
+    named SITE-TESTCASE.trace reports as SITE,TESTCASE;
+    any other file reports as file,<basename>.
+
+    Keys are replayed by pointer, each pointing at an 8
+    byte key in a preallocated array, so the
+    replay measures the tsearch code and its own
+    allocations, not the caller's.
+
+    Compile with -DBENCHLIB=\"name\" and, as for
+    tsearch_tester.c, -DLIBC_TSEARCH for the libc version
+    or -DHASHSEARCH for dwarf_tsearchhash.c.
+*/
+
+#ifdef LIBC_TSEARCH
+#define _GNU_SOURCE /* for tdestroy */
+#endif /* LIBC_TSEARCH */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include "dwarf_tsearch.h"
+
+#ifdef LIBC_TSEARCH
+#include <search.h>
+#define dwarf_tsearch(a,b,c) tsearch(a,b,c)
+#define dwarf_tfind(a,b,c) tfind(a,b,c)
+#define dwarf_tdelete(a,b,c) tdelete(a,b,c)
+#define dwarf_tdestroy(a,b) tdestroy(a,b)
+#endif /* LIBC_TSEARCH */
+
+#ifndef BENCHLIB
+#define BENCHLIB "unknown"
+#endif
+
+typedef unsigned long long bkey_t;
+
+struct bench_op {
+    char bo_op;
+    unsigned bo_tree;
+    bkey_t bo_key;
+};
+
+struct bench_trace {
+    struct bench_op *bt_ops;
+    unsigned long bt_count;
+    unsigned bt_trees;
+    char bt_site[100];
+    char bt_testcase[200];
+};
+
+static int
+bench_compare(const void *l, const void *r)
+{
+    const bkey_t *lk = l;
+    const bkey_t *rk = r;
+
+    if (*lk < *rk) {
+        return -1;
+    }
+    if (*lk > *rk) {
+        return 1;
+    }
+    return 0;
+}
+
+#ifdef HASHSEARCH
+/*  The same identity hash as libdwarf's de_alloc_tree
+    simple_value_hashfunc(), applied to the key value. */
+static DW_TSHASHTYPE
+bench_hashfunc(const void *keyp)
+{
+    const bkey_t *k = keyp;
+    return (DW_TSHASHTYPE)*k;
+}
+#define INITTREE(x) x = dwarf_initialize_search_hash(&(x),bench_hashfunc,0)
+#else
+#define INITTREE(x)
+#endif
+
+static void
+bench_nofree(void *n)
+{
+    /* The keys live in the keys[] array, nothing to free. */
+    (void)n;
+}
+
+static double
+bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return (double)ts.tv_sec*1e9 + (double)ts.tv_nsec;
+}
+
+static long
+bench_maxrss(void)
+{
+    struct rusage ru;
+
+    memset(&ru,0,sizeof(ru));
+    getrusage(RUSAGE_SELF,&ru);
+    return ru.ru_maxrss;
+}
+
+static void
+bench_names(struct bench_trace *t, const char *path)
+{
+    const char *base = strrchr(path,'/');
+    const char *dash = 0;
+    size_t len = 0;
+
+    base = base? base+1:path;
+    len = strlen(base);
+    dash = strchr(base,'-');
+    if (len > 6 && !strcmp(base+len-6,".trace") && dash) {
+        size_t sl = dash - base;
+        size_t tl = len - 6 - sl - 1;
+
+        if (sl >= sizeof(t->bt_site)) {
+            sl = sizeof(t->bt_site) -1;
+        }
+        if (tl >= sizeof(t->bt_testcase)) {
+            tl = sizeof(t->bt_testcase) -1;
+        }
+        memcpy(t->bt_site,base,sl);
+        t->bt_site[sl] = 0;
+        memcpy(t->bt_testcase,dash+1,tl);
+        t->bt_testcase[tl] = 0;
+        return;
+    }
+    strcpy(t->bt_site,"file");
+    strncpy(t->bt_testcase,base,sizeof(t->bt_testcase)-1);
+    t->bt_testcase[sizeof(t->bt_testcase)-1] = 0;
+}
+
+static int
+bench_read(struct bench_trace *t, const char *path)
+{
+    FILE *f = fopen(path,"r");
+    char buf[200];
+    unsigned long alloced = 0;
+    unsigned long line = 0;
+
+    if (!f) {
+        fprintf(stderr,"tsearch_bench: cannot open %s\n",path);
+        return 1;
+    }
+    memset(t,0,sizeof(*t));
+    bench_names(t,path);
+    while (fgets(buf,sizeof(buf),f)) {
+        struct bench_op *o = 0;
+        char *cp = 0;
+
+        ++line;
+        if (buf[0] == '#' || buf[0] == '\n') {
+            continue;
+        }
+        if (!strchr("afdx",buf[0]) || buf[1] != ' ') {
+            fprintf(stderr,"Improper input, line %lu of file %s\n%s",
+                line,path,buf);
+            fclose(f);
+            return 1;
+        }
+        if (t->bt_count == alloced) {
+            alloced = alloced? alloced*2:4096;
+            t->bt_ops = realloc(t->bt_ops,alloced*sizeof(*o));
+            if (!t->bt_ops) {
+                fprintf(stderr,"tsearch_bench: out of memory\n");
+                exit(1);
+            }
+        }
+        o = &t->bt_ops[t->bt_count++];
+        o->bo_op = buf[0];
+        o->bo_key = strtoull(&buf[2],&cp,0);
+        o->bo_tree = (unsigned)strtoul(cp,0,0);
+        if (o->bo_tree >= t->bt_trees) {
+            t->bt_trees = o->bo_tree+1;
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+/*  One replay of the trace.  If lat is non-null each
+    call is timed and stored there. */
+static void
+bench_replay(struct bench_trace *t, bkey_t *keys, void **roots,
+    double *lat)
+{
+    unsigned long i = 0;
+    unsigned r = 0;
+
+    for (r = 0; r < t->bt_trees; ++r) {
+        roots[r] = 0;
+        INITTREE(roots[r]);
+    }
+    for (i = 0; i < t->bt_count; ++i) {
+        struct bench_op *o = &t->bt_ops[i];
+        void **rootp = &roots[o->bo_tree];
+        double start = 0;
+
+        if (lat) {
+            start = bench_now();
+        }
+        switch (o->bo_op) {
+        case 'a':
+            dwarf_tsearch(&keys[i],rootp,bench_compare);
+            break;
+        case 'f':
+            dwarf_tfind(&keys[i],rootp,bench_compare);
+            break;
+        case 'd':
+            dwarf_tdelete(&keys[i],rootp,bench_compare);
+            break;
+        case 'x':
+            if (*rootp) {
+                dwarf_tdestroy(*rootp,bench_nofree);
+            }
+            *rootp = 0;
+            INITTREE(*rootp);
+            break;
+        }
+        if (lat) {
+            lat[i] = bench_now() - start;
+        }
+    }
+    for (r = 0; r < t->bt_trees; ++r) {
+        if (roots[r]) {
+            dwarf_tdestroy(roots[r],bench_nofree);
+        }
+        roots[r] = 0;
+    }
+}
+
+static int
+bench_double_cmp(const void *l, const void *r)
+{
+    double a = *(const double *)l;
+    double b = *(const double *)r;
+
+    return (a < b)? -1: (a > b)? 1: 0;
+}
+
+static double
+bench_percentile(double *sorted, unsigned long n, double pct)
+{
+    unsigned long ix = 0;
+
+    if (!n) {
+        return 0;
+    }
+    ix = (unsigned long)(pct * (double)(n-1));
+    return sorted[ix];
+}
+
+/*  The least cost of a back to back pair of clock reads,
+    subtracted from each per-call time. */
+static double
+bench_clock_cost(void)
+{
+    double best = 1e9;
+    int i = 0;
+
+    for (i = 0; i < 1000; ++i) {
+        double a = bench_now();
+        double b = bench_now();
+        if (b - a < best) {
+            best = b - a;
+        }
+    }
+    return best;
+}
+
+static void
+bench_one(const char *path, unsigned repeats, double clockcost)
+{
+    struct bench_trace t;
+    bkey_t *keys = 0;
+    void **roots = 0;
+    double *lat = 0;
+    double best = 0;
+    long rss_before = 0;
+    unsigned long i = 0;
+    unsigned r = 0;
+
+    if (bench_read(&t,path)) {
+        exit(1);
+    }
+    keys = calloc(t.bt_count+1,sizeof(bkey_t));
+    roots = calloc(t.bt_trees+1,sizeof(void *));
+    lat = calloc(t.bt_count+1,sizeof(double));
+    if (!keys || !roots || !lat) {
+        fprintf(stderr,"tsearch_bench: out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < t.bt_count; ++i) {
+        keys[i] = t.bt_ops[i].bo_key;
+    }
+    /*  Touch lat[] now so its pages do not count
+        as tree growth. */
+    memset(lat,1,t.bt_count*sizeof(double));
+    rss_before = bench_maxrss();
+    for (r = 0; r < repeats; ++r) {
+        double start = bench_now();
+        double el = 0;
+
+        bench_replay(&t,keys,roots,0);
+        el = bench_now() - start;
+        if (!r || el < best) {
+            best = el;
+        }
+    }
+    bench_replay(&t,keys,roots,lat);
+    for (i = 0; i < t.bt_count; ++i) {
+        lat[i] -= clockcost;
+        if (lat[i] < 0) {
+            lat[i] = 0;
+        }
+    }
+    qsort(lat,t.bt_count,sizeof(double),bench_double_cmp);
+    printf("%s,%s,%s,%lu,%.1f,%.0f,%.0f,%.0f,%.0f,%ld,%ld\n",
+        BENCHLIB,t.bt_site,t.bt_testcase,t.bt_count,
+        t.bt_count? best/(double)t.bt_count:0.0,
+        bench_percentile(lat,t.bt_count,0.50),
+        bench_percentile(lat,t.bt_count,0.99),
+        bench_percentile(lat,t.bt_count,0.999),
+        t.bt_count? lat[t.bt_count-1]:0.0,
+        bench_maxrss(),
+        bench_maxrss() - rss_before);
+    fflush(stdout);
+    free(lat);
+    free(roots);
+    free(keys);
+    free(t.bt_ops);
+}
+
+static void
+print_usage(const char *app)
+{
+    fprintf(stderr,"Usage: %s [-h] [-r repeats] tracefile ...\n",app);
+    exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned repeats = 5;
+    int ix = 1;
+    double clockcost = 0;
+
+    for ( ; ix < argc && argv[ix][0] == '-'; ++ix) {
+        if (!strcmp(argv[ix],"-h")) {
+            printf("lib,site,testcase,ops,nsperop,p50ns,p99ns,p999ns,"
+                "maxns,peakrsskb,treersskb\n");
+        } else if (!strcmp(argv[ix],"-r") && ix+1 < argc) {
+            repeats = (unsigned)atoi(argv[++ix]);
+            if (!repeats) {
+                repeats = 1;
+            }
+        } else {
+            print_usage(argv[0]);
+        }
+    }
+    clockcost = bench_clock_cost();
+    for ( ; ix < argc; ++ix) {
+        bench_one(argv[ix],repeats,clockcost);
+    }
+    return 0;
+}
@@ -0,0 +1,260 @@
+/* Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+/*  Captures a trace of every dwarf_tsearch() family call made
+    by a real program (normally dwarfdump with libdwarf
+    linked in) so the calls can be replayed against each
+    tsearch implementation by tsearch_bench.c.
+
+    Nothing in libdwarf or dwarfdump is changed.  Instead
+    this file is linked in with the GNU ld option
+        -Wl,--wrap=dwarf_tsearch,--wrap=_dwarf_tsearch,...
+    for each of tsearch, tfind, tdelete and tdestroy
+    (see 'make tracedwarfdump') so every call goes through
+    the __wrap_ functions here and then on to the real
+    implementation.
+
+    If the environment variable TSEARCH_TRACE names a file
+    one line is written there for each call:
+        <compar> <rootp> <op> <keyptr> <keyval>
+    all in hex except op, which is one of
+        a  dwarf_tsearch()   (add, or find an existing record)
+        f  dwarf_tfind()
+        d  dwarf_tdelete()
+        x  dwarf_tdestroy()
+    compar is the comparison function address as nm(1)
+    reports it (relative to the load address for a
+    position-independent executable or shared library), so
+    scripts/splittrace.sh can name the use site.
+    keyval is the first 8 bytes the key points at, which is
+    the DIE offset, address or signature for the dwarfdump
+    helpertree and addrmap.
+    The de_alloc_tree key is the pointer itself: splittrace.sh
+    picks keyptr or keyval per site.
+
+    Reading 8 bytes at every key is harmless for the sites
+    above but is not something to do under -fsanitize=address.
+*/
+
+#define _GNU_SOURCE /* for dladdr */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+#include "dwarf_tsearch.h"
+
+typedef int (*tt_compar)(const void *, const void *);
+
+#define TT_DECLS(name) \
+void *__real_##name##tsearch(const void *, void **, tt_compar); \
+void *__real_##name##tfind(const void *, void *const *, tt_compar); \
+void *__real_##name##tdelete(const void *, void **, tt_compar); \
+void __real_##name##tdestroy(void *, void (*)(void *)); \
+void *__wrap_##name##tsearch(const void *, void **, tt_compar); \
+void *__wrap_##name##tfind(const void *, void *const *, tt_compar); \
+void *__wrap_##name##tdelete(const void *, void **, tt_compar); \
+void __wrap_##name##tdestroy(void *, void (*)(void *));
+TT_DECLS(dwarf_)
+TT_DECLS(_dwarf_)
+
+/*  dwarf_tdestroy() is handed the root, not the address of
+    the root, so we remember the latest root seen through
+    each rootp to work out which tree is being destroyed. */
+struct tt_root_s {
+    const void *tr_rootp;
+    const void *tr_root;
+    unsigned long tr_compar;
+};
+
+#define TT_ROOTS_MAX 1024
+static struct tt_root_s tt_roots[TT_ROOTS_MAX];
+static unsigned tt_roots_count;
+
+static FILE *tt_file;
+static int tt_state; /* 0 unopened, 1 tracing, 2 off */
+
+static void
+tt_close(void)
+{
+    if (tt_file) {
+        fclose(tt_file);
+        tt_file = 0;
+    }
+}
+
+static FILE *
+tt_open(void)
+{
+    const char *name = 0;
+
+    if (tt_state) {
+        return tt_file;
+    }
+    tt_state = 2;
+    name = getenv("TSEARCH_TRACE");
+    if (!name || !*name) {
+        return 0;
+    }
+    tt_file = fopen(name,"w");
+    if (!tt_file) {
+        fprintf(stderr,"tsearch_trace: cannot open %s\n",name);
+        return 0;
+    }
+    setvbuf(tt_file,0,_IOFBF,1<<20);
+    atexit(tt_close);
+    tt_state = 1;
+    return tt_file;
+}
+
+static unsigned long
+tt_compar_offset(tt_compar compar)
+{
+    Dl_info info;
+    unsigned long a = 0;
+
+    /*  Converting a function pointer to an integer is not
+        ISO C but is what dladdr() needs anyway. */
+    memcpy(&a,&compar,sizeof(a) < sizeof(compar)?
+        sizeof(a):sizeof(compar));
+    memset(&info,0,sizeof(info));
+    if (dladdr((void *)a,&info) && info.dli_fbase) {
+        /*  The ELF header is mapped at dli_fbase. Only for
+            ET_DYN (3) objects does nm(1) show base-relative
+            addresses, an ET_EXEC shows the real address. */
+        unsigned short e_type = 0;
+
+        memcpy(&e_type,(char *)info.dli_fbase+16,sizeof(e_type));
+        if (e_type == 3) {
+            return a - (unsigned long)info.dli_fbase;
+        }
+    }
+    return a;
+}
+
+static struct tt_root_s *
+tt_find_rootp(const void *rootp)
+{
+    unsigned i = 0;
+
+    for (i = 0; i < tt_roots_count; ++i) {
+        if (tt_roots[i].tr_rootp == rootp) {
+            return &tt_roots[i];
+        }
+    }
+    if (tt_roots_count >= TT_ROOTS_MAX) {
+        return 0;
+    }
+    tt_roots[tt_roots_count].tr_rootp = rootp;
+    return &tt_roots[tt_roots_count++];
+}
+
+static void
+tt_record(char op, const void *key, const void *rootp,
+    tt_compar compar)
+{
+    FILE *f = tt_open();
+    struct tt_root_s *r = 0;
+    unsigned long long val = 0;
+
+    if (!f) {
+        return;
+    }
+    r = tt_find_rootp(rootp);
+    if (r) {
+        if (!r->tr_compar) {
+            r->tr_compar = tt_compar_offset(compar);
+        }
+        r->tr_root = *(void *const *)rootp;
+    }
+    if (key) {
+        memcpy(&val,key,sizeof(val));
+    }
+    fprintf(f,"%lx %lx %c %lx %llx\n",
+        r? r->tr_compar:tt_compar_offset(compar),
+        (unsigned long)rootp,op,(unsigned long)key,val);
+}
+
+static void
+tt_record_destroy(void *root)
+{
+    FILE *f = tt_open();
+    unsigned i = 0;
+
+    if (!f || !root) {
+        return;
+    }
+    for (i = 0; i < tt_roots_count; ++i) {
+        struct tt_root_s *r = &tt_roots[i];
+
+        if (r->tr_root == root) {
+            fprintf(f,"%lx %lx x 0 0\n",r->tr_compar,
+                (unsigned long)r->tr_rootp);
+            r->tr_root = 0;
+            return;
+        }
+    }
+}
+
+/*  Both the dwarfdump names and the _dwarf_ names libdwarf
+    gives its own copy (see libdwarf/dwarf_tsearch.h). */
+#define TT_WRAPPERS(name) \
+void * \
+__wrap_##name##tsearch(const void *key, void **rootp, tt_compar compar) \
+{ \
+    void *res = __real_##name##tsearch(key,rootp,compar); \
+    tt_record('a',key,rootp,compar); \
+    return res; \
+} \
+void * \
+__wrap_##name##tfind(const void *key, void *const *rootp, \
+    tt_compar compar) \
+{ \
+    void *res = __real_##name##tfind(key,rootp,compar); \
+    tt_record('f',key,rootp,compar); \
+    return res; \
+} \
+void * \
+__wrap_##name##tdelete(const void *key, void **rootp, tt_compar compar) \
+{ \
+    void *res = __real_##name##tdelete(key,rootp,compar); \
+    tt_record('d',key,rootp,compar); \
+    return res; \
+} \
+void \
+__wrap_##name##tdestroy(void *root, void (*free_node)(void *)) \
+{ \
+    tt_record_destroy(root); \
+    __real_##name##tdestroy(root,free_node); \
+}
+
+TT_WRAPPERS(dwarf_)
+TT_WRAPPERS(_dwarf_)